@@ -36,6 +36,7 @@
 #include "devices/IDeviceFactory.h"
 #include "devices/NULLDevice.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <cmath>
@@ -218,43 +219,64 @@ AUD_API int AUD_readSound(AUD_Sound* sound, float* buffer, int length, int sampl
 	float min, max, power, overallmax;
 	bool eos;
 
+	// read many waveform samples at once, a reader call per waveform sample
+	// has a lot of overhead for decoded and resampled sources
+	const int block = 256;
+
 	overallmax = 0;
 
-	for(int i = 0; i < length; i++)
+	for(int i = 0; i < length; i += block)
 	{
-		len = floor(samplejump * (i+1)) - floor(samplejump * i);
-
 		if(*interrupt)
 			return 0;
 
+		int end = std::min(i + block, length);
+		int first = floor(samplejump * i);
+		len = floor(samplejump * end) - first;
+
 		aBuffer.assureSize(len * AUD_SAMPLE_SIZE(specs));
 		buf = aBuffer.getBuffer();
 
 		reader->read(len, eos, buf);
 
-		max = min = *buf;
-		power = *buf * *buf;
-		for(int j = 1; j < len; j++)
+		int written = i;
+
+		for(int k = i; k < end; k++)
 		{
-			if(buf[j] < min)
-				min = buf[j];
-			if(buf[j] > max)
-				max = buf[j];
-			power += buf[j] * buf[j];
-		}
+			int offset = int(floor(samplejump * k)) - first;
+			int sample_len = std::min(int(floor(samplejump * (k + 1))) - first, len) - offset;
+
+			if(sample_len <= 0)
+				break;
 
-		buffer[i * 3] = min;
-		buffer[i * 3 + 1] = max;
-		buffer[i * 3 + 2] = std::sqrt(power / len);
+			float* sample = buf + offset;
 
-		if(overallmax < max)
-			overallmax = max;
-		if(overallmax < -min)
-			overallmax = -min;
+			max = min = *sample;
+			power = *sample * *sample;
+			for(int j = 1; j < sample_len; j++)
+			{
+				if(sample[j] < min)
+					min = sample[j];
+				if(sample[j] > max)
+					max = sample[j];
+				power += sample[j] * sample[j];
+			}
+
+			buffer[k * 3] = min;
+			buffer[k * 3 + 1] = max;
+			buffer[k * 3 + 2] = std::sqrt(power / sample_len);
+
+			if(overallmax < max)
+				overallmax = max;
+			if(overallmax < -min)
+				overallmax = -min;
+
+			written = k + 1;
+		}
 
-		if(eos)
+		if(eos || written < end)
 		{
-			length = i;
+			length = written;
 			break;
 		}
 	}
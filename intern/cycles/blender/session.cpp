@@ -452,6 +452,15 @@ void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
       RenderStats stats;
       session->collect_statistics(&stats);
       printf("Render statistics:\n%s\n", stats.full_report().c_str());
+
+      /* Optionally write the statistics in a machine-readable form as well, for render farm
+       * tooling. With multiple view layers or views the file holds the last one rendered. */
+      if (const char *json_path = getenv("CYCLES_RENDER_STATS_JSON")) {
+        string json = stats.json_report();
+        if (!path_write_text(json_path, json)) {
+          LOG(ERROR) << "Failed to write render statistics to " << json_path;
+        }
+      }
     }
 
     if (session->progress.get_cancel()) {
@@ -275,6 +275,28 @@ static bool is_image_animated(BL::Image::source_enum b_image_source, BL::ImageUs
          b_image_user.use_auto_refresh();
 }
 
+/* Whether the shader graph of a previous sync uses an image that changes with the frame. Other
+ * shaders don't need to be synced again when only the frame of animated images changed. */
+static bool shader_has_animated_image(const Shader *shader)
+{
+  if (shader->graph == nullptr) {
+    return true;
+  }
+  for (const ShaderNode *node : shader->graph->nodes) {
+    if (node->type == ImageTextureNode::get_node_type()) {
+      if (static_cast<const ImageTextureNode *>(node)->get_animated()) {
+        return true;
+      }
+    }
+    else if (node->type == EnvironmentTextureNode::get_node_type()) {
+      if (static_cast<const EnvironmentTextureNode *>(node)->get_animated()) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 static ShaderNode *add_node(Scene *scene,
                             BL::RenderEngine &b_engine,
                             BL::BlendData &b_data,
@@ -1582,7 +1604,8 @@ void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
     Shader *shader;
 
     /* test if we need to sync */
-    if (shader_map.add_or_update(&shader, b_mat) || update_all ||
+    if (shader_map.add_or_update(&shader, b_mat) ||
+        (update_all && shader_has_animated_image(shader)) ||
         scene_attr_needs_recalc(shader, b_depsgraph))
     {
       unique_ptr<ShaderGraph> graph = make_unique<ShaderGraph>();
@@ -1826,7 +1849,8 @@ void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
     Shader *shader;
 
     /* test if we need to sync */
-    if (shader_map.add_or_update(&shader, b_light) || update_all ||
+    if (shader_map.add_or_update(&shader, b_light) ||
+        (update_all && shader_has_animated_image(shader)) ||
         scene_attr_needs_recalc(shader, b_depsgraph))
     {
       unique_ptr<ShaderGraph> graph = make_unique<ShaderGraph>();
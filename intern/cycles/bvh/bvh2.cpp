@@ -19,6 +19,7 @@
 #include "bvh/unaligned.h"
 
 #include "util/progress.h"
+#include "util/task.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -290,6 +291,9 @@ void BVH2::pack_nodes(const BVHNode *root)
   pack.root_index = (root->is_leaf()) ? -1 : 0;
 }
 
+/* Number of tree levels below the root for which children are refit in parallel. */
+static constexpr int BVH_REFIT_PARALLEL_DEPTH = 8;
+
 void BVH2::refit_nodes()
 {
   assert(!params.top_level);
@@ -299,7 +303,8 @@ void BVH2::refit_nodes()
   refit_node(0, (pack.root_index == -1) ? true : false, bbox, visibility);
 }
 
-void BVH2::refit_node(const int idx, bool leaf, BoundBox &bbox, uint &visibility)
+void BVH2::refit_node(
+    const int idx, bool leaf, BoundBox &bbox, uint &visibility, const int depth)
 {
   if (leaf) {
     /* refit leaf node */
@@ -331,8 +336,19 @@ void BVH2::refit_node(const int idx, bool leaf, BoundBox &bbox, uint &visibility
     uint visibility0 = 0;
     uint visibility1 = 0;
 
-    refit_node((c0 < 0) ? -c0 - 1 : c0, (c0 < 0), bbox0, visibility0);
-    refit_node((c1 < 0) ? -c1 - 1 : c1, (c1 < 0), bbox1, visibility1);
+    /* Children write to separate nodes, so the top levels of the tree are refit in parallel. */
+    if (depth < BVH_REFIT_PARALLEL_DEPTH) {
+      TaskPool pool;
+      pool.push([&] {
+        refit_node((c0 < 0) ? -c0 - 1 : c0, (c0 < 0), bbox0, visibility0, depth + 1);
+      });
+      refit_node((c1 < 0) ? -c1 - 1 : c1, (c1 < 0), bbox1, visibility1, depth + 1);
+      pool.wait_work();
+    }
+    else {
+      refit_node((c0 < 0) ? -c0 - 1 : c0, (c0 < 0), bbox0, visibility0, depth + 1);
+      refit_node((c1 < 0) ? -c1 - 1 : c1, (c1 < 0), bbox1, visibility1, depth + 1);
+    }
 
     if (is_unaligned) {
       const Transform aligned_space = transform_identity();
@@ -82,7 +82,8 @@ class BVH2 : public BVH {
 
   /* refit */
   void refit_nodes();
-  void refit_node(const int idx, bool leaf, BoundBox &bbox, uint &visibility);
+  void refit_node(
+      const int idx, bool leaf, BoundBox &bbox, uint &visibility, const int depth = 0);
 
   /* Refit range of primitives. */
   void refit_primitives(const int start, const int end, BoundBox &bbox, uint &visibility);
@@ -76,29 +76,37 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
 
   tbb::task_arena local_arena = local_tbb_arena_create(device_);
   local_arena.execute([&]() {
-    parallel_for(int64_t(0), total_pixels_num, [&](int64_t work_index) {
-      if (is_cancel_requested()) {
-        return;
-      }
-
-      const int y = work_index / image_width;
-      const int x = work_index - y * image_width;
-
-      KernelWorkTile work_tile;
-      work_tile.x = effective_buffer_params_.full_x + x;
-      work_tile.y = effective_buffer_params_.full_y + y;
-      work_tile.w = 1;
-      work_tile.h = 1;
-      work_tile.start_sample = start_sample;
-      work_tile.sample_offset = sample_offset;
-      work_tile.num_samples = 1;
-      work_tile.offset = effective_buffer_params_.offset;
-      work_tile.stride = effective_buffer_params_.stride;
-
-      ThreadKernelGlobalsCPU *kernel_globals = kernel_thread_globals_get(kernel_thread_globals_);
-
-      render_samples_full_pipeline(kernel_globals, work_tile, samples_num);
-    });
+    /* Pixels are processed in ranges, so that the kernel globals are looked up once per range
+     * and neighboring pixels, which tend to trace similar rays, are rendered by the same thread. */
+    parallel_for(blocked_range<int64_t>(0, total_pixels_num),
+                 [&](const blocked_range<int64_t> &range) {
+                   ThreadKernelGlobalsCPU *kernel_globals = kernel_thread_globals_get(
+                       kernel_thread_globals_);
+
+                   for (int64_t work_index = range.begin(); work_index != range.end();
+                        work_index++)
+                   {
+                     if (is_cancel_requested()) {
+                       return;
+                     }
+
+                     const int y = work_index / image_width;
+                     const int x = work_index - y * image_width;
+
+                     KernelWorkTile work_tile;
+                     work_tile.x = effective_buffer_params_.full_x + x;
+                     work_tile.y = effective_buffer_params_.full_y + y;
+                     work_tile.w = 1;
+                     work_tile.h = 1;
+                     work_tile.start_sample = start_sample;
+                     work_tile.sample_offset = sample_offset;
+                     work_tile.num_samples = 1;
+                     work_tile.offset = effective_buffer_params_.offset;
+                     work_tile.stride = effective_buffer_params_.stride;
+
+                     render_samples_full_pipeline(kernel_globals, work_tile, samples_num);
+                   }
+                 });
   });
   if (device_->profiler.active()) {
     for (ThreadKernelGlobalsCPU &kernel_globals : kernel_thread_globals_) {
@@ -101,39 +101,24 @@ static void oiio_load_pixels(const ImageMetaData &metadata,
   const int depth = metadata.depth;
   const int components = metadata.channels;
 
-  /* Read pixels through OpenImageIO. */
-  StorageType *readpixels = pixels;
-  vector<StorageType> tmppixels;
-  if (components > 4) {
-    tmppixels.resize(width * height * components);
-    readpixels = &tmppixels[0];
-  }
+  /* Read pixels through OpenImageIO. Only the first four channels are used, so images with more
+   * channels are read without a temporary buffer holding all of them. */
+  const int read_components = min(components, 4);
 
   if (depth <= 1) {
-    const size_t scanlinesize = width * components * sizeof(StorageType);
+    const size_t scanlinesize = width * read_components * sizeof(StorageType);
     in->read_image(0,
                    0,
                    0,
-                   components,
+                   read_components,
                    FileFormat,
-                   (uchar *)readpixels + (height - 1) * scanlinesize,
+                   (uchar *)pixels + (height - 1) * scanlinesize,
                    AutoStride,
                    -scanlinesize,
                    AutoStride);
   }
   else {
-    in->read_image(0, 0, 0, components, FileFormat, (uchar *)readpixels);
-  }
-
-  if (components > 4) {
-    const size_t dimensions = width * height;
-    for (size_t i = dimensions - 1, pixel = 0; pixel < dimensions; pixel++, i--) {
-      pixels[i * 4 + 3] = tmppixels[i * components + 3];
-      pixels[i * 4 + 2] = tmppixels[i * components + 2];
-      pixels[i * 4 + 1] = tmppixels[i * components + 1];
-      pixels[i * 4 + 0] = tmppixels[i * components + 0];
-    }
-    tmppixels.clear();
+    in->read_image(0, 0, 0, read_components, FileFormat, (uchar *)pixels);
   }
 
   /* CMYK to RGBA. */
@@ -269,11 +269,26 @@ bool LightTree::triangle_usable_as_light(Mesh *mesh, const int prim_id)
 
 void LightTree::add_mesh(Scene *scene, Mesh *mesh, const int object_id)
 {
+  /* Computing the measure of every emissive triangle is expensive for large meshes, so it is done
+   * in parallel over chunks of triangles. The chunks are appended in order to keep the build
+   * deterministic. */
   const size_t mesh_num_triangles = mesh->num_triangles();
-  for (size_t i = 0; i < mesh_num_triangles; i++) {
-    if (triangle_usable_as_light(mesh, i)) {
-      emitters_.emplace_back(scene, i, object_id);
+  const size_t chunk_size = MIN_EMITTERS_PER_THREAD;
+  const size_t num_chunks = divide_up(mesh_num_triangles, chunk_size);
+
+  vector<vector<LightTreeEmitter>> chunk_emitters(num_chunks);
+  parallel_for(size_t(0), num_chunks, [&](const size_t chunk) {
+    const size_t start = chunk * chunk_size;
+    const size_t end = min(start + chunk_size, mesh_num_triangles);
+    for (size_t i = start; i < end; i++) {
+      if (triangle_usable_as_light(mesh, i)) {
+        chunk_emitters[chunk].emplace_back(scene, i, object_id);
+      }
     }
+  });
+
+  for (vector<LightTreeEmitter> &emitters : chunk_emitters) {
+    std::move(emitters.begin(), emitters.end(), std::back_inserter(emitters_));
   }
 }
 
@@ -12,6 +12,7 @@
 #include "util/algorithm.h"
 
 #include "util/log.h"
+#include "util/map.h"
 #include "util/md5.h"
 #include "util/queue.h"
 
@@ -604,7 +605,9 @@ void ShaderGraph::deduplicate_nodes()
 
   ShaderNodeSet scheduled;
   ShaderNodeSet done;
-  map<ustring, ShaderNodeSet> candidates;
+  /* Candidates are grouped by node type. Equal nodes are merged as soon as they are visited, so
+   * each group holds at most one node per equivalence class and its order does not matter. */
+  unordered_map<const NodeType *, vector<ShaderNode *>> candidates;
   queue<ShaderNode *> traverse_queue;
   int num_deduplicated = 0;
 
@@ -644,7 +647,8 @@ void ShaderGraph::deduplicate_nodes()
     }
     /* Try to merge this node with another one. */
     ShaderNode *merge_with = nullptr;
-    for (ShaderNode *other_node : candidates[node->type->name]) {
+    vector<ShaderNode *> &type_candidates = candidates[node->type];
+    for (ShaderNode *other_node : type_candidates) {
       if (node != other_node && node->equals(*other_node)) {
         merge_with = other_node;
         break;
@@ -658,7 +662,7 @@ void ShaderGraph::deduplicate_nodes()
       num_deduplicated++;
     }
     else {
-      candidates[node->type->name].insert(node);
+      type_candidates.push_back(node);
     }
   }
 
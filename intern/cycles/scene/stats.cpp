@@ -39,6 +39,37 @@ bool namedSampleCountPairComparator(const NamedSampleCountPair &a, const NamedSa
   return a.samples > b.samples;
 }
 
+string json_string(const string &str)
+{
+  string result = "\"";
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        if ((unsigned char)c < 0x20) {
+          result += string_printf("\\u%04x", (unsigned int)c);
+        }
+        else {
+          result += c;
+        }
+        break;
+    }
+  }
+  result += "\"";
+  return result;
+}
+
 }  // namespace
 
 NamedSizeEntry::NamedSizeEntry() : size(0) {}
@@ -79,6 +110,19 @@ string NamedSizeStats::full_report(const int indent_level)
   return result;
 }
 
+string NamedSizeStats::json_report() const
+{
+  string result = string_printf("{\"total_size\": %zu, \"entries\": {", total_size);
+  for (size_t i = 0; i < entries.size(); i++) {
+    result += string_printf("%s%s: %zu",
+                            (i == 0) ? "" : ", ",
+                            json_string(entries[i].name).c_str(),
+                            entries[i].size);
+  }
+  result += "}}";
+  return result;
+}
+
 string NamedTimeStats::full_report(const int indent_level)
 {
   const string indent(indent_level * kIndentNumSpaces, ' ');
@@ -146,6 +190,24 @@ string NamedNestedSampleStats::full_report(const int indent_level, uint64_t tota
   return result;
 }
 
+string NamedNestedSampleStats::json_report() const
+{
+  /* Samples are taken once per millisecond, see Profiler. */
+  string result = string_printf("{\"name\": %s, \"time\": %.3f, \"self_time\": %.3f",
+                                json_string(name).c_str(),
+                                sum_samples * 0.001,
+                                self_samples * 0.001);
+  if (!entries.empty()) {
+    result += ", \"entries\": [";
+    for (size_t i = 0; i < entries.size(); i++) {
+      result += ((i == 0) ? "" : ", ") + entries[i].json_report();
+    }
+    result += "]";
+  }
+  result += "}";
+  return result;
+}
+
 /* Named sample count pairs. */
 
 NamedSampleCountPair::NamedSampleCountPair(const ustring &name,
@@ -201,6 +263,23 @@ string NamedSampleCountStats::full_report(const int indent_level)
   return result;
 }
 
+string NamedSampleCountStats::json_report() const
+{
+  string result = "{";
+  bool first = true;
+  for (entry_map::const_reference entry : entries) {
+    const NamedSampleCountPair &pair = entry.second;
+    result += string_printf("%s%s: {\"time\": %.3f, \"hits\": %llu}",
+                            first ? "" : ", ",
+                            json_string(pair.name.string()).c_str(),
+                            pair.samples * 0.001,
+                            (unsigned long long)pair.hits);
+    first = false;
+  }
+  result += "}";
+  return result;
+}
+
 /* Mesh statistics. */
 
 MeshStats::MeshStats() = default;
@@ -303,6 +382,23 @@ string RenderStats::full_report()
   return result;
 }
 
+string RenderStats::json_report()
+{
+  string result = "{";
+  result += "\"memory\": {";
+  result += "\"geometry\": " + mesh.geometry.json_report();
+  result += ", \"textures\": " + image.textures.json_report();
+  result += "}";
+  if (has_profiling) {
+    kernel.update_sum();
+    result += ", \"kernel\": " + kernel.json_report();
+    result += ", \"shaders\": " + shaders.json_report();
+    result += ", \"objects\": " + objects.json_report();
+  }
+  result += "}";
+  return result;
+}
+
 NamedTimeStats::NamedTimeStats() : total_time(0.0) {}
 
 string UpdateTimeStats::full_report(const int indent_level)
@@ -50,6 +50,9 @@ class NamedSizeStats {
   /* Generate full human-readable report. */
   string full_report(const int indent_level = 0);
 
+  /* Generate machine-readable report as a JSON object. */
+  string json_report() const;
+
   /* Total size of all entries. */
   size_t total_size;
 
@@ -100,6 +103,9 @@ class NamedNestedSampleStats {
 
   string full_report(const int indent_level = 0, const uint64_t total_samples = 0);
 
+  /* Generate machine-readable report as a JSON object, times are in seconds. */
+  string json_report() const;
+
   string name;
 
   /* self_samples contains only the samples that this specific event got,
@@ -127,6 +133,7 @@ class NamedSampleCountStats {
   NamedSampleCountStats();
 
   string full_report(const int indent_level = 0);
+  string json_report() const;
   void add(const ustring &name, const uint64_t samples, const uint64_t hits);
 
   using entry_map = unordered_map<ustring, NamedSampleCountPair>;
@@ -167,6 +174,9 @@ class RenderStats {
   /* Return full report as string. */
   string full_report();
 
+  /* Return full report as a JSON object, for consumption by external tools. */
+  string json_report();
+
   /* Collect kernel sampling information from Stats. */
   void collect_profiling(Scene *scene, Profiler &prof);
 
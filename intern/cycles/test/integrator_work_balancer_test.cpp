@@ -0,0 +1,50 @@
+/* SPDX-FileCopyrightText: 2025 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "integrator/work_balancer.h"
+
+CCL_NAMESPACE_BEGIN
+
+TEST(work_balance, Initial)
+{
+  vector<WorkBalanceInfo> infos(4);
+  work_balance_do_initial(infos);
+  for (const WorkBalanceInfo &info : infos) {
+    EXPECT_NEAR(info.weight, 0.25, 1e-6);
+  }
+}
+
+TEST(work_balance, RebalanceEqualizesTime)
+{
+  /* The second device is three times faster than the others. */
+  vector<WorkBalanceInfo> infos(3);
+  work_balance_do_initial(infos);
+  infos[0].time_spent = 3.0;
+  infos[1].time_spent = 1.0;
+  infos[2].time_spent = 3.0;
+
+  EXPECT_TRUE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.2, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.6, 1e-6);
+  EXPECT_NEAR(infos[2].weight, 0.2, 1e-6);
+  for (const WorkBalanceInfo &info : infos) {
+    EXPECT_EQ(info.time_spent, 0.0);
+  }
+}
+
+TEST(work_balance, RebalanceSmallDifference)
+{
+  vector<WorkBalanceInfo> infos(2);
+  work_balance_do_initial(infos);
+  infos[0].time_spent = 1.0;
+  infos[1].time_spent = 1.01;
+
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.5, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.5, 1e-6);
+}
+
+CCL_NAMESPACE_END
@@ -160,6 +160,25 @@ void InternalCompleteReconstruction(
   LG << "Max track: " << max_track;
   LG << "Max image: " << max_image;
   LG << "Number of markers: " << tracks.NumMarkers();
+
+  // Group the markers by track and by image once. Looking them up in the
+  // tracks for every track and image scans all markers each time, which gets
+  // very slow for long shots with many tracks.
+  vector<vector<Marker>> markers_for_track(max_track + 1);
+  vector<vector<Marker>> markers_in_image(max_image + 1);
+  {
+    const vector<Marker> markers = tracks.AllMarkers();
+    for (int i = 0; i < markers.size(); ++i) {
+      const Marker& marker = markers[i];
+      if (marker.track >= 0 && marker.track <= max_track) {
+        markers_for_track[marker.track].push_back(marker);
+      }
+      if (marker.image >= 0 && marker.image <= max_image) {
+        markers_in_image[marker.image].push_back(marker);
+      }
+    }
+  }
+
   while (num_resects != 0 || num_intersects != 0) {
     // Do all possible intersections.
     num_intersects = 0;
@@ -168,7 +187,7 @@ void InternalCompleteReconstruction(
         LG << "Skipping point: " << track;
         continue;
       }
-      vector<Marker> all_markers = tracks.MarkersForTrack(track);
+      const vector<Marker>& all_markers = markers_for_track[track];
       LG << "Got " << all_markers.size() << " markers for track " << track;
 
       vector<Marker> reconstructed_markers;
@@ -206,7 +225,7 @@ void InternalCompleteReconstruction(
         LG << "Skipping frame: " << image;
         continue;
       }
-      vector<Marker> all_markers = tracks.MarkersInImage(image);
+      const vector<Marker>& all_markers = markers_in_image[image];
       LG << "Got " << all_markers.size() << " markers for image " << image;
 
       vector<Marker> reconstructed_markers;
@@ -245,7 +264,7 @@ void InternalCompleteReconstruction(
       LG << "Skipping frame: " << image;
       continue;
     }
-    vector<Marker> all_markers = tracks.MarkersInImage(image);
+    const vector<Marker>& all_markers = markers_in_image[image];
 
     vector<Marker> reconstructed_markers;
     for (int i = 0; i < all_markers.size(); ++i) {
@@ -421,6 +421,11 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
     # Split registering up into 3 steps so we can undo
     # if it fails par way through.
 
+    # Report the time spent importing & registering each add-on, useful to find slow start-up.
+    if (use_time := _bpy.app.debug_python):
+        import time
+        t_import = time.time()
+
     # Disable the context: using the context at all
     # while loading an addon is really bad, don't do it!
     with RestrictBlend():
@@ -510,6 +515,9 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
         owner_id_prev = _bl_owner_id_get()
         _bl_owner_id_set(module_name)
 
+        if use_time:
+            t_register = time.time()
+
         # 3) Try run the modules register function.
         try:
             mod.register()
@@ -529,8 +537,11 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
     mod.__addon_enabled__ = True
     mod.__addon_persistent__ = persistent
 
-    if _bpy.app.debug_python:
-        print("\taddon_utils.enable", mod.__name__)
+    if use_time:
+        t_done = time.time()
+        print("\taddon_utils.enable {:s} (import {:.4f}, register {:.4f})".format(
+            mod.__name__, t_register - t_import, t_done - t_register,
+        ))
 
     return mod
 
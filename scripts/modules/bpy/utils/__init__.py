@@ -285,7 +285,11 @@ def load_scripts(*, reload_scripts=False, refresh_scripts=False, extensions=True
             mod = test_reload(mod)
 
         if mod:
+            if use_time:
+                t = time.time()
             _register_module_call(mod)
+            if use_time:
+                print("register {:s} {:.4f}".format(mod.__name__, time.time() - t))
             _registered_module_names.append(mod.__name__)
 
     if reload_scripts:
@@ -306,6 +306,10 @@ def bake_action_iter(
         bbones = {}
         custom_props = {}
         for name, pbone in obj.pose.bones.items():
+            # Only store what is keyed later on, this is collected for every bone on every frame.
+            if bake_options.only_selected and not pbone.bone.select:
+                continue
+
             if bake_options.do_visual_keying:
                 # Get the final transform of the bone in its own local space...
                 matrix[name] = obj.convert_space(pose_bone=pbone, matrix=pbone.matrix,
@@ -314,7 +318,7 @@ def bake_action_iter(
                 matrix[name] = pbone.matrix_basis.copy()
 
             # Bendy Bones
-            if pbone.bone.bbone_segments > 1:
+            if bake_options.do_bbone and pbone.bone.bbone_segments > 1:
                 bbones[name] = {bb_prop: getattr(pbone, bb_prop) for bb_prop in BBONE_PROPS}
 
             # Custom Properties
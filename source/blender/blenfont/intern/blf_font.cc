@@ -296,10 +296,19 @@ static GPUTexture *blf_batch_cache_texture_load()
     int offset_x = bitmap_len_landed % tex_width;
     int offset_y = bitmap_len_landed / tex_width;
 
-    /* TODO(@germano): Update more than one row in a single call. */
+    /* The bitmap is laid out in rows of the texture width, so the rows that are complete can be
+     * uploaded in a single call. Only the partial rows at the start and end are updated apart. */
     while (remain) {
-      int remain_row = tex_width - offset_x;
-      int width = remain > remain_row ? remain_row : remain;
+      int width, height;
+      if (offset_x == 0 && remain >= tex_width) {
+        width = tex_width;
+        height = remain / tex_width;
+      }
+      else {
+        const int remain_row = tex_width - offset_x;
+        width = remain > remain_row ? remain_row : remain;
+        height = 1;
+      }
       GPU_texture_update_sub(gc->texture,
                              GPU_DATA_UBYTE,
                              &gc->bitmap_result[bitmap_len_landed],
@@ -307,13 +316,13 @@ static GPUTexture *blf_batch_cache_texture_load()
                              offset_y,
                              0,
                              width,
-                             1,
+                             height,
                              0);
 
-      bitmap_len_landed += width;
-      remain -= width;
-      offset_x = 0;
-      offset_y += 1;
+      bitmap_len_landed += width * height;
+      remain -= width * height;
+      offset_x = (offset_x + width) % tex_width;
+      offset_y += (offset_x == 0) ? height : 0;
     }
 
     gc->bitmap_len_landed = bitmap_len_landed;
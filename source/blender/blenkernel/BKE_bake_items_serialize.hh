@@ -6,6 +6,7 @@
 
 #include "BLI_fileops.hh"
 #include "BLI_function_ref.hh"
+#include "BLI_mmap.h"
 #include "BLI_serialize.hh"
 
 #include "BKE_bake_items.hh"
@@ -158,15 +159,22 @@ class BlobReadSharing : NonCopyable, NonMovable {
 
 /**
  * A specific #BlobReader that reads from disk.
+ *
+ * Blob files are memory-mapped when they are first accessed, so that slices can be read at random
+ * offsets without seeking and from multiple threads at once. Files that can't be mapped are read
+ * through a file stream instead.
  */
 class DiskBlobReader : public BlobReader {
  private:
   const std::string blobs_dir_;
   mutable std::mutex mutex_;
+  /** Null when mapping the file failed, in which case a stream in #open_input_streams_ is used. */
+  mutable Map<std::string, BLI_mmap_file *> mapped_files_;
   mutable Map<std::string, std::unique_ptr<fstream>> open_input_streams_;
 
  public:
   DiskBlobReader(std::string blobs_dir);
+  ~DiskBlobReader() override;
   [[nodiscard]] bool read(const BlobSlice &slice, void *r_data) const override;
 };
 
@@ -600,6 +600,13 @@ void BKE_fcurve_correct_bezpart(const float v1[2], float v2[2], float v3[2], con
 
 /* evaluate fcurve */
 float evaluate_fcurve(const FCurve *fcu, float evaltime);
+/**
+ * Same as #evaluate_fcurve, but reuses the keyframe segment found by the previous call when
+ * evaluating many times in increasing order, e.g. when sampling the curve for drawing.
+ * `bezt_index_hint` is owned by the caller, should be initialized to zero and is only valid for
+ * one F-Curve. The result is the same as without the hint.
+ */
+float evaluate_fcurve_with_hint(const FCurve *fcu, float evaltime, int *bezt_index_hint);
 float evaluate_fcurve_only_curve(const FCurve *fcu, float evaltime);
 float evaluate_fcurve_driver(PathResolvedRNA *anim_rna,
                              FCurve *fcu,
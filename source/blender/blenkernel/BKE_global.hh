@@ -273,6 +273,7 @@ enum {
 
   G_DEBUG_GHOST = (1 << 24),  /* Debug GHOST module. */
   G_DEBUG_WINTAB = (1 << 25), /* Debug Wintab. */
+  G_DEBUG_IO_LOAD = (1 << 26), /* Blend-file load time profiling. */
 };
 
 #define G_DEBUG_ALL \
@@ -302,6 +303,15 @@ enum {
    */
   G_LIBOVERRIDE_NO_AUTO_RESYNC = 1 << 3,
 
+  /**
+   * When in background mode, reference large arrays of plain data (e.g. mesh attributes)
+   * directly from the memory-mapped blend-file when loading it, instead of copying them.
+   * Typically set by the `--enable-file-data-mmap` command-line argument.
+   *
+   * Only used for uncompressed files with a matching endianness and DNA.
+   */
+  G_BACKGROUND_FILE_DATA_MMAP = 1 << 4,
+
   // G_FILE_DEPRECATED_9 = (1 << 9),
   G_FILE_NO_UI = (1 << 10),
 
@@ -340,8 +350,8 @@ enum {
  * This means we can change the values without worrying about do-versions.
  */
 #define G_FILE_FLAG_ALL_RUNTIME \
-  (G_BACKGROUND_NO_DEPSGRAPH | G_LIBOVERRIDE_NO_AUTO_RESYNC | G_FILE_NO_UI | \
-   G_FILE_RECOVER_READ | G_FILE_RECOVER_WRITE)
+  (G_BACKGROUND_NO_DEPSGRAPH | G_LIBOVERRIDE_NO_AUTO_RESYNC | G_BACKGROUND_FILE_DATA_MMAP | \
+   G_FILE_NO_UI | G_FILE_RECOVER_READ | G_FILE_RECOVER_WRITE)
 
 /** #Global.moving, signals drawing in (3d) window to denote transform */
 enum {
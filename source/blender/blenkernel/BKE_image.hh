@@ -174,6 +174,13 @@ ImBuf *BKE_image_acquire_multilayer_view_ibuf(const RenderData &render_data,
 
 void BKE_image_release_ibuf(Image *ima, ImBuf *ibuf, void *lock);
 
+/**
+ * Load all tiles of a UDIM image that are not cached yet, decoding the tile files in parallel.
+ * Tiles that need special handling (packed, multi-view or multi-layer) are left to be loaded on
+ * demand by #BKE_image_acquire_ibuf.
+ */
+void BKE_image_preload_tiles(Image *ima);
+
 /**
  * Return image buffer of preview for given image
  * r_width & r_height are optional and return the _original size_ of the image.
@@ -103,6 +103,10 @@ void multiresModifier_sync_levels_ex(Object *ob_dst,
                                      const MultiresModifierData *mmd_src,
                                      MultiresModifierData *mmd_dst);
 
+/**
+ * Stitch the grids of the faces in sculpt BVH nodes that were changed since their normals were
+ * last updated, and the grids of their neighbors.
+ */
 void multires_stitch_grids(Object *);
 
 void multiresModifier_scale_disp(Depsgraph *depsgraph, Scene *scene, Object *ob);
@@ -284,6 +284,12 @@ class Tree {
    */
   void tag_positions_changed(const IndexMask &node_mask);
 
+  /**
+   * Leaf nodes tagged with #tag_positions_changed since normals were last updated with
+   * #update_normals.
+   */
+  IndexMask nodes_with_dirty_normals(IndexMaskMemory &memory) const;
+
   /** Tag nodes where face or vertex visibility has changed.  */
   void tag_visibility_changed(const IndexMask &node_mask);
 
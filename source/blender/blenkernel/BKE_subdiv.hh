@@ -20,6 +20,8 @@ class TopologyRefinerImpl;
 
 namespace blender::bke::subdiv {
 
+struct MeshState;
+
 enum VtxBoundaryInterpolation {
   /* Do not interpolate boundaries. */
   SUBDIV_VTX_BOUNDARY_NONE,
@@ -167,6 +169,9 @@ struct Subdiv {
   Displacement *displacement_evaluator;
   /* Statistics for debugging. */
   SubdivStats stats;
+  /* Remembered topology of the mesh the topology refiner was last used for. Allows to skip the
+   * comparison against a new converter when the mesh topology is still shared. */
+  MeshState *mesh_state;
 
   /* Cached values, are not supposed to be accessed directly. */
   struct {
@@ -26,9 +26,16 @@ struct DenseFloatVolumeGrid {
   float *voxels;
 };
 
+/**
+ * Extract the active voxels of the grid into a dense array.
+ *
+ * \param max_resolution: When not zero, fail before extracting voxels if the resolution along any
+ * axis would be larger, e.g. because it can't be uploaded as texture.
+ */
 bool BKE_volume_grid_dense_floats(const Volume *volume,
                                   const blender::bke::VolumeGridData *volume_grid,
-                                  DenseFloatVolumeGrid *r_dense_grid);
+                                  DenseFloatVolumeGrid *r_dense_grid,
+                                  int max_resolution = 0);
 void BKE_volume_dense_float_grid_clear(DenseFloatVolumeGrid *dense_grid);
 
 /* Wireframe */
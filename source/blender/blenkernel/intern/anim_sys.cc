@@ -24,7 +24,9 @@
 #include "BLI_string.h"
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -557,6 +559,40 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
   }
 }
 
+/**
+ * Resolve RNA paths of F-Curves, reusing the previous result when consecutive F-Curves animate
+ * different array elements of the same property (e.g. `location[0]` to `location[2]`). This avoids
+ * parsing and looking up the same path several times in a row.
+ */
+class AnimsysPathResolver {
+  PointerRNA *ptr_;
+  const char *last_rna_path_ = nullptr;
+  PathResolvedRNA last_result_ = {};
+  int last_array_len_ = 0;
+
+ public:
+  explicit AnimsysPathResolver(PointerRNA *ptr) : ptr_(ptr) {}
+
+  bool resolve(const char *rna_path, const int array_index, PathResolvedRNA *r_result)
+  {
+    if (last_rna_path_ && rna_path && STREQ(last_rna_path_, rna_path) &&
+        (last_array_len_ == 0 || array_index < last_array_len_))
+    {
+      *r_result = last_result_;
+      r_result->prop_index = last_array_len_ ? array_index : -1;
+      return true;
+    }
+    last_rna_path_ = nullptr;
+    if (!BKE_animsys_rna_path_resolve(ptr_, rna_path, array_index, r_result)) {
+      return false;
+    }
+    last_rna_path_ = rna_path;
+    last_result_ = *r_result;
+    last_array_len_ = RNA_property_array_length(&r_result->ptr, r_result->prop);
+    return true;
+  }
+};
+
 /**
  * Evaluate all the F-Curves in the given list
  * This performs a set of standard checks. If extra checks are required,
@@ -567,6 +603,8 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      bool flush_to_original)
 {
+  AnimsysPathResolver path_resolver(ptr);
+
   /* Calculate then execute each curve. */
   for (FCurve *fcu : fcurves) {
 
@@ -575,7 +613,7 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+    if (path_resolver.resolve(fcu->rna_path, fcu->array_index, &anim_rna)) {
       const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
       BKE_animsys_write_to_rna_path(&anim_rna, curval);
       if (flush_to_original) {
@@ -3627,6 +3665,12 @@ void nlasnapshot_ensure_channels(NlaEvalData *eval_data, NlaEvalSnapshot *snapsh
   }
 }
 
+/**
+ * Number of channels from which snapshots are blended in parallel. Blending a single channel is
+ * cheap, so this is only worth it for rigs with many animated properties.
+ */
+#define NLA_BLEND_PARALLEL_THRESHOLD 1024
+
 void nlasnapshot_blend(NlaEvalData *eval_data,
                        NlaEvalSnapshot *lower_snapshot,
                        NlaEvalSnapshot *upper_snapshot,
@@ -3636,11 +3680,11 @@ void nlasnapshot_blend(NlaEvalData *eval_data,
 {
   nlaeval_snapshot_ensure_size(r_blended_snapshot, eval_data->num_channels);
 
-  LISTBASE_FOREACH (NlaEvalChannel *, nec, &eval_data->channels) {
+  auto blend_channel = [&](NlaEvalChannel *nec) {
     NlaEvalChannelSnapshot *upper_necs = nlaeval_snapshot_get(upper_snapshot, nec->index);
     NlaEvalChannelSnapshot *lower_necs = nlaeval_snapshot_get(lower_snapshot, nec->index);
     if (upper_necs == nullptr && lower_necs == nullptr) {
-      continue;
+      return;
     }
 
     /** Blend with lower_snapshot's base or default. */
@@ -3651,7 +3695,27 @@ void nlasnapshot_blend(NlaEvalData *eval_data,
     NlaEvalChannelSnapshot *result_necs = nlaeval_snapshot_ensure_channel(r_blended_snapshot, nec);
     nlaevalchan_blendOrcombine(
         lower_necs, upper_necs, upper_blendmode, upper_influence, result_necs);
+  };
+
+  if (eval_data->num_channels < NLA_BLEND_PARALLEL_THRESHOLD) {
+    LISTBASE_FOREACH (NlaEvalChannel *, nec, &eval_data->channels) {
+      blend_channel(nec);
+    }
+    return;
   }
+
+  /* Each channel only reads the lower and upper snapshots and writes its own slot in the result
+   * (which was already resized above), so channels can be blended independently. */
+  Vector<NlaEvalChannel *> channels;
+  channels.reserve(eval_data->num_channels);
+  LISTBASE_FOREACH (NlaEvalChannel *, nec, &eval_data->channels) {
+    channels.append(nec);
+  }
+  threading::parallel_for(channels.index_range(), 256, [&](const IndexRange range) {
+    for (const int i : range) {
+      blend_channel(channels[i]);
+    }
+  });
 }
 
 void nlasnapshot_blend_get_inverted_upper_snapshot(NlaEvalData *eval_data,
@@ -26,7 +26,9 @@
 #include "BLI_math_vector.h"
 #include "BLI_span.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 #include "BLT_translation.hh"
 
 #include "DNA_defaults.h"
@@ -3009,6 +3011,53 @@ void BKE_pose_where_is_bone(Depsgraph *depsgraph,
   BKE_pose_where_is_bone_tail(pchan);
 }
 
+/**
+ * Number of pose channels from which the bones of poses without constraints are evaluated in
+ * parallel.
+ */
+#define POSE_WHERE_IS_PARALLEL_THRESHOLD 256
+
+static bool pose_has_constraints(const bPose *pose)
+{
+  LISTBASE_FOREACH (const bPoseChannel *, pchan, &pose->chanbase) {
+    if (pchan->constraints.first) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Evaluate a pose without constraints (and therefore without IK) level by level in the bone
+ * hierarchy. Without constraints every bone only depends on its parent, so all bones at the same
+ * depth are independent and evaluated in parallel.
+ */
+static void pose_where_is_unconstrained_parallel(Depsgraph *depsgraph,
+                                                 Scene *scene,
+                                                 Object *ob,
+                                                 const float ctime)
+{
+  Vector<Vector<bPoseChannel *>> channels_by_depth;
+  LISTBASE_FOREACH (bPoseChannel *, pchan, &ob->pose->chanbase) {
+    int depth = 0;
+    for (const bPoseChannel *parent = pchan->parent; parent; parent = parent->parent) {
+      depth++;
+    }
+    if (depth >= channels_by_depth.size()) {
+      channels_by_depth.resize(depth + 1);
+    }
+    channels_by_depth[depth].append(pchan);
+  }
+
+  for (const Span<bPoseChannel *> channels : channels_by_depth) {
+    threading::parallel_for(channels.index_range(), 64, [&](const IndexRange range) {
+      for (bPoseChannel *pchan : channels.slice(range)) {
+        BKE_pose_where_is_bone(depsgraph, scene, ob, pchan, ctime, true);
+      }
+    });
+  }
+}
+
 void BKE_pose_where_is(Depsgraph *depsgraph, Scene *scene, Object *ob)
 {
   bArmature *arm;
@@ -3049,32 +3098,41 @@ void BKE_pose_where_is(Depsgraph *depsgraph, Scene *scene, Object *ob)
       pchan->flag &= ~(POSE_DONE | POSE_CHAIN | POSE_IKTREE | POSE_IKSPLINE);
     }
 
-    /* 2a. construct the IK tree (standard IK) */
-    BIK_init_tree(depsgraph, scene, ob, ctime);
+    if (BLI_listbase_count_at_most(&ob->pose->chanbase, POSE_WHERE_IS_PARALLEL_THRESHOLD) ==
+            POSE_WHERE_IS_PARALLEL_THRESHOLD &&
+        !pose_has_constraints(ob->pose))
+    {
+      pose_where_is_unconstrained_parallel(depsgraph, scene, ob, ctime);
+    }
+    else {
 
-    /* 2b. construct the Spline IK trees
-     * - this is not integrated as an IK plugin, since it should be able
-     *   to function in conjunction with standard IK
-     */
-    BKE_pose_splineik_init_tree(scene, ob, ctime);
+      /* 2a. construct the IK tree (standard IK) */
+      BIK_init_tree(depsgraph, scene, ob, ctime);
 
-    /* 3. the main loop, channels are already hierarchical sorted from root to children */
-    LISTBASE_FOREACH (bPoseChannel *, pchan, &ob->pose->chanbase) {
-      /* 4a. if we find an IK root, we handle it separated */
-      if (pchan->flag & POSE_IKTREE) {
-        BIK_execute_tree(depsgraph, scene, ob, pchan, ctime);
-      }
-      /* 4b. if we find a Spline IK root, we handle it separated too */
-      else if (pchan->flag & POSE_IKSPLINE) {
-        BKE_splineik_execute_tree(depsgraph, scene, ob, pchan, ctime);
-      }
-      /* 5. otherwise just call the normal solver */
-      else if (!(pchan->flag & POSE_DONE)) {
-        BKE_pose_where_is_bone(depsgraph, scene, ob, pchan, ctime, true);
+      /* 2b. construct the Spline IK trees
+       * - this is not integrated as an IK plugin, since it should be able
+       *   to function in conjunction with standard IK
+       */
+      BKE_pose_splineik_init_tree(scene, ob, ctime);
+
+      /* 3. the main loop, channels are already hierarchical sorted from root to children */
+      LISTBASE_FOREACH (bPoseChannel *, pchan, &ob->pose->chanbase) {
+        /* 4a. if we find an IK root, we handle it separated */
+        if (pchan->flag & POSE_IKTREE) {
+          BIK_execute_tree(depsgraph, scene, ob, pchan, ctime);
+        }
+        /* 4b. if we find a Spline IK root, we handle it separated too */
+        else if (pchan->flag & POSE_IKSPLINE) {
+          BKE_splineik_execute_tree(depsgraph, scene, ob, pchan, ctime);
+        }
+        /* 5. otherwise just call the normal solver */
+        else if (!(pchan->flag & POSE_DONE)) {
+          BKE_pose_where_is_bone(depsgraph, scene, ob, pchan, ctime, true);
+        }
       }
+      /* 6. release the IK tree */
+      BIK_release_tree(scene, ob, ctime);
     }
-    /* 6. release the IK tree */
-    BIK_release_tree(scene, ob, ctime);
   }
 
   /* calculating deform matrices */
@@ -21,6 +21,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 
 #include "DNA_armature_types.h"
 #include "DNA_lattice_types.h"
@@ -429,11 +430,8 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
   }
 }
 
-static void armature_vert_task(void *__restrict userdata,
-                               const int i,
-                               const TaskParallelTLS *__restrict /*tls*/)
+static void armature_vert_task(const ArmatureUserdata *data, const int i)
 {
-  const ArmatureUserdata *data = static_cast<const ArmatureUserdata *>(userdata);
   const MDeformVert *dvert;
   if (data->use_dverts || data->armature_def_nr != -1) {
     if (data->me_target) {
@@ -594,10 +592,14 @@ static void armature_deform_coords_impl(const Object *ob_arm,
     }
   }
   else {
-    TaskParallelSettings settings;
-    BLI_parallel_range_settings_defaults(&settings);
-    settings.min_iter_per_thread = 32;
-    BLI_task_parallel_range(0, vert_coords_len, &data, armature_vert_task, &settings);
+    /* Use a larger grain size than the generic task range to reduce the scheduling overhead,
+     * since many armature modifiers are often evaluated in parallel on different objects. */
+    blender::threading::parallel_for(
+        blender::IndexRange(vert_coords_len), 512, [&](const blender::IndexRange range) {
+          for (const int i : range) {
+            armature_vert_task(&data, i);
+          }
+        });
   }
 
   if (pchan_from_defbase) {
@@ -27,10 +27,17 @@
 #include "RNA_access.hh"
 #include "RNA_enum_types.hh"
 
+#include <fcntl.h>
 #include <fmt/format.h>
 #include <sstream>
 #include <xxhash.h>
 
+#ifdef _WIN32
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
 #ifdef WITH_OPENVDB
 #  include <openvdb/io/Stream.h>
 #  include <openvdb/openvdb.h>
@@ -90,6 +97,27 @@ bool BlobReader::read_as_stream(const BlobSlice &slice, FunctionRef<bool(std::is
 
 DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blobs_dir)) {}
 
+DiskBlobReader::~DiskBlobReader()
+{
+  for (BLI_mmap_file *mmap_file : mapped_files_.values()) {
+    if (mmap_file) {
+      BLI_mmap_free(mmap_file);
+    }
+  }
+}
+
+static BLI_mmap_file *try_map_blob_file(const char *blob_path)
+{
+  const int file = BLI_open(blob_path, O_BINARY | O_RDONLY, 0);
+  if (file == -1) {
+    return nullptr;
+  }
+  BLI_mmap_file *mmap_file = BLI_mmap_open(file);
+  /* The mapping stays valid after the file descriptor is closed. */
+  close(file);
+  return mmap_file;
+}
+
 [[nodiscard]] bool DiskBlobReader::read(const BlobSlice &slice, void *r_data) const
 {
   if (slice.range.is_empty()) {
@@ -99,6 +127,17 @@ DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blo
   char blob_path[FILE_MAX];
   BLI_path_join(blob_path, sizeof(blob_path), blobs_dir_.c_str(), slice.name.c_str());
 
+  BLI_mmap_file *mmap_file;
+  {
+    std::lock_guard lock{mutex_};
+    mmap_file = mapped_files_.lookup_or_add_cb_as(blob_path,
+                                                  [&]() { return try_map_blob_file(blob_path); });
+  }
+  if (mmap_file) {
+    /* Reading from the mapping does not modify any shared state, so no lock is necessary. */
+    return BLI_mmap_read(mmap_file, r_data, slice.range.start(), slice.range.size());
+  }
+
   std::lock_guard lock{mutex_};
   std::unique_ptr<fstream> &blob_file = open_input_streams_.lookup_or_add_cb_as(blob_path, [&]() {
     return std::make_unique<fstream>(blob_path, std::ios::in | std::ios::binary);
@@ -441,8 +441,17 @@ static std::unique_ptr<BVHTree, BVHTreeDeleter> create_tree_from_verts(
   if (!tree) {
     return nullptr;
   }
-  verts_mask.foreach_index(
-      [&](const int i) { BLI_bvhtree_insert(tree.get(), i, positions[i], 1); });
+  if (verts_mask.size() == positions.size()) {
+    BLI_bvhtree_insert_parallel(
+        tree.get(), positions.size(), 1, [&](const int i, MutableSpan<float3> r_co) {
+          r_co[0] = positions[i];
+          return 1;
+        });
+  }
+  else {
+    verts_mask.foreach_index(
+        [&](const int i) { BLI_bvhtree_insert(tree.get(), i, positions[i], 1); });
+  }
   BLI_bvhtree_balance(tree.get());
   return tree;
 }
@@ -509,13 +518,13 @@ static std::unique_ptr<BVHTree, BVHTreeDeleter> create_tree_from_tris(const Span
   if (!tree) {
     return {};
   }
-  for (const int tri : corner_tris.index_range()) {
-    float co[3][3];
-    copy_v3_v3(co[0], positions[corner_verts[corner_tris[tri][0]]]);
-    copy_v3_v3(co[1], positions[corner_verts[corner_tris[tri][1]]]);
-    copy_v3_v3(co[2], positions[corner_verts[corner_tris[tri][2]]]);
-    BLI_bvhtree_insert(tree.get(), tri, co[0], 3);
-  }
+  BLI_bvhtree_insert_parallel(
+      tree.get(), corner_tris.size(), 3, [&](const int tri, MutableSpan<float3> r_co) {
+        r_co[0] = positions[corner_verts[corner_tris[tri][0]]];
+        r_co[1] = positions[corner_verts[corner_tris[tri][1]]];
+        r_co[2] = positions[corner_verts[corner_tris[tri][2]]];
+        return 3;
+      });
   BLI_bvhtree_balance(tree.get());
   return tree;
 }
@@ -7,6 +7,7 @@
  */
 
 #include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_attribute_math.hh"
 #include "BKE_curves.hh"
@@ -47,15 +48,42 @@ static void evaluate_segment(const T &a, const T &b, const T &c, const T &d, Mut
   }
 }
 
+/**
+ * A version of #evaluate_segment that uses basis weights calculated in advance for every evaluated
+ * point of the segment, used when all segments have the same resolution.
+ */
+template<typename T>
+static void evaluate_segment_with_basis(const T &a,
+                                        const T &b,
+                                        const T &c,
+                                        const T &d,
+                                        const Span<float4> weights,
+                                        MutableSpan<T> dst)
+{
+  BLI_assert(weights.size() == dst.size());
+  dst.first() = b;
+  for (const int i : dst.index_range().drop_front(1)) {
+    if constexpr (is_same_any_v<T, float, float2, float3>) {
+      /* Save multiplications by adjusting weights after mix, like #interpolate. */
+      dst[i] = 0.5f * attribute_math::mix4<T>(weights[i], a, b, c, d);
+    }
+    else {
+      dst[i] = attribute_math::mix4<T>(weights[i] * 0.5f, a, b, c, d);
+    }
+  }
+}
+
 /**
  * \param range_fn: Returns an index range describing where in the #dst span each segment should be
  * evaluated to, and how many points to add to it. This is used to avoid the need to allocate an
  * actual offsets array in typical evaluation use cases where the resolution is per-curve.
+ * \param segment_fn: Evaluates a single segment from its four control point values.
  */
-template<typename T, typename RangeForSegmentFn>
+template<typename T, typename RangeForSegmentFn, typename EvaluateSegmentFn>
 static void interpolate_to_evaluated(const Span<T> src,
                                      const bool cyclic,
                                      const RangeForSegmentFn &range_fn,
+                                     const EvaluateSegmentFn &segment_fn,
                                      MutableSpan<T> dst)
 
 {
@@ -72,10 +100,10 @@ static void interpolate_to_evaluated(const Span<T> src,
   const IndexRange first = range_fn(0);
 
   if (src.size() == 2) {
-    evaluate_segment(src.first(), src.first(), src.last(), src.last(), dst.slice(first));
+    segment_fn(src.first(), src.first(), src.last(), src.last(), dst.slice(first));
     if (cyclic) {
       const IndexRange last = range_fn(1);
-      evaluate_segment(src.last(), src.last(), src.first(), src.first(), dst.slice(last));
+      segment_fn(src.last(), src.last(), src.first(), src.first(), dst.slice(last));
     }
     else {
       dst.last() = src.last();
@@ -86,13 +114,13 @@ static void interpolate_to_evaluated(const Span<T> src,
   const IndexRange second_to_last = range_fn(src.index_range().last(1));
   const IndexRange last = range_fn(src.index_range().last());
   if (cyclic) {
-    evaluate_segment(src.last(), src[0], src[1], src[2], dst.slice(first));
-    evaluate_segment(src.last(2), src.last(1), src.last(), src.first(), dst.slice(second_to_last));
-    evaluate_segment(src.last(1), src.last(), src[0], src[1], dst.slice(last));
+    segment_fn(src.last(), src[0], src[1], src[2], dst.slice(first));
+    segment_fn(src.last(2), src.last(1), src.last(), src.first(), dst.slice(second_to_last));
+    segment_fn(src.last(1), src.last(), src[0], src[1], dst.slice(last));
   }
   else {
-    evaluate_segment(src[0], src[0], src[1], src[2], dst.slice(first));
-    evaluate_segment(src.last(2), src.last(1), src.last(), src.last(), dst.slice(second_to_last));
+    segment_fn(src[0], src[0], src[1], src[2], dst.slice(first));
+    segment_fn(src.last(2), src.last(1), src.last(), src.last(), dst.slice(second_to_last));
     /* For non-cyclic curves, the last segment should always just have a single point. We could
      * assert that the size of the provided range is 1 here, but that would require specializing
      * the #range_fn implementation for the last point, which may have a performance cost. */
@@ -104,7 +132,7 @@ static void interpolate_to_evaluated(const Span<T> src,
   threading::parallel_for(inner_range, 512, [&](IndexRange range) {
     for (const int i : range) {
       const IndexRange segment = range_fn(i);
-      evaluate_segment(src[i - 1], src[i], src[i + 1], src[i + 2], dst.slice(segment));
+      segment_fn(src[i - 1], src[i], src[i + 1], src[i + 2], dst.slice(segment));
     }
   });
 }
@@ -117,12 +145,22 @@ static void interpolate_to_evaluated(const Span<T> src,
 
 {
   BLI_assert(dst.size() == calculate_evaluated_num(src.size(), cyclic, resolution));
+  /* Every segment has the same number of evaluated points, so the basis weights only have to be
+   * calculated once instead of for every evaluated point. */
+  const float step = 1.0f / resolution;
+  Vector<float4, 32> weights(resolution);
+  for (const int i : weights.index_range()) {
+    weights[i] = calculate_basis(i * step);
+  }
   interpolate_to_evaluated(
       src,
       cyclic,
       [resolution](const int segment_i) -> IndexRange {
         return {segment_i * resolution, resolution};
       },
+      [&](const T &a, const T &b, const T &c, const T &d, MutableSpan<T> segment) {
+        evaluate_segment_with_basis(a, b, c, d, weights.as_span(), segment);
+      },
       dst);
 }
 
@@ -139,6 +177,9 @@ static void interpolate_to_evaluated(const Span<T> src,
       [evaluated_offsets](const int segment_i) -> IndexRange {
         return evaluated_offsets[segment_i];
       },
+      [](const T &a, const T &b, const T &c, const T &d, MutableSpan<T> segment) {
+        evaluate_segment(a, b, c, d, segment);
+      },
       dst);
 }
 
@@ -35,6 +35,7 @@
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #ifndef NDEBUG
@@ -206,34 +207,37 @@ struct LayerTypeInfo {
 
 static void layerCopy_mdeformvert(const void *source, void *dest, const int count)
 {
-  int i, size = sizeof(MDeformVert);
-
-  memcpy(dest, source, count * size);
-
-  for (i = 0; i < count; i++) {
-    MDeformVert *dvert = static_cast<MDeformVert *>(POINTER_OFFSET(dest, i * size));
-
-    if (dvert->totweight) {
-      MDeformWeight *dw = MEM_malloc_arrayN<MDeformWeight>(size_t(dvert->totweight), __func__);
-
-      memcpy(dw, dvert->dw, dvert->totweight * sizeof(*dw));
-      dvert->dw = dw;
-    }
-    else {
-      dvert->dw = nullptr;
+  memcpy(dest, source, count * sizeof(MDeformVert));
+
+  /* Every vertex owns its own weight array, so copying a large deform layer is dominated by the
+   * per-vertex allocations. These are independent of each other and can be done in parallel. */
+  MutableSpan<MDeformVert> dverts(static_cast<MDeformVert *>(dest), count);
+  blender::threading::parallel_for(dverts.index_range(), 4096, [&](const IndexRange range) {
+    for (MDeformVert &dvert : dverts.slice(range)) {
+      if (dvert.totweight) {
+        MDeformWeight *dw = MEM_malloc_arrayN<MDeformWeight>(size_t(dvert.totweight), __func__);
+        memcpy(dw, dvert.dw, dvert.totweight * sizeof(*dw));
+        dvert.dw = dw;
+      }
+      else {
+        dvert.dw = nullptr;
+      }
     }
-  }
+  });
 }
 
 static void layerFree_mdeformvert(void *data, const int count)
 {
-  for (MDeformVert &dvert : MutableSpan(static_cast<MDeformVert *>(data), count)) {
-    if (dvert.dw) {
-      MEM_freeN(dvert.dw);
-      dvert.dw = nullptr;
-      dvert.totweight = 0;
+  MutableSpan<MDeformVert> dverts(static_cast<MDeformVert *>(data), count);
+  blender::threading::parallel_for(dverts.index_range(), 4096, [&](const IndexRange range) {
+    for (MDeformVert &dvert : dverts.slice(range)) {
+      if (dvert.dw) {
+        MEM_freeN(dvert.dw);
+        dvert.dw = nullptr;
+        dvert.totweight = 0;
+      }
     }
-  }
+  });
 }
 
 static void layerInterp_mdeformvert(const void **sources,
@@ -3481,6 +3485,51 @@ void CustomData_free_elem(CustomData *data, const int index, const int count)
 
 #define SOURCE_BUF_SIZE 100
 
+/**
+ * Interpolate values of simple types directly from the source layer. This avoids building the
+ * array of source pointers and the indirect call to #LayerTypeInfo::interp, and lets the compiler
+ * optimize the loop for the type. The result is the same as with the generic callbacks.
+ */
+template<typename T>
+static void interp_layer_typed(const void *src_data,
+                               const int *src_indices,
+                               const float *weights,
+                               const int count,
+                               void *dst)
+{
+  const T *src = static_cast<const T *>(src_data);
+  T result(0);
+  for (int i = 0; i < count; i++) {
+    result += src[src_indices[i]] * weights[i];
+  }
+  *static_cast<T *>(dst) = result;
+}
+
+static bool interp_layer_fast(const eCustomDataType type,
+                              const void *src_data,
+                              const int *src_indices,
+                              const float *weights,
+                              const int count,
+                              void *dst)
+{
+  switch (type) {
+    case CD_PROP_FLOAT:
+      interp_layer_typed<float>(src_data, src_indices, weights, count, dst);
+      return true;
+    case CD_PROP_FLOAT2:
+      interp_layer_typed<float2>(src_data, src_indices, weights, count, dst);
+      return true;
+    case CD_PROP_FLOAT3:
+      interp_layer_typed<blender::float3>(src_data, src_indices, weights, count, dst);
+      return true;
+    case CD_PROP_COLOR:
+      interp_layer_typed<blender::float4>(src_data, src_indices, weights, count, dst);
+      return true;
+    default:
+      return false;
+  }
+}
+
 void CustomData_interp(const CustomData *source,
                        CustomData *dest,
                        const int *src_indices,
@@ -3535,18 +3584,22 @@ void CustomData_interp(const CustomData *source,
     /* if we found a matching layer, copy the data */
     if (dest->layers[dest_i].type == source->layers[src_i].type) {
       void *src_data = source->layers[src_i].data;
+      void *dst = POINTER_OFFSET(dest->layers[dest_i].data, size_t(dest_index) * typeInfo->size);
+
+      if (!interp_layer_fast(eCustomDataType(source->layers[src_i].type),
+                             src_data,
+                             src_indices,
+                             weights,
+                             count,
+                             dst))
+      {
+        for (int j = 0; j < count; j++) {
+          sources[j] = POINTER_OFFSET(src_data, size_t(src_indices[j]) * typeInfo->size);
+        }
 
-      for (int j = 0; j < count; j++) {
-        sources[j] = POINTER_OFFSET(src_data, size_t(src_indices[j]) * typeInfo->size);
+        typeInfo->interp(sources, weights, sub_weights, count, dst);
       }
 
-      typeInfo->interp(
-          sources,
-          weights,
-          sub_weights,
-          count,
-          POINTER_OFFSET(dest->layers[dest_i].data, size_t(dest_index) * typeInfo->size));
-
       /* if there are multiple source & dest layers of the same type,
        * we don't want to copy all source layers to the same dest, so
        * increment dest_i
@@ -5373,15 +5426,23 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, const int
     layer->sharing_info = nullptr;
 
     if (CustomData_verify_versions(data, i)) {
-      layer->sharing_info = BLO_read_shared(
-          reader, &layer->data, [&]() -> const ImplicitSharingInfo * {
-            blend_read_layer_data(reader, *layer, count);
-            if (layer->data == nullptr) {
-              return nullptr;
-            }
-            return make_implicit_sharing_info_for_layer(
-                eCustomDataType(layer->type), layer->data, count);
-          });
+      const eCustomDataType type = eCustomDataType(layer->type);
+      const auto read_fn = [&]() -> const ImplicitSharingInfo * {
+        blend_read_layer_data(reader, *layer, count);
+        if (layer->data == nullptr) {
+          return nullptr;
+        }
+        return make_implicit_sharing_info_for_layer(type, layer->data, count);
+      };
+      /* Layers which don't own any other memory are plain arrays, they may be shared directly
+       * with the read blend-file. */
+      if (layerType_getInfo(type)->free == nullptr) {
+        layer->sharing_info = BLO_read_shared_plain_data(
+            reader, &layer->data, int64_t(CustomData_sizeof(type)) * count, read_fn);
+      }
+      else {
+        layer->sharing_info = BLO_read_shared(reader, &layer->data, read_fn);
+      }
       i++;
     }
   }
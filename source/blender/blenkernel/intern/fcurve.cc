@@ -2006,9 +2006,59 @@ static float fcurve_eval_keyframes_extrapolate(const FCurve *fcu,
   return endpoint_bezt->vec[1][1] - (fac * dx);
 }
 
+/**
+ * Find the keyframe that the evaluation time occurs before (or on, when `r_exact` is set).
+ *
+ * When `bezt_index_hint` is given, the segment ending at the hinted keyframe and the one after
+ * it are checked first. The hint is only used when the evaluation time lies strictly inside the
+ * segment and is not within the threshold of either keyframe, in which case the binary search
+ * would have found the same keyframe. The hint is updated with the result.
+ */
+static int fcurve_eval_bezt_index_find(const FCurve *fcu,
+                                       const BezTriple *bezts,
+                                       const float evaltime,
+                                       int *bezt_index_hint,
+                                       bool *r_exact)
+{
+  /* The threshold here has the following constraints:
+   * - 0.001 is too coarse:
+   *   We get artifacts with 2cm driver movements at 1BU = 1m (see #40332).
+   *
+   * - 0.00001 is too fine:
+   *   Weird errors, like selecting the wrong keyframe range (see #39207), occur.
+   *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
+   */
+  const float threshold = 0.0001f;
+
+  if (bezt_index_hint != nullptr) {
+    /* Consecutive samples usually fall in the same or the next segment. */
+    for (int index = *bezt_index_hint; index <= *bezt_index_hint + 1; index++) {
+      if (index <= 0 || index >= fcu->totvert) {
+        continue;
+      }
+      if (evaltime - bezts[index - 1].vec[1][0] > threshold &&
+          bezts[index].vec[1][0] - evaltime > threshold)
+      {
+        *bezt_index_hint = index;
+        *r_exact = false;
+        return index;
+      }
+    }
+  }
+
+  /* Use binary search to find appropriate keyframes. */
+  const int index = BKE_fcurve_bezt_binarysearch_index_ex(
+      bezts, evaltime, fcu->totvert, threshold, r_exact);
+  if (bezt_index_hint != nullptr) {
+    *bezt_index_hint = index;
+  }
+  return index;
+}
+
 static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
                                                const BezTriple *bezts,
-                                               float evaltime)
+                                               float evaltime,
+                                               int *bezt_index_hint)
 {
   const float eps = 1.e-8f;
   uint a;
@@ -2016,17 +2066,7 @@ static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
   /* Evaluation-time occurs somewhere in the middle of the curve. */
   bool exact = false;
 
-  /* Use binary search to find appropriate keyframes...
-   *
-   * The threshold here has the following constraints:
-   * - 0.001 is too coarse:
-   *   We get artifacts with 2cm driver movements at 1BU = 1m (see #40332).
-   *
-   * - 0.00001 is too fine:
-   *   Weird errors, like selecting the wrong keyframe range (see #39207), occur.
-   *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
-   */
-  a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, 0.0001, &exact);
+  a = fcurve_eval_bezt_index_find(fcu, bezts, evaltime, bezt_index_hint, &exact);
   const BezTriple *bezt = bezts + a;
 
   if (exact) {
@@ -2270,7 +2310,10 @@ static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
 }
 
 /* Calculate F-Curve value for 'evaltime' using #BezTriple keyframes. */
-static float fcurve_eval_keyframes(const FCurve *fcu, const BezTriple *bezts, float evaltime)
+static float fcurve_eval_keyframes(const FCurve *fcu,
+                                   const BezTriple *bezts,
+                                   float evaltime,
+                                   int *bezt_index_hint)
 {
   if (evaltime <= bezts->vec[1][0]) {
     return fcurve_eval_keyframes_extrapolate(fcu, bezts, evaltime, 0, +1);
@@ -2281,7 +2324,7 @@ static float fcurve_eval_keyframes(const FCurve *fcu, const BezTriple *bezts, fl
     return fcurve_eval_keyframes_extrapolate(fcu, bezts, evaltime, fcu->totvert - 1, -1);
   }
 
-  return fcurve_eval_keyframes_interpolate(fcu, bezts, evaltime);
+  return fcurve_eval_keyframes_interpolate(fcu, bezts, evaltime, bezt_index_hint);
 }
 
 /* Calculate F-Curve value for 'evaltime' using #FPoint samples. */
@@ -2329,7 +2372,10 @@ static float fcurve_eval_samples(const FCurve *fcu, const FPoint *fpts, float ev
 /* Evaluate and return the value of the given F-Curve at the specified frame ("evaltime")
  * NOTE: this is also used for drivers.
  */
-static float evaluate_fcurve_ex(const FCurve *fcu, float evaltime, float cvalue)
+static float evaluate_fcurve_ex(const FCurve *fcu,
+                                float evaltime,
+                                float cvalue,
+                                int *bezt_index_hint = nullptr)
 {
   /* Evaluate modifiers which modify time to evaluate the base curve at. */
   FModifiersStackStorage storage;
@@ -2345,7 +2391,7 @@ static float evaluate_fcurve_ex(const FCurve *fcu, float evaltime, float cvalue)
    *   F-Curve modifier on the stack requested the curve to be evaluated at.
    */
   if (fcu->bezt) {
-    cvalue = fcurve_eval_keyframes(fcu, fcu->bezt, devaltime);
+    cvalue = fcurve_eval_keyframes(fcu, fcu->bezt, devaltime, bezt_index_hint);
   }
   else if (fcu->fpt) {
     cvalue = fcurve_eval_samples(fcu, fcu->fpt, devaltime);
@@ -2371,6 +2417,13 @@ float evaluate_fcurve(const FCurve *fcu, float evaltime)
   return evaluate_fcurve_ex(fcu, evaltime, 0.0);
 }
 
+float evaluate_fcurve_with_hint(const FCurve *fcu, float evaltime, int *bezt_index_hint)
+{
+  BLI_assert(fcu->driver == nullptr);
+
+  return evaluate_fcurve_ex(fcu, evaltime, 0.0, bezt_index_hint);
+}
+
 float evaluate_fcurve_only_curve(const FCurve *fcu, float evaltime)
 {
   /* Can be used to evaluate the (key-framed) f-curve only.
@@ -88,9 +88,15 @@ struct DriverVarTypeInfo {
  * \{ */
 
 static DriverTargetContext driver_target_context_from_animation_context(
-    const AnimationEvalContext *anim_eval_context)
+    const AnimationEvalContext *anim_eval_context, const DriverVar *dvar)
 {
-  DriverTargetContext driver_target_context;
+  DriverTargetContext driver_target_context = {nullptr, nullptr};
+
+  /* The context is only used by context property variables. Avoid the view layer lookup for all
+   * other variables, as it is done for every evaluated driver target. */
+  if (dvar->type != DVAR_TYPE_CONTEXT_PROP) {
+    return driver_target_context;
+  }
 
   driver_target_context.scene = DEG_get_evaluated_scene(anim_eval_context->depsgraph);
   driver_target_context.view_layer = DEG_get_evaluated_view_layer(anim_eval_context->depsgraph);
@@ -179,7 +185,7 @@ static float dtar_get_prop_val(const AnimationEvalContext *anim_eval_context,
    * Naming is a bit confusing, but this is what is exposed as "Prop" or "Context Property" in
    * interface. */
   const DriverTargetContext driver_target_context = driver_target_context_from_animation_context(
-      anim_eval_context);
+      anim_eval_context, dvar);
   PointerRNA property_ptr;
   if (!driver_get_target_property(&driver_target_context, dvar, dtar, &property_ptr)) {
     if (G.debug & G_DEBUG) {
@@ -299,7 +305,7 @@ eDriverVariablePropertyResult driver_get_variable_property(
 
   /* Get RNA-pointer for the data-block given in target. */
   const DriverTargetContext driver_target_context = driver_target_context_from_animation_context(
-      anim_eval_context);
+      anim_eval_context, dvar);
   PointerRNA target_ptr;
   if (!driver_get_target_property(&driver_target_context, dvar, dtar, &target_ptr)) {
     if (G.debug & G_DEBUG) {
@@ -1390,6 +1396,15 @@ static void evaluate_driver_python(PathResolvedRNA *anim_rna,
                                             anim_eval_context->eval_time))
   {
 #ifdef WITH_PYTHON
+    /* Variables that don't have to be passed to Python as RNA values are evaluated here, before
+     * taking the lock, so drivers evaluated in other threads don't have to wait for this. Their
+     * value is read back from `dvar->curval` by #BPY_driver_exec. */
+    LISTBASE_FOREACH (DriverVar *, dvar, &driver->variables) {
+      if (dvar->type != DVAR_TYPE_SINGLE_PROP) {
+        driver_get_variable_value(anim_eval_context, driver, dvar);
+      }
+    }
+
     /* This evaluates the expression using Python, and returns its result:
      * - on errors it reports, then returns 0.0f. */
     BLI_mutex_lock(&python_driver_lock);
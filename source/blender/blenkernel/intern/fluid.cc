@@ -3747,12 +3747,19 @@ static void fluid_modifier_processDomain(FluidModifierData *fmd,
   with_guide = fds->flags & FLUID_DOMAIN_USE_GUIDE;
   with_particles = drops || bubble || floater;
 
+  /* Every cache query checks for files on disk (including several fallback names if the file
+   * is missing), which is slow on network storage. Only look for caches that this domain can
+   * actually use, the results for the other cache types are never read. */
+  const bool use_noise = with_smoke && with_noise;
+  const bool use_mesh = with_liquid && with_mesh;
+  const bool use_particles = with_liquid && with_particles;
+
   bool has_data, has_noise, has_mesh, has_particles, has_guide, has_config;
   has_data = manta_has_data(fds->fluid, fmd, scene_framenr);
-  has_noise = manta_has_noise(fds->fluid, fmd, scene_framenr);
-  has_mesh = manta_has_mesh(fds->fluid, fmd, scene_framenr);
-  has_particles = manta_has_particles(fds->fluid, fmd, scene_framenr);
-  has_guide = manta_has_guiding(fds->fluid, fmd, scene_framenr, guide_parent);
+  has_noise = use_noise && manta_has_noise(fds->fluid, fmd, scene_framenr);
+  has_mesh = use_mesh && manta_has_mesh(fds->fluid, fmd, scene_framenr);
+  has_particles = use_particles && manta_has_particles(fds->fluid, fmd, scene_framenr);
+  has_guide = with_guide && manta_has_guiding(fds->fluid, fmd, scene_framenr, guide_parent);
   has_config = manta_read_config(fds->fluid, fmd, scene_framenr);
 
   /* When reading data from cache (has_config == true) ensure that active fields are allocated.
@@ -3781,22 +3788,24 @@ static void fluid_modifier_processDomain(FluidModifierData *fmd,
   read_cache = false;
   bake_cache = baking_data || baking_noise || baking_mesh || baking_particles || baking_guide;
 
-  bool next_data, next_noise, next_mesh, next_particles, next_guide;
+  /* The next frame is only used to decide between partial and full reads, which mesh and guiding
+   * caches don't support. */
+  bool next_data, next_noise, next_particles;
   next_data = manta_has_data(fds->fluid, fmd, next_frame);
-  next_noise = manta_has_noise(fds->fluid, fmd, next_frame);
-  next_mesh = manta_has_mesh(fds->fluid, fmd, next_frame);
-  next_particles = manta_has_particles(fds->fluid, fmd, next_frame);
-  next_guide = manta_has_guiding(fds->fluid, fmd, next_frame, guide_parent);
-
-  bool prev_data, prev_noise, prev_mesh, prev_particles, prev_guide;
-  prev_data = manta_has_data(fds->fluid, fmd, prev_frame);
-  prev_noise = manta_has_noise(fds->fluid, fmd, prev_frame);
-  prev_mesh = manta_has_mesh(fds->fluid, fmd, prev_frame);
-  prev_particles = manta_has_particles(fds->fluid, fmd, prev_frame);
-  prev_guide = manta_has_guiding(fds->fluid, fmd, prev_frame, guide_parent);
-
-  /* Unused for now. */
-  UNUSED_VARS(next_mesh, next_guide);
+  next_noise = use_noise && manta_has_noise(fds->fluid, fmd, next_frame);
+  next_particles = use_particles && manta_has_particles(fds->fluid, fmd, next_frame);
+
+  /* The previous frame is only needed to decide whether to continue baking in replay mode
+   * (which is also the fallback for unknown cache types below). */
+  bool prev_data = false, prev_noise = false, prev_mesh = false, prev_particles = false,
+       prev_guide = false;
+  if (!ELEM(mode, FLUID_DOMAIN_CACHE_ALL, FLUID_DOMAIN_CACHE_MODULAR)) {
+    prev_data = manta_has_data(fds->fluid, fmd, prev_frame);
+    prev_noise = use_noise && manta_has_noise(fds->fluid, fmd, prev_frame);
+    prev_mesh = use_mesh && manta_has_mesh(fds->fluid, fmd, prev_frame);
+    prev_particles = use_particles && manta_has_particles(fds->fluid, fmd, prev_frame);
+    prev_guide = with_guide && manta_has_guiding(fds->fluid, fmd, prev_frame, guide_parent);
+  }
 
   bool with_gdomain;
   with_gdomain = (fds->guide_source == FLUID_DOMAIN_GUIDE_SRC_DOMAIN);
@@ -983,25 +983,31 @@ void copy_drawing_array(Span<const GreasePencilDrawingBase *> src_drawings,
                         MutableSpan<GreasePencilDrawingBase *> dst_drawings)
 {
   BLI_assert(src_drawings.size() == dst_drawings.size());
-  for (const int i : src_drawings.index_range()) {
-    const GreasePencilDrawingBase *src_drawing_base = src_drawings[i];
-    switch (src_drawing_base->type) {
-      case GP_DRAWING: {
-        const GreasePencilDrawing *src_drawing = reinterpret_cast<const GreasePencilDrawing *>(
-            src_drawing_base);
-        dst_drawings[i] = reinterpret_cast<GreasePencilDrawingBase *>(
-            MEM_new<bke::greasepencil::Drawing>(__func__, src_drawing->wrap()));
-        break;
-      }
-      case GP_DRAWING_REFERENCE: {
-        const GreasePencilDrawingReference *src_drawing_reference =
-            reinterpret_cast<const GreasePencilDrawingReference *>(src_drawing_base);
-        dst_drawings[i] = reinterpret_cast<GreasePencilDrawingBase *>(
-            MEM_new<bke::greasepencil::DrawingReference>(__func__, src_drawing_reference->wrap()));
-        break;
+  /* The geometry and caches are shared with the source drawings, so copying a single drawing is
+   * cheap. Objects can have thousands of drawings though, and they are copied for every
+   * evaluated copy, so copy them in parallel. */
+  threading::parallel_for(src_drawings.index_range(), 256, [&](const IndexRange range) {
+    for (const int i : range) {
+      const GreasePencilDrawingBase *src_drawing_base = src_drawings[i];
+      switch (src_drawing_base->type) {
+        case GP_DRAWING: {
+          const GreasePencilDrawing *src_drawing = reinterpret_cast<const GreasePencilDrawing *>(
+              src_drawing_base);
+          dst_drawings[i] = reinterpret_cast<GreasePencilDrawingBase *>(
+              MEM_new<bke::greasepencil::Drawing>(__func__, src_drawing->wrap()));
+          break;
+        }
+        case GP_DRAWING_REFERENCE: {
+          const GreasePencilDrawingReference *src_drawing_reference =
+              reinterpret_cast<const GreasePencilDrawingReference *>(src_drawing_base);
+          dst_drawings[i] = reinterpret_cast<GreasePencilDrawingBase *>(
+              MEM_new<bke::greasepencil::DrawingReference>(__func__,
+                                                           src_drawing_reference->wrap()));
+          break;
+        }
       }
     }
-  }
+  });
 }
 
 TreeNode::TreeNode()
@@ -30,6 +30,8 @@
 #include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "CLG_log.h"
 
@@ -115,6 +117,8 @@
 #include "DNA_space_types.h"
 
 using blender::Array;
+using blender::IndexRange;
+using blender::Vector;
 
 static CLG_LogRef LOG = {"bke.image"};
 
@@ -4869,6 +4873,99 @@ ImBuf *BKE_image_acquire_ibuf(Image *ima, ImageUser *iuser, void **r_lock)
   return ibuf;
 }
 
+void BKE_image_preload_tiles(Image *ima)
+{
+  if (ima == nullptr || ima->source != IMA_SRC_TILED || ima->type != IMA_TYPE_IMAGE) {
+    return;
+  }
+
+  /* Packed, multi-view and auto-packed tiles modify image data while loading, leave those to the
+   * regular on demand loading. */
+  if (BKE_image_is_multiview(ima) || BKE_image_has_packedfile(ima) ||
+      (G.fileflags & G_FILE_AUTOPACK))
+  {
+    return;
+  }
+
+  struct TileLoad {
+    int tile_number;
+    char filepath[FILE_MAX];
+    char colorspace[IM_MAX_SPACE];
+    ImBuf *ibuf;
+  };
+  Vector<TileLoad> loads;
+
+  BLI_mutex_lock(static_cast<ThreadMutex *>(ima->runtime.cache_mutex));
+  LISTBASE_FOREACH (ImageTile *, tile, &ima->tiles) {
+    if (tile->gen_flag & IMA_GEN_TILE) {
+      continue;
+    }
+
+    bool is_cached_empty = false;
+    ImBuf *cached_ibuf = image_get_cached_ibuf_for_index_entry(
+        ima, 0, tile->tile_number, &is_cached_empty);
+    if (cached_ibuf || is_cached_empty) {
+      IMB_freeImBuf(cached_ibuf);
+      continue;
+    }
+
+    ImageUser iuser;
+    BKE_imageuser_default(&iuser);
+    iuser.tile = tile->tile_number;
+
+    loads.append_as();
+    TileLoad &load = loads.last();
+    load.tile_number = tile->tile_number;
+    BKE_image_user_file_path(&iuser, ima, load.filepath);
+    STRNCPY(load.colorspace, ima->colorspace_settings.name);
+    load.ibuf = nullptr;
+  }
+  const int flag = IB_byte_data | IB_multilayer | IB_metadata | imbuf_alpha_flags_for_image(ima);
+  BLI_mutex_unlock(static_cast<ThreadMutex *>(ima->runtime.cache_mutex));
+
+  if (loads.size() < 2) {
+    return;
+  }
+
+  /* Decode the files outside of the cache lock so that tiles are read and decoded in parallel. */
+  blender::threading::parallel_for(loads.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      loads[i].ibuf = IMB_loadiffname(loads[i].filepath, flag, loads[i].colorspace);
+    }
+  });
+
+  BLI_mutex_lock(static_cast<ThreadMutex *>(ima->runtime.cache_mutex));
+  for (TileLoad &load : loads) {
+    ImBuf *ibuf = load.ibuf;
+    if (ibuf == nullptr) {
+      /* Let the regular loading report and cache the failure. */
+      continue;
+    }
+
+    bool is_cached_empty = false;
+    ImBuf *cached_ibuf = image_get_cached_ibuf_for_index_entry(
+        ima, 0, load.tile_number, &is_cached_empty);
+    const bool is_multilayer = ibuf->ftype == IMB_FTYPE_OPENEXR && ibuf->userdata;
+    if (cached_ibuf || is_cached_empty || is_multilayer || ima->type != IMA_TYPE_IMAGE) {
+      /* Loaded in the meantime, or needs the multi-layer handling of the regular loading. */
+      IMB_freeImBuf(cached_ibuf);
+      IMB_freeImBuf(ibuf);
+      continue;
+    }
+
+    ImageUser iuser;
+    BKE_imageuser_default(&iuser);
+    iuser.tile = load.tile_number;
+
+    STRNCPY(ima->colorspace_settings.name, load.colorspace);
+    image_init_after_load(ima, &iuser, ibuf);
+    ibuf->userflags |= IB_PERSISTENT;
+    image_assign_ibuf(ima, ibuf, 0, load.tile_number);
+    IMB_freeImBuf(ibuf);
+  }
+  BLI_mutex_unlock(static_cast<ThreadMutex *>(ima->runtime.cache_mutex));
+}
+
 static int get_multilayer_view_index(const Image &image,
                                      const ImageUser &image_user,
                                      const char *view_name)
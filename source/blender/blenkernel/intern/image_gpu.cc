@@ -6,6 +6,8 @@
  * \ingroup bke
  */
 
+#include <algorithm>
+
 #include "MEM_guardedalloc.h"
 
 #include "BLI_boxpack_2d.h"
@@ -15,6 +17,7 @@
 #include "BLI_rect.h"
 #include "BLI_threads.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "DNA_image_types.h"
 #include "DNA_userdef_types.h"
@@ -140,6 +143,9 @@ static GPUTexture *gpu_texture_create_tile_array(Image *ima, ImBuf *main_ibuf)
 
   int planes = 0;
 
+  /* Decode all tiles up-front in parallel, instead of one by one below. */
+  BKE_image_preload_tiles(ima);
+
   LISTBASE_FOREACH (ImageTile *, tile, &ima->tiles) {
     ImageUser iuser;
     BKE_imageuser_default(&iuser);
@@ -581,11 +587,53 @@ void BKE_image_free_anim_gputextures(Main *bmain)
   }
 }
 
+/**
+ * When the GPU is running out of memory, free the GPU textures of the least recently used images
+ * instead of waiting for them to time out. Images used during the current second are kept, as
+ * they are likely still visible.
+ */
+static void image_free_least_recently_used_gputextures(Main *bmain, const int ctime)
+{
+  if (!GPU_mem_stats_supported()) {
+    return;
+  }
+  int total_mem_kb = 0;
+  int free_mem_kb = 0;
+  GPU_mem_stats_get(&total_mem_kb, &free_mem_kb);
+  /* Start evicting when less than a tenth of the memory is available. */
+  if (total_mem_kb <= 0 || int64_t(free_mem_kb) * 10 >= int64_t(total_mem_kb)) {
+    return;
+  }
+
+  blender::Vector<Image *> images;
+  LISTBASE_FOREACH (Image *, ima, &bmain->images) {
+    if ((ima->flag & IMA_NOCOLLECT) == 0 && ima->lastused < ctime &&
+        BKE_image_has_opengl_texture(ima))
+    {
+      images.append(ima);
+    }
+  }
+  std::sort(images.begin(), images.end(), [](const Image *a, const Image *b) {
+    return a->lastused < b->lastused;
+  });
+
+  /* Free the oldest half, the memory statistics are checked again during the next second. */
+  for (Image *ima : images.as_span().take_front((images.size() + 1) / 2)) {
+    BKE_image_free_gputextures(ima);
+  }
+}
+
 void BKE_image_free_old_gputextures(Main *bmain)
 {
   static int lasttime = 0;
+  static int last_memory_check_time = 0;
   int ctime = int(BLI_time_now_seconds());
 
+  if (!G.is_rendering && ctime != last_memory_check_time) {
+    last_memory_check_time = ctime;
+    image_free_least_recently_used_gputextures(bmain, ctime);
+  }
+
   /*
    * Run garbage collector once for every collecting period of time
    * if textimeout is 0, that's the option to NOT run the collector
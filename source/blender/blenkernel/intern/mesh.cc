@@ -152,6 +152,7 @@ static void mesh_copy_data(Main *bmain,
   mesh_dst->runtime->vert_to_face_map_cache = mesh_src->runtime->vert_to_face_map_cache;
   mesh_dst->runtime->vert_to_corner_map_cache = mesh_src->runtime->vert_to_corner_map_cache;
   mesh_dst->runtime->corner_to_face_map_cache = mesh_src->runtime->corner_to_face_map_cache;
+  mesh_dst->runtime->shrinkwrap_boundary_cache = mesh_src->runtime->shrinkwrap_boundary_cache;
   mesh_dst->runtime->bvh_cache_verts = mesh_src->runtime->bvh_cache_verts;
   mesh_dst->runtime->bvh_cache_edges = mesh_src->runtime->bvh_cache_edges;
   mesh_dst->runtime->bvh_cache_faces = mesh_src->runtime->bvh_cache_faces;
@@ -432,8 +433,8 @@ static void mesh_blend_read_data(BlendDataReader *reader, ID *id)
   mesh->runtime = new blender::bke::MeshRuntime();
 
   if (mesh->face_offset_indices) {
-    mesh->runtime->face_offsets_sharing_info = BLO_read_shared(
-        reader, &mesh->face_offset_indices, [&]() {
+    mesh->runtime->face_offsets_sharing_info = BLO_read_shared_plain_data(
+        reader, &mesh->face_offset_indices, sizeof(int) * (mesh->faces_num + 1), [&]() {
           BLO_read_int32_array(reader, mesh->faces_num + 1, &mesh->face_offset_indices);
           return blender::implicit_sharing::info_for_mem_free(mesh->face_offset_indices);
         });
@@ -10,6 +10,7 @@
  * \see `bmesh_mesh_normals.cc` for the equivalent #BMesh functionality.
  */
 
+#include <atomic>
 #include <climits>
 
 #include "MEM_guardedalloc.h"
@@ -19,6 +20,7 @@
 
 #include "BLI_array_utils.hh"
 #include "BLI_bit_vector.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_linklist.h"
 #include "BLI_math_base.hh"
 #include "BLI_math_vector.hh"
@@ -1029,28 +1031,37 @@ static void split_corner_normal_fan_do(CornerSplitTaskDataCommon *common_data,
   }
 }
 
+/** Flags stored per corner while looking for the entry points of cyclic smooth fans. */
+enum CornerFanFlag : uint8_t {
+  /** The corner has been reached while walking around a smooth fan. */
+  CORNER_FAN_VISITED = 1 << 0,
+  /** The corner is the entry point of a cyclic smooth fan. */
+  CORNER_FAN_CYCLIC_ENTRY = 1 << 1,
+};
+
 /**
- * Check whether given corner is part of an unknown-so-far cyclic smooth fan, or not.
- * Needed because cyclic smooth fans have no obvious 'entry point',
- * and yet we need to walk them once, and only once.
+ * Walk around the smooth fan of the given corner, tagging all corners of the fan as visited.
+ * Cyclic smooth fans have no obvious 'entry point', and yet we need to walk them once, and only
+ * once. The corner with the lowest index is used (which is the one a serial iteration over all
+ * corners would find first), so the result does not depend on the order in which the fans are
+ * walked from different threads.
  */
-static bool corner_split_generator_check_cyclic_smooth_fan(const Span<int> corner_verts,
-                                                           const Span<int> corner_edges,
-                                                           const OffsetIndices<int> faces,
-                                                           const Span<int2> edge_to_corners,
-                                                           const Span<int> corner_to_face,
-                                                           const int2 e2l_prev,
-                                                           MutableBitSpan skip_corners,
-                                                           const int corner,
-                                                           const int corner_prev)
+static void corner_split_generator_tag_cyclic_smooth_fan(const Span<int> corner_verts,
+                                                         const Span<int> corner_edges,
+                                                         const OffsetIndices<int> faces,
+                                                         const Span<int2> edge_to_corners,
+                                                         const Span<int> corner_to_face,
+                                                         MutableSpan<std::atomic<uint8_t>> flags,
+                                                         const int corner,
+                                                         const int corner_prev)
 {
   /* The vertex we are "fanning" around. */
   const int vert_pivot = corner_verts[corner];
 
-  int2 e2lfan_curr = e2l_prev;
+  int2 e2lfan_curr = edge_to_corners[corner_edges[corner_prev]];
   if (IS_EDGE_SHARP(e2lfan_curr)) {
     /* Sharp corner, so not a cyclic smooth fan. */
-    return false;
+    return;
   }
 
   /* `vert_corner` the corner of our current edge might not be the corner of our current
@@ -1058,14 +1069,16 @@ static bool corner_split_generator_check_cyclic_smooth_fan(const Span<int> corne
    */
   int fan_corner = corner_prev;
   int vert_corner = corner;
+  int min_corner = corner;
 
   BLI_assert(fan_corner >= 0);
   BLI_assert(vert_corner >= 0);
 
-  BLI_assert(!skip_corners[vert_corner]);
-  skip_corners[vert_corner].set();
+  flags[vert_corner].fetch_or(CORNER_FAN_VISITED, std::memory_order_relaxed);
 
-  while (true) {
+  /* Only used to guarantee termination on degenerate geometry, where walking around the vertex
+   * may never get back to the initial corner. */
+  for (int64_t step = 0; step < corner_verts.size(); step++) {
     /* Find next corner of the smooth fan. */
     corner_manifold_fan_around_vert_next(
         corner_verts, faces, corner_to_face, e2lfan_curr, vert_pivot, &fan_corner, &vert_corner);
@@ -1074,27 +1087,25 @@ static bool corner_split_generator_check_cyclic_smooth_fan(const Span<int> corne
 
     if (IS_EDGE_SHARP(e2lfan_curr)) {
       /* Sharp corner/edge, so not a cyclic smooth fan. */
-      return false;
+      return;
     }
-    /* Smooth corner/edge. */
-    if (skip_corners[vert_corner]) {
-      if (vert_corner == corner) {
-        /* We walked around a whole cyclic smooth fan without finding any already-processed corner,
-         * means we can use initial current / previous edge as start for this smooth fan. */
-        return true;
-      }
-      /* Already checked in some previous looping, we can abort. */
-      return false;
+    if (vert_corner == corner) {
+      /* We walked around a whole cyclic smooth fan. Other threads walking the same fan at the
+       * same time find the same entry point, so tagging it more than once is fine. */
+      flags[min_corner].fetch_or(CORNER_FAN_CYCLIC_ENTRY, std::memory_order_relaxed);
+      return;
     }
 
-    /* We can skip it in future, and keep checking the smooth fan. */
-    skip_corners[vert_corner].set();
+    /* Don't stop at corners already tagged by another walk, it may still be in progress. */
+    flags[vert_corner].fetch_or(CORNER_FAN_VISITED, std::memory_order_relaxed);
+    min_corner = std::min(min_corner, vert_corner);
   }
 }
 
 static void corner_split_generator(CornerSplitTaskDataCommon *common_data,
-                                   Vector<int, 32> &r_single_corners,
-                                   Vector<int, 32> &r_fan_corners)
+                                   IndexMaskMemory &memory,
+                                   IndexMask &r_single_corners,
+                                   IndexMask &r_fan_corners)
 {
   const Span<int> corner_verts = common_data->corner_verts;
   const Span<int> corner_edges = common_data->corner_edges;
@@ -1102,75 +1113,80 @@ static void corner_split_generator(CornerSplitTaskDataCommon *common_data,
   const Span<int> corner_to_face = common_data->corner_to_face;
   const Span<int2> edge_to_corners = common_data->edge_to_corners;
 
-  BitVector<> skip_corners(corner_verts.size(), false);
-
 #ifdef DEBUG_TIME
   SCOPED_TIMER_AVERAGED(__func__);
 #endif
 
   /* We now know edges that can be smoothed (with their vector, and their two corners),
-   * and edges that will be hard! Now, time to generate the normals.
-   */
-  for (const int face_index : faces.index_range()) {
-    const IndexRange face = faces[face_index];
-
-    for (const int corner : face) {
-      const int corner_prev = mesh::face_corner_prev(face, corner);
-
-#if 0
-      printf("Checking corner %d / edge %u / vert %u (sharp edge: %d, skiploop: %d)",
-             corner,
-             corner_edges[corner],
-             corner_verts[corner],
-             IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]]),
-             skip_corners[corner]);
-#endif
+   * and edges that will be hard! Now, time to find the entry points of all fans.
+   *
+   * Corners whose edge is sharp always start a fan. Corners with a smooth edge only start a fan
+   * if it is cyclic, which requires walking around the vertex. Each fan only has to be walked
+   * once, corners that have been reached by a previous walk are skipped. */
+  Array<std::atomic<uint8_t>> flags(corner_verts.size());
+  threading::parallel_for(flags.index_range(), 4096, [&](const IndexRange range) {
+    for (std::atomic<uint8_t> &flag : flags.as_mutable_span().slice(range)) {
+      flag.store(0, std::memory_order_relaxed);
+    }
+  });
 
-      /* A smooth edge, we have to check for cyclic smooth fan case.
-       * If we find a new, never-processed cyclic smooth fan, we can do it now using that
-       * corner/edge as 'entry point', otherwise we can skip it. */
-
-      /* NOTE: In theory, we could make #corner_split_generator_check_cyclic_smooth_fan() store
-       * vert_corner'es and edge indexes in two stacks, to avoid having to fan again around
-       * the vert during actual computation of `clnor` & `clnorspace`.
-       * However, this would complicate the code, add more memory usage, and despite its logical
-       * complexity, #corner_manifold_fan_around_vert_next() is quite cheap in term of CPU cycles,
-       * so really think it's not worth it. */
-      if (!IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]]) &&
-          (skip_corners[corner] || !corner_split_generator_check_cyclic_smooth_fan(
-                                       corner_verts,
-                                       corner_edges,
-                                       faces,
-                                       edge_to_corners,
-                                       corner_to_face,
-                                       edge_to_corners[corner_edges[corner_prev]],
-                                       skip_corners,
-                                       corner,
-                                       corner_prev)))
-      {
-        // printf("SKIPPING!\n");
-      }
-      else {
-        if (IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]]) &&
-            IS_EDGE_SHARP(edge_to_corners[corner_edges[corner_prev]]))
-        {
-          /* Simple case (both edges around that vertex are sharp in current face),
-           * this corner just takes its face normal. */
-          r_single_corners.append(corner);
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int face_index : range) {
+      const IndexRange face = faces[face_index];
+      for (const int corner : face) {
+        if (IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]])) {
+          continue;
         }
-        else {
-          /* We do not need to check/tag corners as already computed. Due to the fact that a corner
-           * only points to one of its two edges, the same fan will never be walked more than once.
-           * Since we consider edges that have neighbor faces with inverted (flipped) normals as
-           * sharp, we are sure that no fan will be skipped, even only considering the case (sharp
-           * current edge, smooth previous edge), and not the alternative (smooth current edge,
-           * sharp previous edge). All this due/thanks to the link between normals and corner
-           * ordering (i.e. winding). */
-          r_fan_corners.append(corner);
+        if (flags[corner].load(std::memory_order_relaxed) & CORNER_FAN_VISITED) {
+          continue;
         }
+        corner_split_generator_tag_cyclic_smooth_fan(corner_verts,
+                                                     corner_edges,
+                                                     faces,
+                                                     edge_to_corners,
+                                                     corner_to_face,
+                                                     flags,
+                                                     corner,
+                                                     mesh::face_corner_prev(face, corner));
       }
     }
-  }
+  });
+
+  /* NOTE: In theory, we could make #corner_split_generator_tag_cyclic_smooth_fan() store
+   * vert_corner'es and edge indexes in two stacks, to avoid having to fan again around
+   * the vert during actual computation of `clnor` & `clnorspace`.
+   * However, this would complicate the code, add more memory usage, and despite its logical
+   * complexity, #corner_manifold_fan_around_vert_next() is quite cheap in term of CPU cycles,
+   * so really think it's not worth it. */
+  const auto is_fan_start = [&](const int corner) {
+    return IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]]) ||
+           (flags[corner].load(std::memory_order_relaxed) & CORNER_FAN_CYCLIC_ENTRY);
+  };
+  const auto is_prev_edge_sharp = [&](const int corner) {
+    const int corner_prev = mesh::face_corner_prev(faces[corner_to_face[corner]], corner);
+    return IS_EDGE_SHARP(edge_to_corners[corner_edges[corner_prev]]);
+  };
+
+  /* Simple case (both edges around that vertex are sharp in current face),
+   * this corner just takes its face normal. */
+  r_single_corners = IndexMask::from_predicate(
+      corner_verts.index_range(), GrainSize(4096), memory, [&](const int corner) {
+        return IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]]) && is_prev_edge_sharp(corner);
+      });
+
+  /* We do not need to check/tag corners as already computed. Due to the fact that a corner
+   * only points to one of its two edges, the same fan will never be walked more than once.
+   * Since we consider edges that have neighbor faces with inverted (flipped) normals as
+   * sharp, we are sure that no fan will be skipped, even only considering the case (sharp
+   * current edge, smooth previous edge), and not the alternative (smooth current edge,
+   * sharp previous edge). All this due/thanks to the link between normals and corner
+   * ordering (i.e. winding). */
+  r_fan_corners = IndexMask::from_predicate(
+      corner_verts.index_range(), GrainSize(4096), memory, [&](const int corner) {
+        return is_fan_start(corner) &&
+               !(IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]]) &&
+                 is_prev_edge_sharp(corner));
+      });
 }
 
 void normals_calc_corners(const Span<float3> vert_positions,
@@ -1231,9 +1247,10 @@ void normals_calc_corners(const Span<float3> vert_positions,
   build_edge_to_corner_map_with_flip_and_sharp(
       faces, corner_verts, corner_edges, sharp_faces, sharp_edges, edge_to_corners);
 
-  Vector<int, 32> single_corners;
-  Vector<int, 32> fan_corners;
-  corner_split_generator(&common_data, single_corners, fan_corners);
+  IndexMaskMemory memory;
+  IndexMask single_corners;
+  IndexMask fan_corners;
+  corner_split_generator(&common_data, memory, single_corners, fan_corners);
 
   if (r_lnors_spacearr) {
     r_lnors_spacearr->spaces.reinitialize(single_corners.size() + fan_corners.size());
@@ -1243,20 +1260,16 @@ void normals_calc_corners(const Span<float3> vert_positions,
     }
   }
 
-  threading::parallel_for(single_corners.index_range(), 1024, [&](const IndexRange range) {
-    for (const int i : range) {
-      const int corner = single_corners[i];
-      lnor_space_for_single_fan(&common_data, corner, i);
-    }
+  single_corners.foreach_index(GrainSize(1024), [&](const int corner, const int i) {
+    lnor_space_for_single_fan(&common_data, corner, i);
   });
 
   threading::parallel_for(fan_corners.index_range(), 1024, [&](const IndexRange range) {
     Vector<float3, 16> edge_vectors;
-    for (const int i : range) {
-      const int corner = fan_corners[i];
-      const int space_index = single_corners.size() + i;
+    fan_corners.slice(range).foreach_index([&](const int corner, const int i) {
+      const int space_index = single_corners.size() + range.start() + i;
       split_corner_normal_fan_do(&common_data, corner, space_index, &edge_vectors);
-    }
+    });
   });
 }
 
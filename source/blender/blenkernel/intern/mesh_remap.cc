@@ -15,6 +15,7 @@
 #include "BLI_array.hh"
 #include "BLI_astar.h"
 #include "BLI_bit_vector.hh"
+#include "BLI_function_ref.hh"
 #include "BLI_index_mask.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
@@ -24,6 +25,7 @@
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_bvhutils.hh"
@@ -102,6 +104,49 @@ static bool mesh_remap_bvhtree_query_raycast(blender::bke::BVHTreeFromMesh *tree
   return false;
 }
 
+/* Number of items processed in sequence by #mesh_remap_bvhtree_query_nearest_batch. Chunks have a
+ * fixed size so that the local proximity heuristic, which reuses the previous result of the chunk,
+ * gives the same results whatever the scheduling of the threads. */
+#define MREMAP_NEAREST_CHUNK_SIZE 1024
+
+/**
+ * Find the nearest tree element of many query points in parallel.
+ * \param get_co: Computes the query point (in tree space) for an item.
+ * \param r_indices: The nearest element in the tree for every item, -1 if none was found within
+ * \a max_dist_sq.
+ */
+static void mesh_remap_bvhtree_query_nearest_batch(
+    blender::bke::BVHTreeFromMesh *treedata,
+    const int items_num,
+    const float max_dist_sq,
+    const blender::FunctionRef<void(int index, float r_co[3])> get_co,
+    blender::MutableSpan<int> r_indices,
+    blender::MutableSpan<float> r_hit_dists)
+{
+  const int chunks_num = int(divide_ceil_u(uint(items_num), MREMAP_NEAREST_CHUNK_SIZE));
+  blender::threading::parallel_for(
+      blender::IndexRange(chunks_num), 1, [&](const blender::IndexRange chunks) {
+        for (const int64_t chunk : chunks) {
+          const int start = int(chunk) * MREMAP_NEAREST_CHUNK_SIZE;
+          const int end = min_ii(start + MREMAP_NEAREST_CHUNK_SIZE, items_num);
+          BVHTreeNearest nearest = {0};
+          nearest.index = -1;
+          for (int i = start; i < end; i++) {
+            float tmp_co[3];
+            get_co(i, tmp_co);
+            if (mesh_remap_bvhtree_query_nearest(
+                    treedata, &nearest, tmp_co, max_dist_sq, &r_hit_dists[i]))
+            {
+              r_indices[i] = nearest.index;
+            }
+            else {
+              r_indices[i] = -1;
+            }
+          }
+        }
+      });
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -474,21 +519,26 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
     float hit_dist;
     float tmp_co[3], tmp_no[3];
 
+    const auto get_vert_co_dst = [&](const int index, float r_co[3]) {
+      copy_v3_v3(r_co, vert_positions_dst[index]);
+
+      /* Convert the vertex to tree coordinates, if needed. */
+      if (space_transform) {
+        BLI_space_transform_apply(space_transform, r_co);
+      }
+    };
+
     if (mode == MREMAP_MODE_VERT_NEAREST) {
       treedata = me_src->bvh_verts();
-      nearest.index = -1;
-
-      for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+      blender::Array<int> nearest_indices(numverts_dst);
+      blender::Array<float> hit_dists(numverts_dst);
+      mesh_remap_bvhtree_query_nearest_batch(
+          &treedata, numverts_dst, max_dist_sq, get_vert_co_dst, nearest_indices, hit_dists);
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest.index, &full_weight);
+      for (i = 0; i < numverts_dst; i++) {
+        if (nearest_indices[i] != -1) {
+          mesh_remap_item_define(r_map, i, hit_dists[i], 0, 1, &nearest_indices[i], &full_weight);
         }
         else {
           /* No source for this dest vertex! */
@@ -501,19 +551,17 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
       const blender::Span<blender::float3> positions_src = me_src->vert_positions();
 
       treedata = me_src->bvh_edges();
-      nearest.index = -1;
 
-      for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
+      blender::Array<int> nearest_indices(numverts_dst);
+      blender::Array<float> hit_dists(numverts_dst);
+      mesh_remap_bvhtree_query_nearest_batch(
+          &treedata, numverts_dst, max_dist_sq, get_vert_co_dst, nearest_indices, hit_dists);
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
-
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          const blender::int2 &edge = edges_src[nearest.index];
+      for (i = 0; i < numverts_dst; i++) {
+        if (nearest_indices[i] != -1) {
+          get_vert_co_dst(i, tmp_co);
+          hit_dist = hit_dists[i];
+          const blender::int2 &edge = edges_src[nearest_indices[i]];
           const float *v1cos = positions_src[edge[0]];
           const float *v2cos = positions_src[edge[1]];
 
@@ -821,22 +869,30 @@ void BKE_mesh_remap_calc_edges_from_mesh(const int mode,
     }
     else if (mode == MREMAP_MODE_EDGE_NEAREST) {
       treedata = me_src->bvh_edges();
-      nearest.index = -1;
 
-      for (i = 0; i < numedges_dst; i++) {
-        interp_v3_v3v3(tmp_co,
-                       vert_positions_dst[edges_dst[i][0]],
-                       vert_positions_dst[edges_dst[i][1]],
-                       0.5f);
+      blender::Array<int> nearest_indices(numedges_dst);
+      blender::Array<float> hit_dists(numedges_dst);
+      mesh_remap_bvhtree_query_nearest_batch(
+          &treedata,
+          numedges_dst,
+          max_dist_sq,
+          [&](const int index, float r_co[3]) {
+            interp_v3_v3v3(r_co,
+                           vert_positions_dst[edges_dst[index][0]],
+                           vert_positions_dst[edges_dst[index][1]],
+                           0.5f);
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+            /* Convert the vertex to tree coordinates, if needed. */
+            if (space_transform) {
+              BLI_space_transform_apply(space_transform, r_co);
+            }
+          },
+          nearest_indices,
+          hit_dists);
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest.index, &full_weight);
+      for (i = 0; i < numedges_dst; i++) {
+        if (nearest_indices[i] != -1) {
+          mesh_remap_item_define(r_map, i, hit_dists[i], 0, 1, &nearest_indices[i], &full_weight);
         }
         else {
           /* No source for this dest edge! */
@@ -2044,23 +2100,33 @@ void BKE_mesh_remap_calc_faces_from_mesh(const int mode,
     blender::bke::BVHTreeFromMesh treedata = me_src->bvh_corner_tris();
 
     if (mode == MREMAP_MODE_POLY_NEAREST) {
-      nearest.index = -1;
+      const int faces_num = int(faces_dst.size());
+      blender::Array<int> nearest_indices(faces_num);
+      blender::Array<float> hit_dists(faces_num);
+      mesh_remap_bvhtree_query_nearest_batch(
+          &treedata,
+          faces_num,
+          max_dist_sq,
+          [&](const int index, float r_co[3]) {
+            const blender::IndexRange face = faces_dst[index];
+            copy_v3_v3(r_co,
+                       blender::bke::mesh::face_center_calc(
+                           {reinterpret_cast<const blender::float3 *>(vert_positions_dst),
+                            numverts_dst},
+                           {&corner_verts_dst[face.start()], face.size()}));
 
-      for (const int64_t i : faces_dst.index_range()) {
-        const blender::IndexRange face = faces_dst[i];
-        tmp_co = blender::bke::mesh::face_center_calc(
-            {reinterpret_cast<const blender::float3 *>(vert_positions_dst), numverts_dst},
-            {&corner_verts_dst[face.start()], face.size()});
-
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+            /* Convert the vertex to tree coordinates, if needed. */
+            if (space_transform) {
+              BLI_space_transform_apply(space_transform, r_co);
+            }
+          },
+          nearest_indices,
+          hit_dists);
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          const int face_index = tri_faces[nearest.index];
-          mesh_remap_item_define(r_map, int(i), hit_dist, 0, 1, &face_index, &full_weight);
+      for (const int64_t i : faces_dst.index_range()) {
+        if (nearest_indices[i] != -1) {
+          const int face_index = tri_faces[nearest_indices[i]];
+          mesh_remap_item_define(r_map, int(i), hit_dists[i], 0, 1, &face_index, &full_weight);
         }
         else {
           /* No source for this dest face! */
@@ -395,7 +395,12 @@ void Mesh::tag_positions_changed()
 void Mesh::tag_positions_changed_no_normals()
 {
   free_bvh_caches(*this->runtime);
-  this->runtime->corner_tris_cache.tag_dirty();
+  /* The triangulation of faces with more than three corners depends on the positions. When there
+   * are only triangles it only depends on the topology, so it can stay shared with the original
+   * mesh. This is common for meshes that are only deformed, e.g. by an armature. */
+  if (int64_t(this->faces_num) * 3 != this->corners_num) {
+    this->runtime->corner_tris_cache.tag_dirty();
+  }
   this->runtime->bounds_cache.tag_dirty();
   this->runtime->shrinkwrap_boundary_cache.tag_dirty();
 }
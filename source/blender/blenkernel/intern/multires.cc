@@ -1185,9 +1185,17 @@ void multires_stitch_grids(Object *ob)
   if (subdiv_ccg == nullptr) {
     return;
   }
-  BLI_assert(bke::object::pbvh_get(*ob) &&
-             bke::object::pbvh_get(*ob)->type() == blender::bke::pbvh::Type::Grids);
-  BKE_subdiv_ccg_average_stitch_faces(*subdiv_ccg, IndexMask(subdiv_ccg->faces.size()));
+  const bke::pbvh::Tree *pbvh = bke::object::pbvh_get(*ob);
+  BLI_assert(pbvh && pbvh->type() == blender::bke::pbvh::Type::Grids);
+  /* Only stitch where the grids were modified, stitching all grids is very expensive for high
+   * resolution sculpts. */
+  IndexMaskMemory memory;
+  const IndexMask faces = bke::pbvh::nodes_to_face_selection_grids(
+      *subdiv_ccg,
+      pbvh->nodes<bke::pbvh::GridsNode>(),
+      pbvh->nodes_with_dirty_normals(memory),
+      memory);
+  BKE_subdiv_ccg_average_stitch_faces(*subdiv_ccg, faces);
 }
 
 DerivedMesh *multires_make_derived_from_derived(DerivedMesh *dm,
@@ -45,6 +45,7 @@
 #include "BLI_rand.h"
 #include "BLI_string.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -3261,31 +3262,20 @@ void psys_cache_paths(ParticleSimulationData *sim, float cfra, const bool use_re
   ParticleEditSettings *pset = &sim->scene->toolsettings->particle;
   ParticleSystem *psys = sim->psys;
   ParticleSettings *part = psys->part;
-  ParticleCacheKey *ca, **cache;
+  ParticleCacheKey **cache;
 
   Mesh *hair_mesh = (psys->part->type == PART_HAIR && psys->flag & PSYS_HAIR_DYNAMICS) ?
                         psys->hair_out_mesh :
                         nullptr;
 
-  ParticleKey result;
-
   Material *ma;
-  ParticleInterpolationData pind;
-  ParticleTexture ptex;
 
-  PARTICLE_P;
-
-  float birthtime = 0.0, dietime = 0.0;
-  float t, time = 0.0, dfra = 1.0;
+  float dfra = 1.0;
   float col[4] = {0.5f, 0.5f, 0.5f, 1.0f};
-  float prev_tangent[3] = {0.0f, 0.0f, 0.0f}, hairmat[4][4];
-  float rotmat[3][3];
-  int k;
   int segments = int(pow(2.0, double((use_render_params) ? part->ren_step : part->draw_step)));
   int totpart = psys->totpart;
-  float length, vec[3];
   float *vg_effector = nullptr;
-  float *vg_length = nullptr, pa_length = 1.0f;
+  float *vg_length = nullptr;
   int keyed, baked;
 
   /* we don't have anything valid to create paths from so let's quit here */
@@ -3329,8 +3319,20 @@ void psys_cache_paths(ParticleSimulationData *sim, float cfra, const bool use_re
   }
 
   /*---first main loop: create all actual particles' paths---*/
-  LOOP_PARTICLES
-  {
+  auto cache_particle_path = [&](const int p) {
+    ParticleData *pa = psys->particles + p;
+    ParticleCacheKey *ca;
+    ParticleKey result;
+    ParticleInterpolationData pind;
+    ParticleTexture ptex;
+    float birthtime = 0.0, dietime = 0.0;
+    float t, time = 0.0;
+    float prev_tangent[3] = {0.0f, 0.0f, 0.0f}, hairmat[4][4];
+    float rotmat[3][3];
+    float length, vec[3];
+    float pa_length = 1.0f;
+    int k;
+
     if (!psys->totchild) {
       psys_get_texture(sim, pa, &ptex, PAMAP_LENGTH, 0.0f);
       pa_length = ptex.length * (1.0f - part->randlength * psys_frand(psys, psys->seed + p));
@@ -3370,7 +3372,7 @@ void psys_cache_paths(ParticleSimulationData *sim, float cfra, const bool use_re
 
     if (birthtime >= dietime) {
       cache[p]->segments = -1;
-      continue;
+      return;
     }
 
     dietime = birthtime + pa_length * (dietime - birthtime);
@@ -3471,6 +3473,24 @@ void psys_cache_paths(ParticleSimulationData *sim, float cfra, const bool use_re
      * the possibility of flipping again. -jahka
      */
     mat3_to_quat_legacy(cache[p]->rot, rotmat);
+  };
+
+  /* Every path only depends on its own particle. It is not threaded when particle textures are
+   * evaluated (they may ensure mesh data), when reading keys from the point cache (which keeps
+   * static state), or for dynamic hair (which accesses the hair mesh for writing). */
+  const bool use_threading = psys->totchild > 0 && !keyed && !baked && hair_mesh == nullptr;
+  if (use_threading) {
+    blender::threading::parallel_for(
+        blender::IndexRange(totpart), 256, [&](const blender::IndexRange range) {
+          for (const int p : range) {
+            cache_particle_path(p);
+          }
+        });
+  }
+  else {
+    for (int p = 0; p < totpart; p++) {
+      cache_particle_path(p);
+    }
   }
 
   psys->totcached = totpart;
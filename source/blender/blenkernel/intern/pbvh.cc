@@ -58,23 +58,71 @@ static Bounds<float3> merge_bounds(const Bounds<float3> &a, const Bounds<float3>
   return bounds::merge(a, b);
 }
 
+/**
+ * Move the indices that satisfy the predicate to the front of the span, returning their number.
+ * The top levels of the tree partition all faces of the mesh, which is a large part of the build
+ * time for dense meshes, so large spans are partitioned in parallel chunks.
+ */
+template<typename Fn> static int partition_indices(MutableSpan<int> indices, const Fn &predicate)
+{
+  constexpr int64_t chunk_size = 1 << 16;
+  if (indices.size() <= chunk_size) {
+    const int *split = std::partition(indices.begin(), indices.end(), predicate);
+    return split - indices.begin();
+  }
+
+  const int64_t chunks_num = divide_ceil_ul(indices.size(), chunk_size);
+  const auto chunk_range = [&](const int64_t chunk) {
+    return indices.index_range().slice(chunk * chunk_size,
+                                       std::min(chunk_size, indices.size() - chunk * chunk_size));
+  };
+
+  Array<int> front_offset_data(chunks_num + 1);
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      const Span<int> chunk_indices = indices.slice(chunk_range(chunk));
+      front_offset_data[chunk] = std::count_if(
+          chunk_indices.begin(), chunk_indices.end(), predicate);
+    }
+  });
+  const OffsetIndices front_offsets = offset_indices::accumulate_counts_to_offsets(
+      front_offset_data);
+  const int front_num = front_offsets.total_size();
+
+  Array<int> partitioned(indices.size());
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      const IndexRange chunk_indices = chunk_range(chunk);
+      int front = front_offsets[chunk].start();
+      int back = front_num + (chunk_indices.start() - front);
+      for (const int index : indices.slice(chunk_indices)) {
+        if (predicate(index)) {
+          partitioned[front++] = index;
+        }
+        else {
+          partitioned[back++] = index;
+        }
+      }
+    }
+  });
+  array_utils::copy(partitioned.as_span(), indices);
+  return front_num;
+}
+
 static int partition_along_axis(const Span<float3> face_centers,
                                 MutableSpan<int> faces,
                                 const int axis,
                                 const float middle)
 {
-  const int *split = std::partition(faces.begin(), faces.end(), [&](const int face) {
-    return face_centers[face][axis] >= middle;
-  });
-  return split - faces.begin();
+  return partition_indices(faces,
+                           [&](const int face) { return face_centers[face][axis] >= middle; });
 }
 
 static int partition_material_indices(const Span<int> material_indices, MutableSpan<int> faces)
 {
   const int first = material_indices[faces.first()];
-  const int *split = std::partition(
-      faces.begin(), faces.end(), [&](const int face) { return material_indices[face] == first; });
-  return split - faces.begin();
+  return partition_indices(faces,
+                           [&](const int face) { return material_indices[face] == first; });
 }
 
 BLI_NOINLINE static void build_mesh_leaf_nodes(const int verts_num,
@@ -87,22 +135,21 @@ BLI_NOINLINE static void build_mesh_leaf_nodes(const int verts_num,
 #endif
   Array<Array<int>> verts_per_node(nodes.size(), NoInitialization());
   threading::parallel_for(nodes.index_range(), 8, [&](const IndexRange range) {
-    Set<int> verts;
+    /* Sorting the corner vertices and removing duplicates is cheaper than building a hash set,
+     * and the result has to be sorted anyway. */
+    Vector<int> verts;
     for (const int i : range) {
       MeshNode &node = nodes[i];
 
       verts.clear();
-      int corners_count = 0;
       for (const int face_index : node.face_indices_) {
-        const IndexRange face = faces[face_index];
-        verts.add_multiple(corner_verts.slice(face));
-        corners_count += face.size();
+        verts.extend(corner_verts.slice(faces[face_index]));
       }
-      nodes[i].corners_num_ = corners_count;
+      nodes[i].corners_num_ = verts.size();
 
-      new (&verts_per_node[i]) Array<int>(verts.size());
-      std::copy(verts.begin(), verts.end(), verts_per_node[i].begin());
-      std::sort(verts_per_node[i].begin(), verts_per_node[i].end());
+      std::sort(verts.begin(), verts.end());
+      const int *unique_end = std::unique(verts.begin(), verts.end());
+      new (&verts_per_node[i]) Array<int>(verts.as_span().take_front(unique_end - verts.begin()));
     }
   });
 
@@ -549,6 +596,11 @@ void Tree::tag_positions_changed(const IndexMask &node_mask)
   }
 }
 
+IndexMask Tree::nodes_with_dirty_normals(IndexMaskMemory &memory) const
+{
+  return IndexMask::from_bits(normals_dirty_, memory);
+}
+
 void Tree::tag_visibility_changed(const IndexMask &node_mask)
 {
   visibility_dirty_.resize(std::max(visibility_dirty_.size(), node_mask.min_array_size()), false);
@@ -14,8 +14,10 @@
 #include "BLI_math_vector.hh"
 #include "BLI_memarena.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector_set.hh"
 
 #include "BKE_global.hh"
 #include "BKE_paint_bvh.hh"
@@ -1948,15 +1950,29 @@ bool bmesh_node_nearest_to_ray(BMeshNode &node,
 void bmesh_normals_update(Tree &pbvh, const IndexMask &nodes_to_update)
 {
   const MutableSpan<BMeshNode> nodes = pbvh.nodes<BMeshNode>();
-  nodes_to_update.foreach_index([&](const int i) {
-    BMeshNode &node = nodes[i];
-    for (BMFace *face : node.bm_faces_) {
+  /* Every face belongs to a single node, so face normals can be computed for all nodes in
+   * parallel. Vertex normals depend on the normals of faces in neighboring nodes, so they are only
+   * computed once all face normals are up to date. */
+  nodes_to_update.foreach_index(GrainSize(1), [&](const int i) {
+    for (BMFace *face : nodes[i].bm_faces_) {
       BM_face_normal_update(face);
     }
-    for (BMVert *vert : node.bm_unique_verts_) {
+  });
+  nodes_to_update.foreach_index(GrainSize(1), [&](const int i) {
+    for (BMVert *vert : nodes[i].bm_unique_verts_) {
       BM_vert_normal_update(vert);
     }
-    for (BMVert *vert : node.bm_other_verts_) {
+  });
+  /* Vertices on node boundaries are owned by a different node and may be shared by several of the
+   * updated nodes, deduplicate them to avoid updating the same vertex from multiple threads. */
+  VectorSet<BMVert *> other_verts;
+  nodes_to_update.foreach_index([&](const int i) {
+    for (BMVert *vert : nodes[i].bm_other_verts_) {
+      other_verts.add(vert);
+    }
+  });
+  threading::parallel_for(other_verts.index_range(), 1024, [&](const IndexRange range) {
+    for (BMVert *vert : other_verts.as_span().slice(range)) {
       BM_vert_normal_update(vert);
     }
   });
@@ -41,6 +41,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
 
@@ -1551,76 +1552,97 @@ static int ptcache_file_compressed_read(PTCacheFile *pf, uchar *result, uint len
 
   return r;
 }
-static int ptcache_file_compressed_write(
-    PTCacheFile *pf, uchar *in, uint in_len, uchar *out, int mode)
-{
-  int r = 0;
+/**
+ * Result of compressing one data array, see #ptcache_file_compressed_write. Compression is
+ * separate from writing so that the arrays of a frame can be compressed in parallel.
+ */
+struct PTCacheCompressedData {
+  /** 0 when stored uncompressed, 1 for LZO and 2 for LZMA. */
   uchar compressed = 0;
   size_t out_len = 0;
-  uchar *props = static_cast<uchar *>(MEM_callocN(sizeof(char[16]), "tmp"));
-  size_t sizeOfIt = 5;
+  uchar props[16] = {};
+  size_t props_size = 5;
+  int result = 0;
+};
+
+static PTCacheCompressedData ptcache_data_compress(uchar *in, uint in_len, uchar *out, int mode)
+{
+  PTCacheCompressedData data;
 
-  (void)mode; /* unused when building w/o compression */
+  UNUSED_VARS(in, in_len, out, mode); /* unused when building w/o compression */
 
 #ifdef WITH_LZO
-  out_len = LZO_OUT_LEN(in_len);
+  data.out_len = LZO_OUT_LEN(in_len);
   if (mode == PTCACHE_COMPRESS_LZO) {
     LZO_HEAP_ALLOC(wrkmem, LZO1X_MEM_COMPRESS);
 
-    r = lzo1x_1_compress(in, (lzo_uint)in_len, out, (lzo_uint *)&out_len, wrkmem);
-    if (!(r == LZO_E_OK) || (out_len >= in_len)) {
-      compressed = 0;
+    data.result = lzo1x_1_compress(in, (lzo_uint)in_len, out, (lzo_uint *)&data.out_len, wrkmem);
+    if (!(data.result == LZO_E_OK) || (data.out_len >= in_len)) {
+      data.compressed = 0;
     }
     else {
-      compressed = 1;
+      data.compressed = 1;
     }
   }
 #endif
 #ifdef WITH_LZMA
   if (mode == PTCACHE_COMPRESS_LZMA) {
 
-    r = LzmaCompress(out,
-                     &out_len,
-                     in,
-                     in_len, /* Assume `sizeof(char) == 1`. */
-                     props,
-                     &sizeOfIt,
-                     5,
-                     1 << 24,
-                     3,
-                     0,
-                     2,
-                     32,
-                     2);
-
-    if (!(r == SZ_OK) || (out_len >= in_len)) {
-      compressed = 0;
+    data.result = LzmaCompress(out,
+                               &data.out_len,
+                               in,
+                               in_len, /* Assume `sizeof(char) == 1`. */
+                               data.props,
+                               &data.props_size,
+                               5,
+                               1 << 24,
+                               3,
+                               0,
+                               2,
+                               32,
+                               2);
+
+    if (!(data.result == SZ_OK) || (data.out_len >= in_len)) {
+      data.compressed = 0;
     }
     else {
-      compressed = 2;
+      data.compressed = 2;
     }
   }
 #endif
 
-  ptcache_file_write(pf, &compressed, 1, sizeof(uchar));
-  if (compressed) {
-    uint size = out_len;
+  return data;
+}
+
+static void ptcache_file_compressed_data_write(PTCacheFile *pf,
+                                               const uchar *in,
+                                               uint in_len,
+                                               const uchar *out,
+                                               const PTCacheCompressedData &data)
+{
+  ptcache_file_write(pf, &data.compressed, 1, sizeof(uchar));
+  if (data.compressed) {
+    uint size = data.out_len;
     ptcache_file_write(pf, &size, 1, sizeof(uint));
-    ptcache_file_write(pf, out, out_len, sizeof(uchar));
+    ptcache_file_write(pf, out, data.out_len, sizeof(uchar));
   }
   else {
     ptcache_file_write(pf, in, in_len, sizeof(uchar));
   }
 
-  if (compressed == 2) {
-    uint size = sizeOfIt;
-    ptcache_file_write(pf, &sizeOfIt, 1, sizeof(uint));
-    ptcache_file_write(pf, props, size, sizeof(uchar));
+  if (data.compressed == 2) {
+    uint size = data.props_size;
+    ptcache_file_write(pf, &data.props_size, 1, sizeof(uint));
+    ptcache_file_write(pf, data.props, size, sizeof(uchar));
   }
+}
 
-  MEM_freeN(props);
-
-  return r;
+static int ptcache_file_compressed_write(
+    PTCacheFile *pf, uchar *in, uint in_len, uchar *out, int mode)
+{
+  const PTCacheCompressedData data = ptcache_data_compress(in, in_len, out, mode);
+  ptcache_file_compressed_data_write(pf, in, in_len, out, data);
+  return data.result;
 }
 static int ptcache_file_read(PTCacheFile *pf, void *f, uint tot, uint size)
 {
@@ -2058,13 +2080,29 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
 
   if (!error) {
     if (pid->cache->compression) {
+      /* Compress the data arrays in parallel, but write them in order. */
+      uchar *out[BPHYS_TOT_DATA] = {nullptr};
+      PTCacheCompressedData compressed[BPHYS_TOT_DATA];
+      blender::threading::parallel_for(
+          blender::IndexRange(BPHYS_TOT_DATA), 1, [&](const blender::IndexRange range) {
+            for (const int64_t data_type : range) {
+              if (pm->data[data_type]) {
+                uint in_len = pm->totpoint * ptcache_data_size[data_type];
+                out[data_type] = (uchar *)MEM_callocN(LZO_OUT_LEN(in_len) * 4,
+                                                      "pointcache_lzo_buffer");
+                compressed[data_type] = ptcache_data_compress((uchar *)(pm->data[data_type]),
+                                                              in_len,
+                                                              out[data_type],
+                                                              pid->cache->compression);
+              }
+            }
+          });
       for (i = 0; i < BPHYS_TOT_DATA; i++) {
         if (pm->data[i]) {
           uint in_len = pm->totpoint * ptcache_data_size[i];
-          uchar *out = (uchar *)MEM_callocN(LZO_OUT_LEN(in_len) * 4, "pointcache_lzo_buffer");
-          ptcache_file_compressed_write(
-              pf, (uchar *)(pm->data[i]), in_len, out, pid->cache->compression);
-          MEM_freeN(out);
+          ptcache_file_compressed_data_write(
+              pf, (uchar *)(pm->data[i]), in_len, out[i], compressed[i]);
+          MEM_freeN(out[i]);
         }
       }
     }
@@ -1659,19 +1659,17 @@ static void rigidbody_update_sim_world(Scene *scene, RigidBodyWorld *rbw)
   rigidbody_update_ob_array(rbw);
 }
 
-static void rigidbody_update_sim_ob(Depsgraph *depsgraph, Object *ob, RigidBodyOb *rbo)
+/**
+ * \param view_layer: The input view layer of the depsgraph, which must already be synced. Only
+ * used to find selected objects, while they are being transformed.
+ */
+static void rigidbody_update_sim_ob(ViewLayer *view_layer, Object *ob, RigidBodyOb *rbo)
 {
   /* only update if rigid body exists */
   if (rbo->shared->physics_object == nullptr) {
     return;
   }
 
-  const Scene *scene = DEG_get_input_scene(depsgraph);
-  ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
-  BKE_view_layer_synced_ensure(scene, view_layer);
-  Base *base = BKE_view_layer_base_find(view_layer, ob);
-  const bool is_selected = base ? (base->flag & BASE_SELECTED) != 0 : false;
-
   if (rbo->shape == RB_SHAPE_TRIMESH && rbo->flag & RBO_FLAG_USE_DEFORM) {
     const Mesh *mesh = BKE_object_get_mesh_deform_eval(ob);
     if (mesh) {
@@ -1709,9 +1707,12 @@ static void rigidbody_update_sim_ob(Depsgraph *depsgraph, Object *ob, RigidBodyO
 
   /* Make transformed objects temporarily kinematic
    * so that they can be moved by the user during simulation. */
-  if (is_selected && (G.moving & G_TRANSFORM_OBJ)) {
-    RB_body_set_kinematic_state(static_cast<rbRigidBody *>(rbo->shared->physics_object), true);
-    RB_body_set_mass(static_cast<rbRigidBody *>(rbo->shared->physics_object), 0.0f);
+  if (G.moving & G_TRANSFORM_OBJ) {
+    Base *base = BKE_view_layer_base_find(view_layer, ob);
+    if (base && (base->flag & BASE_SELECTED)) {
+      RB_body_set_kinematic_state(static_cast<rbRigidBody *>(rbo->shared->physics_object), true);
+      RB_body_set_mass(static_cast<rbRigidBody *>(rbo->shared->physics_object), 0.0f);
+    }
   }
 
   /* NOTE: no other settings need to be explicitly updated here,
@@ -1759,6 +1760,10 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
     FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
   }
 
+  /* Sync the view layer once for all objects, it's only used to look up selected objects. */
+  ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
+  BKE_view_layer_synced_ensure(DEG_get_input_scene(depsgraph), view_layer);
+
   /* update objects */
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     if (ob->type == OB_MESH) {
@@ -1811,7 +1816,7 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
       rbo->flag &= ~(RBO_FLAG_NEEDS_VALIDATE | RBO_FLAG_NEEDS_RESHAPE);
 
       /* update simulation object... */
-      rigidbody_update_sim_ob(depsgraph, ob, rbo);
+      rigidbody_update_sim_ob(view_layer, ob, rbo);
     }
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
@@ -2021,6 +2026,11 @@ static void rigidbody_free_substep_data(ListBase *substep_targets)
 }
 static void rigidbody_update_simulation_post_step(Depsgraph *depsgraph, RigidBodyWorld *rbw)
 {
+  /* Only objects that are being transformed need their state to be reset. */
+  if (!(G.moving & G_TRANSFORM_OBJ)) {
+    return;
+  }
+
   const Scene *scene = DEG_get_input_scene(depsgraph);
   ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
   BKE_view_layer_synced_ensure(scene, view_layer);
@@ -2029,8 +2039,7 @@ static void rigidbody_update_simulation_post_step(Depsgraph *depsgraph, RigidBod
     Base *base = BKE_view_layer_base_find(view_layer, ob);
     RigidBodyOb *rbo = ob->rigidbody_object;
     /* Reset kinematic state for transformed objects. */
-    if (rbo && base && (base->flag & BASE_SELECTED) && (G.moving & G_TRANSFORM_OBJ) &&
-        rbo->shared->physics_object)
+    if (rbo && base && (base->flag & BASE_SELECTED) && rbo->shared->physics_object)
     {
       RB_body_set_kinematic_state(static_cast<rbRigidBody *>(rbo->shared->physics_object),
                                   rbo->flag & RBO_FLAG_KINEMATIC || rbo->flag & RBO_FLAG_DISABLED);
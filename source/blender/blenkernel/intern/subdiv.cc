@@ -11,6 +11,12 @@
 #include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 
+#include "BLI_array_state.hh"
+#include "BLI_vector.hh"
+
+#include "BKE_attribute.hh"
+#include "BKE_customdata.hh"
+#include "BKE_mesh_topology_state.hh"
 #include "BKE_subdiv_modifier.hh"
 
 #include "MEM_guardedalloc.h"
@@ -119,6 +125,7 @@ Subdiv *new_from_converter(const Settings *settings, OpenSubdiv_Converter *conve
   subdiv->topology_refiner = osd_topology_refiner;
   subdiv->evaluator = nullptr;
   subdiv->displacement_evaluator = nullptr;
+  subdiv->mesh_state = nullptr;
   stats_end(&stats, SUBDIV_STATS_TOPOLOGY_REFINER_CREATION_TIME);
   subdiv->stats = stats;
   return subdiv;
@@ -140,6 +147,80 @@ Subdiv *new_from_mesh(const Settings *settings, const Mesh *mesh)
   return subdiv;
 }
 
+/* --------------------------------------------------------------------
+ * Mesh state.
+ */
+
+/**
+ * Everything from the mesh that is used by the topology refiner. In common cases all of it is
+ * shared with the next evaluated mesh when only the positions change, which makes comparing it
+ * much cheaper than comparing the topology refiner with a new converter.
+ */
+struct MeshState {
+  MeshTopologyState topology;
+  ArrayState<float> vert_creases;
+  ArrayState<float> edge_creases;
+  Vector<ArrayState<float2>> uv_maps;
+
+  MeshState(const Settings &settings, const Mesh &mesh) : topology(mesh)
+  {
+    if (settings.use_creases) {
+      const AttributeAccessor attributes = mesh.attributes();
+      if (const AttributeReader attr = attributes.lookup<float>("crease_vert", AttrDomain::Point))
+      {
+        vert_creases = ArrayState<float>(attr.varray, attr.sharing_info);
+      }
+      if (const AttributeReader attr = attributes.lookup<float>("crease_edge", AttrDomain::Edge)) {
+        edge_creases = ArrayState<float>(attr.varray, attr.sharing_info);
+      }
+    }
+    for (const CustomDataLayer &layer : Span(mesh.corner_data.layers, mesh.corner_data.totlayer)) {
+      if (layer.type != CD_PROP_FLOAT2) {
+        continue;
+      }
+      const Span<float2> uvs(static_cast<const float2 *>(layer.data), mesh.corners_num);
+      uv_maps.append(ArrayState<float2>(VArray<float2>::ForSpan(uvs), layer.sharing_info));
+    }
+  }
+
+  bool same_as(const Settings &settings, const Mesh &mesh) const
+  {
+    if (!topology.same_topology_as(mesh)) {
+      return false;
+    }
+    if (settings.use_creases) {
+      const AttributeAccessor attributes = mesh.attributes();
+      const AttributeReader vert_attr = attributes.lookup<float>("crease_vert", AttrDomain::Point);
+      if (vert_attr ? !vert_creases.same_as(vert_attr.varray, vert_attr.sharing_info) :
+                      !vert_creases.is_empty())
+      {
+        return false;
+      }
+      const AttributeReader edge_attr = attributes.lookup<float>("crease_edge", AttrDomain::Edge);
+      if (edge_attr ? !edge_creases.same_as(edge_attr.varray, edge_attr.sharing_info) :
+                      !edge_creases.is_empty())
+      {
+        return false;
+      }
+    }
+    int uv_map_index = 0;
+    for (const CustomDataLayer &layer : Span(mesh.corner_data.layers, mesh.corner_data.totlayer)) {
+      if (layer.type != CD_PROP_FLOAT2) {
+        continue;
+      }
+      if (uv_map_index >= uv_maps.size()) {
+        return false;
+      }
+      const Span<float2> uvs(static_cast<const float2 *>(layer.data), mesh.corners_num);
+      if (!uv_maps[uv_map_index].same_as(VArray<float2>::ForSpan(uvs), layer.sharing_info)) {
+        return false;
+      }
+      uv_map_index++;
+    }
+    return uv_map_index == uv_maps.size();
+  }
+};
+
 /* Creation with cached-aware semantic. */
 
 Subdiv *update_from_converter(Subdiv *subdiv,
@@ -147,6 +228,11 @@ Subdiv *update_from_converter(Subdiv *subdiv,
                               OpenSubdiv_Converter *converter)
 {
 #ifdef WITH_OPENSUBDIV
+  if (subdiv != nullptr) {
+    /* The converter doesn't necessarily come from the remembered mesh. */
+    MEM_delete(subdiv->mesh_state);
+    subdiv->mesh_state = nullptr;
+  }
   /* Check if the existing descriptor can be re-used. */
   bool can_reuse_subdiv = true;
   if (subdiv != nullptr && subdiv->topology_refiner != nullptr) {
@@ -178,10 +264,27 @@ Subdiv *update_from_converter(Subdiv *subdiv,
 
 Subdiv *update_from_mesh(Subdiv *subdiv, const Settings *settings, const Mesh *mesh)
 {
+#ifdef WITH_OPENSUBDIV
+  if (subdiv != nullptr && subdiv->topology_refiner != nullptr && subdiv->mesh_state != nullptr &&
+      settings_equal(&subdiv->settings, settings))
+  {
+    stats_begin(&subdiv->stats, SUBDIV_STATS_TOPOLOGY_COMPARE);
+    const bool can_reuse_subdiv = subdiv->mesh_state->same_as(*settings, *mesh);
+    stats_end(&subdiv->stats, SUBDIV_STATS_TOPOLOGY_COMPARE);
+    if (can_reuse_subdiv) {
+      return subdiv;
+    }
+  }
+#endif
   OpenSubdiv_Converter converter;
   converter_init_for_mesh(&converter, settings, mesh);
   subdiv = update_from_converter(subdiv, settings, &converter);
   converter_free(&converter);
+#ifdef WITH_OPENSUBDIV
+  if (subdiv != nullptr) {
+    subdiv->mesh_state = MEM_new<MeshState>(__func__, *settings, *mesh);
+  }
+#endif
   return subdiv;
 }
 
@@ -200,6 +303,7 @@ void free(Subdiv *subdiv)
     delete subdiv->evaluator;
   }
   delete subdiv->topology_refiner;
+  MEM_delete(subdiv->mesh_state);
   displacement_detach(subdiv);
   if (subdiv->cache_.face_ptex_offset != nullptr) {
     MEM_freeN(subdiv->cache_.face_ptex_offset);
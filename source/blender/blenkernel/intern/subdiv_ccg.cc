@@ -836,13 +836,9 @@ static void subdiv_ccg_average_corners(SubdivCCG &subdiv_ccg,
 void BKE_subdiv_ccg_average_grids(SubdivCCG &subdiv_ccg)
 {
 #ifdef WITH_OPENSUBDIV
-  using namespace blender;
-  const CCGKey key = BKE_subdiv_ccg_key_top_level(subdiv_ccg);
   /* Average inner boundaries of grids (within one face), across faces
    * from different face-corners. */
   BKE_subdiv_ccg_average_stitch_faces(subdiv_ccg, subdiv_ccg.faces.index_range());
-  subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
-  subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
 #else
   UNUSED_VARS(subdiv_ccg);
 #endif
@@ -901,10 +897,14 @@ void BKE_subdiv_ccg_average_stitch_faces(SubdivCCG &subdiv_ccg, const IndexMask
   face_mask.foreach_index(GrainSize(512), [&](const int face_index) {
     subdiv_ccg_average_inner_face_grids(subdiv_ccg, key, subdiv_ccg.faces[face_index]);
   });
-  /* TODO(sergey): Only average elements which are adjacent to modified
-   * faces. */
-  subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
-  subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
+  if (face_mask.size() == subdiv_ccg.faces.size()) {
+    subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
+    subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
+  }
+  else {
+    /* Only average elements which are adjacent to modified faces. */
+    subdiv_ccg_average_faces_boundaries_and_corners(subdiv_ccg, key, face_mask);
+  }
 #else
   UNUSED_VARS(subdiv_ccg, face_mask);
 #endif
@@ -8,6 +8,8 @@
 
 #include "BKE_subdiv_eval.hh"
 
+#include "BLI_array_utils.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_math_vector.h"
 #include "BLI_task.h"
 
@@ -99,16 +101,11 @@ static void set_coarse_positions(Subdiv *subdiv,
         reinterpret_cast<const float *>(positions.data()), 0, positions.size());
     return;
   }
-  Array<float3> used_vert_positions(positions.size() - verts_no_face.count);
-  const BitSpan bits = verts_no_face.is_loose_bits;
-  int used_vert_count = 0;
-  for (const int vert : positions.index_range()) {
-    if (bits[vert]) {
-      continue;
-    }
-    used_vert_positions[used_vert_count] = positions[vert];
-    used_vert_count++;
-  }
+  IndexMaskMemory memory;
+  const IndexMask loose_verts = IndexMask::from_bits(verts_no_face.is_loose_bits, memory);
+  const IndexMask used_verts = loose_verts.complement(positions.index_range(), memory);
+  Array<float3> used_vert_positions(used_verts.size());
+  array_utils::gather(positions, used_verts, used_vert_positions.as_mutable_span());
   evaluator->eval_output->setCoarsePositions(
       reinterpret_cast<const float *>(used_vert_positions.data()), 0, used_vert_positions.size());
 }
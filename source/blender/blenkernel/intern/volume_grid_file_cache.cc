@@ -255,11 +255,16 @@ static GVolumeGrid get_cached_grid(const StringRef file_path,
   };
   /* This allows the returned grid to already contain meta-data and transforms, even if the tree is
    * not loaded yet. */
-  openvdb::GridBase::Ptr meta_data_and_transform_grid;
-  if (simplify_level == 0) {
-    /* Only pass the meta-data grid when there is no simplification for now. For simplified grids,
-     * the transform would have to be updated here already. */
-    meta_data_and_transform_grid = grid_cache.meta_data_grid->copyGrid();
+  openvdb::GridBase::Ptr meta_data_and_transform_grid = grid_cache.meta_data_grid->copyGrid();
+  if (simplify_level > 0) {
+    /* Compute the transform the simplified grid will have, so that it is known without having to
+     * load and resample the full resolution grid. This has to match
+     * #BKE_volume_grid_create_with_changed_resolution. */
+    const float resolution_factor = 1.0f / (1 << simplify_level);
+    openvdb::math::Transform::Ptr transform = meta_data_and_transform_grid->transform().copy();
+    transform->preScale(1.0f / resolution_factor);
+    transform->postTranslate(-transform->voxelSize() / 2.0f);
+    meta_data_and_transform_grid->setTransform(transform);
   }
   VolumeGridData *grid_data = MEM_new<VolumeGridData>(
       __func__, load_grid_fn, meta_data_and_transform_grid);
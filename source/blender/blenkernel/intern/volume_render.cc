@@ -114,7 +114,8 @@ static void create_texture_to_object_matrix(const openvdb::Mat4d &grid_transform
 
 bool BKE_volume_grid_dense_floats(const Volume *volume,
                                   const blender::bke::VolumeGridData *volume_grid,
-                                  DenseFloatVolumeGrid *r_dense_grid)
+                                  DenseFloatVolumeGrid *r_dense_grid,
+                                  const int max_resolution)
 {
 #ifdef WITH_OPENVDB
   const VolumeGridType grid_type = volume_grid->grid_type();
@@ -135,6 +136,10 @@ bool BKE_volume_grid_dense_floats(const Volume *volume,
   }
 
   const openvdb::Vec3i resolution = bbox.dim().asVec3i();
+  if (max_resolution > 0 && resolution.max() > max_resolution) {
+    /* Avoid allocating and filling a dense array that can't be used. */
+    return false;
+  }
   const int64_t num_voxels = int64_t(resolution[0]) * int64_t(resolution[1]) *
                              int64_t(resolution[2]);
   const int channels = blender::bke::volume_grid::get_channels_num(grid_type);
@@ -153,7 +158,7 @@ bool BKE_volume_grid_dense_floats(const Volume *volume,
   copy_v3_v3_int(r_dense_grid->resolution, resolution.asV());
   return true;
 #endif
-  UNUSED_VARS(volume, volume_grid, r_dense_grid);
+  UNUSED_VARS(volume, volume_grid, r_dense_grid, max_resolution);
   return false;
 }
 
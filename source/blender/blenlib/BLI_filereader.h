@@ -23,6 +23,7 @@
 typedef int64_t off64_t;
 #endif
 
+struct BLI_mmap_file;
 struct FileReader;
 
 typedef int64_t (*FileReaderReadFn)(struct FileReader *reader, void *buffer, size_t size);
@@ -50,6 +51,13 @@ typedef struct FileReader {
 FileReader *BLI_filereader_new_file(int filedes) ATTR_WARN_UNUSED_RESULT;
 /** Create #FileReader from raw file descriptor using memory-mapped IO. */
 FileReader *BLI_filereader_new_mmap(int filedes) ATTR_WARN_UNUSED_RESULT;
+/**
+ * Create #FileReader from an already memory-mapped file.
+ * The reader does not take ownership of \a mmap, it has to be kept alive by the caller until the
+ * reader is closed.
+ */
+FileReader *BLI_filereader_new_mmap_file(struct BLI_mmap_file *mmap) ATTR_WARN_UNUSED_RESULT
+    ATTR_NONNULL();
 /** Create #FileReader from a region of memory. */
 FileReader *BLI_filereader_new_memory(const void *data, size_t len) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL();
@@ -10,6 +10,7 @@
 
 #include "BLI_function_ref.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_span.hh"
 #include "BLI_sys_types.h"
 
 struct BVHTree;
@@ -144,6 +145,17 @@ BVHTree *BLI_bvhtree_new(int maxsize, float epsilon, char tree_type, char axis);
  * Construct: first insert points, then call balance.
  */
 void BLI_bvhtree_insert(BVHTree *tree, int index, const float co[3], int numpoints);
+/**
+ * Insert the leaves with the indices 0 to `leafs_num - 1` using multiple threads. This is
+ * equivalent to calling #BLI_bvhtree_insert for every index in order on an empty tree. #fn has to
+ * write the points of the given leaf into `r_co`, which has space for #max_points_num points, and
+ * return the number of points it wrote.
+ */
+void BLI_bvhtree_insert_parallel(
+    BVHTree *tree,
+    int leafs_num,
+    int max_points_num,
+    blender::FunctionRef<int(int index, blender::MutableSpan<blender::float3> r_co)> fn);
 void BLI_bvhtree_balance(BVHTree *tree);
 
 /**
@@ -299,4 +299,32 @@ template<typename Allocator = GuardedAllocator> class LinearAllocator : NonCopya
   }
 };
 
+/**
+ * Adapts a #LinearAllocator to the `Allocator` interface used by containers like #Vector and
+ * #Array (see `BLI_allocator.hh`). This is useful for temporary containers whose memory should be
+ * freed all at once together with the linear allocator, e.g. at the end of an evaluation.
+ *
+ * Deallocation does nothing, so containers that grow a lot leave their old buffers in the linear
+ * allocator. Reserving the final size up front avoids that.
+ *
+ * The adaptor has to be passed to the container constructor explicitly. The linear allocator has
+ * to outlive all containers using it and must not be used from multiple threads at the same time.
+ */
+template<typename Allocator = GuardedAllocator> class LinearAllocatorAdaptor {
+ private:
+  LinearAllocator<Allocator> *allocator_ = nullptr;
+
+ public:
+  LinearAllocatorAdaptor() = default;
+  LinearAllocatorAdaptor(LinearAllocator<Allocator> &allocator) : allocator_(&allocator) {}
+
+  void *allocate(const size_t size, const size_t alignment, const char * /*name*/)
+  {
+    BLI_assert_msg(allocator_ != nullptr, "The adaptor has to be constructed with an allocator");
+    return allocator_->allocate(int64_t(size), int64_t(alignment));
+  }
+
+  void deallocate(void * /*ptr*/) {}
+};
+
 }  // namespace blender
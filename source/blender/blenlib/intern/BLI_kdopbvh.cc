@@ -28,12 +28,14 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
 #include "BLI_heap_simple.h"
 #include "BLI_kdopbvh.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector_types.hh"
 #include "BLI_stack.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLI_strict_flags.h" /* IWYU pragma: keep. Keep last. */
@@ -58,6 +60,9 @@
 #  define KDOPBVH_THREAD_LEAF_THRESHOLD 1024
 #endif
 
+/** Branches covering more leafs than this compute their bounds in parallel while building. */
+#define KDOPBVH_THREAD_REFIT_THRESHOLD 65536
+
 /* -------------------------------------------------------------------- */
 /** \name Struct Definitions
  * \{ */
@@ -371,8 +376,65 @@ static void create_kdop_hull(
 /**
  * \note depends on the fact that the BVH's for each face is already built
  */
+/**
+ * Same as #refit_kdop_hull, but computes the bounds of the leafs in parallel. This is used for the
+ * first levels of the tree, which contain few branches that each cover many leafs.
+ */
+static void refit_kdop_hull_parallel(const BVHTree *tree, BVHNode *node, int start, int end)
+{
+  using namespace blender;
+  struct Bounds {
+    float bv[26];
+  };
+  const axis_t start_axis = tree->start_axis;
+  const axis_t stop_axis = tree->stop_axis;
+
+  Bounds identity = {};
+  for (axis_t axis_iter = start_axis; axis_iter < stop_axis; axis_iter++) {
+    identity.bv[2 * axis_iter] = FLT_MAX;
+    identity.bv[(2 * axis_iter) + 1] = -FLT_MAX;
+  }
+
+  const Bounds bounds = threading::parallel_reduce(
+      IndexRange::from_begin_end(start, end),
+      4096,
+      identity,
+      [&](const IndexRange range, const Bounds &init) {
+        Bounds result = init;
+        float *bv = result.bv;
+        for (const int64_t j : range) {
+          const float *__restrict node_bv = tree->nodes[j]->bv;
+          for (axis_t axis_iter = start_axis; axis_iter < stop_axis; axis_iter++) {
+            bv[2 * axis_iter] = std::min(node_bv[2 * axis_iter], bv[2 * axis_iter]);
+            bv[(2 * axis_iter) + 1] = std::max(node_bv[(2 * axis_iter) + 1],
+                                               bv[(2 * axis_iter) + 1]);
+          }
+        }
+        return result;
+      },
+      [&](const Bounds &a, const Bounds &b) {
+        Bounds result = {};
+        for (axis_t axis_iter = start_axis; axis_iter < stop_axis; axis_iter++) {
+          result.bv[2 * axis_iter] = std::min(a.bv[2 * axis_iter], b.bv[2 * axis_iter]);
+          result.bv[(2 * axis_iter) + 1] = std::max(a.bv[(2 * axis_iter) + 1],
+                                                    b.bv[(2 * axis_iter) + 1]);
+        }
+        return result;
+      });
+
+  for (axis_t axis_iter = start_axis; axis_iter < stop_axis; axis_iter++) {
+    node->bv[2 * axis_iter] = bounds.bv[2 * axis_iter];
+    node->bv[(2 * axis_iter) + 1] = bounds.bv[(2 * axis_iter) + 1];
+  }
+}
+
 static void refit_kdop_hull(const BVHTree *tree, BVHNode *node, int start, int end)
 {
+  if (end - start > KDOPBVH_THREAD_REFIT_THRESHOLD) {
+    refit_kdop_hull_parallel(tree, node, start, end);
+    return;
+  }
+
   float newmin, newmax;
   float *__restrict bv = node->bv;
   int j;
@@ -992,6 +1054,34 @@ void BLI_bvhtree_insert(BVHTree *tree, int index, const float co[3], int numpoin
   bvhtree_node_inflate(tree, node, tree->epsilon);
 }
 
+void BLI_bvhtree_insert_parallel(
+    BVHTree *tree,
+    const int leafs_num,
+    const int max_points_num,
+    const blender::FunctionRef<int(int index, blender::MutableSpan<blender::float3> r_co)> fn)
+{
+  using namespace blender;
+
+  /* Insert should only possible as long as tree->branch_num is 0 and no leaves have been inserted
+   * yet, because the leaves are stored at their index. */
+  BLI_assert(tree->branch_num <= 0);
+  BLI_assert(tree->leaf_num == 0);
+  BLI_assert(size_t(leafs_num) <= MEM_allocN_len(tree->nodes) / sizeof(*(tree->nodes)));
+
+  threading::parallel_for(IndexRange(leafs_num), 1024, [&](const IndexRange range) {
+    Array<float3, 4> co(max_points_num);
+    for (const int64_t i : range) {
+      const int points_num = fn(int(i), co);
+      BLI_assert(points_num <= max_points_num);
+      BVHNode *node = tree->nodes[i] = &(tree->nodearray[i]);
+      create_kdop_hull(tree, node, &co[0].x, points_num, 0);
+      node->index = int(i);
+      bvhtree_node_inflate(tree, node, tree->epsilon);
+    }
+  });
+  tree->leaf_num = leafs_num;
+}
+
 bool BLI_bvhtree_update_node(
     BVHTree *tree, int index, const float co[3], const float co_moving[3], int numpoints)
 {
@@ -36,6 +36,8 @@ struct BLI_mmap_file {
   /* Flag to indicate IO errors. Needs to be volatile since it's being set from
    * within the signal handler, which is not part of the normal execution flow. */
   volatile bool io_error;
+  /* The mapped memory is writable, see #BLI_mmap_open_copy_on_write. */
+  bool copy_on_write;
 };
 
 #ifndef WIN32
@@ -73,8 +75,9 @@ static void sigbus_handler(int sig, siginfo_t *siginfo, void *ptr)
       file->io_error = true;
 
       /* Replace the mapped memory with zeroes. */
+      const int prot = file->copy_on_write ? (PROT_READ | PROT_WRITE) : PROT_READ;
       const void *mapped_memory = mmap(
-          file->memory, file->length, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+          file->memory, file->length, prot, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
       if (mapped_memory == MAP_FAILED) {
         fprintf(stderr, "SIGBUS handler: Error replacing mapped file with zeros\n");
       }
@@ -130,7 +133,7 @@ static void sigbus_handler_remove(BLI_mmap_file *file)
 }
 #endif
 
-BLI_mmap_file *BLI_mmap_open(int fd)
+static BLI_mmap_file *mmap_open_impl(int fd, const bool copy_on_write)
 {
   void *memory, *handle = nullptr;
   const size_t length = BLI_lseek(fd, 0, SEEK_END);
@@ -145,7 +148,8 @@ BLI_mmap_file *BLI_mmap_open(int fd)
   }
 
   /* Map the given file to memory. */
-  memory = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  const int prot = copy_on_write ? (PROT_READ | PROT_WRITE) : PROT_READ;
+  memory = mmap(nullptr, length, prot, MAP_PRIVATE, fd, 0);
   if (memory == MAP_FAILED) {
     return nullptr;
   }
@@ -155,11 +159,12 @@ BLI_mmap_file *BLI_mmap_open(int fd)
   /* Memory mapping on Windows is a two-step process - first we create a mapping,
    * then we create a view into that mapping.
    * In our case, one view that spans the entire file is enough. */
-  handle = CreateFileMapping(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  handle = CreateFileMapping(
+      file_handle, nullptr, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
   if (handle == nullptr) {
     return nullptr;
   }
-  memory = MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+  memory = MapViewOfFile(handle, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
   if (memory == nullptr) {
     CloseHandle(handle);
     return nullptr;
@@ -171,6 +176,7 @@ BLI_mmap_file *BLI_mmap_open(int fd)
   file->memory = static_cast<char *>(memory);
   file->handle = handle;
   file->length = length;
+  file->copy_on_write = copy_on_write;
 
 #ifndef WIN32
   /* Register the file with the error handler. */
@@ -180,6 +186,16 @@ BLI_mmap_file *BLI_mmap_open(int fd)
   return file;
 }
 
+BLI_mmap_file *BLI_mmap_open(int fd)
+{
+  return mmap_open_impl(fd, false);
+}
+
+BLI_mmap_file *BLI_mmap_open_copy_on_write(int fd)
+{
+  return mmap_open_impl(fd, true);
+}
+
 bool BLI_mmap_read(BLI_mmap_file *file, void *dest, size_t offset, size_t length)
 {
   /* If a previous read has already failed or we try to read past the end,
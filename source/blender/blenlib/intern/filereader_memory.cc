@@ -129,3 +129,18 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   return (FileReader *)mem;
 }
+
+FileReader *BLI_filereader_new_mmap_file(BLI_mmap_file *mmap)
+{
+  MemoryReader *mem = MEM_callocN<MemoryReader>(__func__);
+
+  mem->mmap = mmap;
+  mem->length = BLI_mmap_get_length(mmap);
+
+  mem->reader.read = memory_read_mmap;
+  mem->reader.seek = memory_seek;
+  /* The memory-mapped file is owned by the caller. */
+  mem->reader.close = memory_close_raw;
+
+  return (FileReader *)mem;
+}
@@ -12,6 +12,8 @@
 
 #include "BLI_fileops.hh"
 #include "BLI_filereader.h"
+#include "BLI_task.hh"
+#include "BLI_threads.h"
 
 #ifdef __BIG_ENDIAN__
 #  include "BLI_endian_switch.h"
@@ -19,6 +21,20 @@
 
 #include "MEM_guardedalloc.h"
 
+/**
+ * Maximum number of frames which are decompressed at once (in parallel) when reading the file
+ * sequentially. Frames are written with a size of 1mb (see `ZSTD_CHUNK_SIZE` in `writefile.cc`),
+ * so this bounds the memory used by the read-ahead.
+ */
+#define ZSTD_READ_AHEAD_FRAMES_MAX 16
+
+/** Decompressed content of a contiguous range of frames. */
+struct ZstdFrameCache {
+  char *content[ZSTD_READ_AHEAD_FRAMES_MAX];
+  int first_frame;
+  int frames_num;
+};
+
 struct ZstdReader {
   FileReader reader;
 
@@ -33,8 +49,14 @@ struct ZstdReader {
     size_t *compressed_ofs;
     size_t *uncompressed_ofs;
 
-    char *cached_content;
-    int cached_frame;
+    /**
+     * Frames decompressed ahead of the current position, when reading sequentially.
+     * Random accesses (e.g. reading data on demand) use their own cache, so that they do not
+     * discard the read-ahead frames.
+     */
+    ZstdFrameCache read_ahead;
+    ZstdFrameCache random_access;
+    int read_ahead_frames_num;
   } seek;
 };
 
@@ -130,7 +152,8 @@ static bool zstd_read_seek_table(ZstdReader *zstd)
     return false;
   }
 
-  zstd->seek.cached_frame = -1;
+  zstd->seek.read_ahead_frames_num = std::clamp(
+      BLI_system_thread_count(), 1, ZSTD_READ_AHEAD_FRAMES_MAX);
 
   return true;
 }
@@ -158,42 +181,130 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
-/* Ensure that the currently loaded frame is the correct one. */
-static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
+static void zstd_frame_cache_clear(ZstdFrameCache *cache)
 {
-  if (zstd->seek.cached_frame == frame) {
-    /* Cached frame matches, so just return it. */
-    return zstd->seek.cached_content;
+  for (int i = 0; i < cache->frames_num; i++) {
+    MEM_freeN(cache->content[i]);
   }
+  cache->frames_num = 0;
+}
 
-  /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
-  MEM_SAFE_FREE(zstd->seek.cached_content);
+static const char *zstd_frame_cache_lookup(const ZstdFrameCache *cache, int frame)
+{
+  if (frame >= cache->first_frame && frame < cache->first_frame + cache->frames_num) {
+    return cache->content[frame - cache->first_frame];
+  }
+  return nullptr;
+}
 
-  size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
-  size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
-                             zstd->seek.uncompressed_ofs[frame];
+/**
+ * Read and decompress `frames_num` frames starting at `first_frame` into the given cache.
+ * The compressed frames are stored contiguously, so they are read at once, and then
+ * decompressed in parallel.
+ */
+static bool zstd_frame_cache_fill(ZstdReader *zstd,
+                                  ZstdFrameCache *cache,
+                                  const int first_frame,
+                                  const int frames_num)
+{
+  BLI_assert(frames_num > 0 && frames_num <= ZSTD_READ_AHEAD_FRAMES_MAX);
+  zstd_frame_cache_clear(cache);
+
+  const size_t *compressed_ofs = zstd->seek.compressed_ofs;
+  const size_t *uncompressed_ofs = zstd->seek.uncompressed_ofs;
+  const size_t compressed_size = compressed_ofs[first_frame + frames_num] -
+                                 compressed_ofs[first_frame];
 
-  char *uncompressed_data = static_cast<char *>(MEM_mallocN(uncompressed_size, __func__));
   char *compressed_data = static_cast<char *>(MEM_mallocN(compressed_size, __func__));
-  if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
+  if (zstd->base->seek(zstd->base, compressed_ofs[first_frame], SEEK_SET) < 0 ||
       zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
   {
     MEM_freeN(compressed_data);
-    MEM_freeN(uncompressed_data);
-    return nullptr;
+    return false;
   }
 
-  size_t res = ZSTD_decompressDCtx(
-      zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
+  bool frame_valid[ZSTD_READ_AHEAD_FRAMES_MAX];
+  auto decompress_frame = [&](const int i, ZSTD_DCtx *ctx) {
+    const int frame = first_frame + i;
+    const size_t frame_compressed_size = compressed_ofs[frame + 1] - compressed_ofs[frame];
+    const size_t frame_uncompressed_size = uncompressed_ofs[frame + 1] - uncompressed_ofs[frame];
+    const char *src = compressed_data + (compressed_ofs[frame] - compressed_ofs[first_frame]);
+
+    cache->content[i] = static_cast<char *>(MEM_mallocN(frame_uncompressed_size, __func__));
+    const size_t res = ctx ? ZSTD_decompressDCtx(ctx,
+                                                 cache->content[i],
+                                                 frame_uncompressed_size,
+                                                 src,
+                                                 frame_compressed_size) :
+                             ZSTD_decompress(cache->content[i],
+                                             frame_uncompressed_size,
+                                             src,
+                                             frame_compressed_size);
+    frame_valid[i] = !ZSTD_isError(res) && res >= frame_uncompressed_size;
+  };
+
+  if (frames_num == 1) {
+    decompress_frame(0, zstd->ctx);
+  }
+  else {
+    /* The shared decompression context cannot be used from multiple threads. */
+    blender::threading::parallel_for(
+        blender::IndexRange(frames_num), 1, [&](const blender::IndexRange range) {
+          for (const int64_t i : range) {
+            decompress_frame(int(i), nullptr);
+          }
+        });
+  }
   MEM_freeN(compressed_data);
-  if (ZSTD_isError(res) || res < uncompressed_size) {
-    MEM_freeN(uncompressed_data);
-    return nullptr;
+
+  /* Only keep the valid frames before the first invalid one. */
+  int valid_frames_num = 0;
+  while (valid_frames_num < frames_num && frame_valid[valid_frames_num]) {
+    valid_frames_num++;
+  }
+  for (int i = valid_frames_num; i < frames_num; i++) {
+    MEM_freeN(cache->content[i]);
   }
 
-  zstd->seek.cached_frame = frame;
-  zstd->seek.cached_content = uncompressed_data;
-  return uncompressed_data;
+  cache->first_frame = first_frame;
+  cache->frames_num = valid_frames_num;
+  return valid_frames_num > 0;
+}
+
+/* Ensure that the given frame is loaded, and return its content. */
+static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
+{
+  ZstdFrameCache *read_ahead = &zstd->seek.read_ahead;
+  ZstdFrameCache *random_access = &zstd->seek.random_access;
+
+  if (const char *content = zstd_frame_cache_lookup(read_ahead, frame)) {
+    return content;
+  }
+  if (const char *content = zstd_frame_cache_lookup(random_access, frame)) {
+    return content;
+  }
+
+  /* Reading the frame that follows the last decoded one is considered to be sequential reading,
+   * in which case the next frames are very likely to be needed soon. The first frame alone is
+   * not enough: only reading the file header and thumbnail (e.g. for file browser previews)
+   * should not decompress more than that frame. */
+  const bool is_sequential = (read_ahead->frames_num > 0 &&
+                              frame == read_ahead->first_frame + read_ahead->frames_num) ||
+                             (random_access->frames_num > 0 &&
+                              frame == random_access->first_frame + 1);
+  if (is_sequential) {
+    const int frames_num = std::min(zstd->seek.read_ahead_frames_num,
+                                    zstd->seek.frames_num - frame);
+    if (!zstd_frame_cache_fill(zstd, read_ahead, frame, frames_num)) {
+      return nullptr;
+    }
+    return read_ahead->content[0];
+  }
+
+  if (!zstd_frame_cache_fill(zstd, random_access, frame, 1)) {
+    return nullptr;
+  }
+  return random_access->content[0];
 }
 
 static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
@@ -286,10 +397,8 @@ static void zstd_close(FileReader *reader)
   if (zstd->reader.seek) {
     MEM_freeN(zstd->seek.uncompressed_ofs);
     MEM_freeN(zstd->seek.compressed_ofs);
-    /* When an error has occurred this may be nullptr, see: #99744. */
-    if (zstd->seek.cached_content) {
-      MEM_freeN(zstd->seek.cached_content);
-    }
+    zstd_frame_cache_clear(&zstd->seek.read_ahead);
+    zstd_frame_cache_clear(&zstd->seek.random_access);
   }
   else {
     MEM_freeN((void *)zstd->in_buf.src);
@@ -460,14 +460,27 @@ static int64_t from_bits_batch_predicate(const IndexMaskSegment universe_segment
      * that are not part of the universe are set to 0. */
     const int64_t segment_end = universe_segment.last() + 1;
     BitVector<max_segment_size> local_bits(segment_end - segment_start, false);
-    for (const int64_t i : universe_segment.index_range()) {
-      const int64_t global_index = universe_segment[i];
-      const int64_t local_index = global_index - segment_start;
-      BLI_assert(local_index < max_segment_size);
-      /* It's not great to handle each index separately instead of working with bigger
-       * chunks, but that works well enough for now. */
-      if (bits_slice[local_index]) {
-        local_bits[local_index].set();
+    const Span<int16_t> universe_indices = universe_segment.base_span();
+    const int64_t base_index = universe_indices[0];
+    /* Copy whole words for the parts of the universe that are ranges, and only handle the
+     * remaining indices separately. */
+    Vector<std::variant<IndexRange, Span<int16_t>>, 16> universe_parts;
+    unique_sorted_indices::split_to_ranges_and_spans<int16_t>(
+        universe_indices, 64, universe_parts);
+    for (const std::variant<IndexRange, Span<int16_t>> &part : universe_parts) {
+      if (std::holds_alternative<IndexRange>(part)) {
+        const IndexRange local_range = std::get<IndexRange>(part).shift(-base_index);
+        MutableBoundedBitSpan local_bits_span = local_bits;
+        local_bits_span.slice(local_range).copy_from(bits_slice.slice(local_range));
+      }
+      else {
+        for (const int16_t index : std::get<Span<int16_t>>(part)) {
+          const int64_t local_index = index - base_index;
+          BLI_assert(local_index < max_segment_size);
+          if (bits_slice[local_index]) {
+            local_bits[local_index].set();
+          }
+        }
       }
     }
     bits::bits_to_index_ranges<int16_t>(local_bits, builder);
@@ -10,6 +10,7 @@
 
 #include "BLI_kdtree_impl.h"
 #include "BLI_math_base.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -52,6 +53,9 @@ struct KDTree {
 
 #define KD_NODE_UNSET ((uint)-1)
 
+/** Sub-trees with more nodes than this are balanced in parallel. */
+#define KD_BALANCE_PARALLEL_THRESHOLD 8192
+
 /**
  * When set we know all values are unbalanced,
  * otherwise clear them when re-balancing: see #62210.
@@ -195,9 +199,14 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
   node = &nodes[median];
   node->d = axis;
   axis = (axis + 1) % KD_DIMS;
-  node->left = kdtree_balance(nodes, median, axis, ofs);
-  node->right = kdtree_balance(
-      nodes + median + 1, (nodes_len - (median + 1)), axis, (median + 1) + ofs);
+  /* Both halves are independent after partitioning, balance large ones in parallel. */
+  blender::threading::parallel_invoke(
+      nodes_len > KD_BALANCE_PARALLEL_THRESHOLD,
+      [&]() { node->left = kdtree_balance(nodes, median, axis, ofs); },
+      [&]() {
+        node->right = kdtree_balance(
+            nodes + median + 1, (nodes_len - (median + 1)), axis, (median + 1) + ofs);
+      });
 
   return median + ofs;
 }
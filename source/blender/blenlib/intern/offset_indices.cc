@@ -2,15 +2,77 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "BLI_array.hh"
 #include "BLI_array_utils.hh"
 #include "BLI_offset_indices.hh"
 #include "BLI_task.hh"
 
 namespace blender::offset_indices {
 
+/** Arrays with more counts than this are accumulated in two parallel passes. */
+static constexpr int64_t accumulate_parallel_threshold = 1 << 17;
+static constexpr int64_t accumulate_chunk_size = 1 << 14;
+
+/**
+ * Parallel version of #accumulate_counts_to_offsets. The first pass sums up the counts of each
+ * chunk, and the second pass writes the offsets of every chunk starting at its accumulated sum.
+ * Reading the counts twice is still faster than a serial scan on large arrays.
+ */
+static OffsetIndices<int> accumulate_counts_to_offsets_parallel(MutableSpan<int> counts_to_offsets,
+                                                                const int start_offset)
+{
+  const IndexRange counts_range = counts_to_offsets.index_range().drop_back(1);
+  const int64_t chunks_num = (counts_range.size() + accumulate_chunk_size - 1) /
+                             accumulate_chunk_size;
+  Array<int64_t> chunk_offsets(chunks_num);
+
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      const int64_t chunk_start = chunk * accumulate_chunk_size;
+      const IndexRange chunk_range = counts_range.slice(
+          chunk_start, std::min(accumulate_chunk_size, counts_range.size() - chunk_start));
+      int64_t sum = 0;
+      for (const int count : counts_to_offsets.slice(chunk_range)) {
+        BLI_assert(count >= 0);
+        sum += count;
+      }
+      chunk_offsets[chunk] = sum;
+    }
+  });
+
+  int64_t offset = start_offset;
+  for (int64_t &chunk_offset : chunk_offsets) {
+    const int64_t sum = chunk_offset;
+    chunk_offset = offset;
+    offset += sum;
+  }
+  BLI_assert_msg(offset <= std::numeric_limits<int>::max(), "Integer overflow occured");
+
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      const int64_t chunk_start = chunk * accumulate_chunk_size;
+      const IndexRange chunk_range = counts_range.slice(
+          chunk_start, std::min(accumulate_chunk_size, counts_range.size() - chunk_start));
+      int chunk_offset = int(chunk_offsets[chunk]);
+      for (int &value : counts_to_offsets.slice(chunk_range)) {
+        const int count = value;
+        value = chunk_offset;
+        chunk_offset += count;
+      }
+    }
+  });
+  counts_to_offsets.last() = int(offset);
+
+  return OffsetIndices<int>(counts_to_offsets);
+}
+
 OffsetIndices<int> accumulate_counts_to_offsets(MutableSpan<int> counts_to_offsets,
                                                 const int start_offset)
 {
+  if (counts_to_offsets.size() > accumulate_parallel_threshold) {
+    return accumulate_counts_to_offsets_parallel(counts_to_offsets, start_offset);
+  }
+
   int offset = start_offset;
   int64_t offset_i64 = start_offset;
 
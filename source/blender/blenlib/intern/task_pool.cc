@@ -121,15 +121,34 @@ void Task::operator()() const
  * Subclass since there seems to be no other way to set priority. */
 
 #ifdef WITH_TBB
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+/**
+ * In TBB 2021 priorities are only available as part of task arenas, no longer for task groups.
+ * Low priority pools all share one arena, so that worker threads prefer tasks from the default
+ * arena (e.g. depsgraph evaluation) and only pick up low priority work when they are idle.
+ */
+static tbb::task_arena &low_priority_task_arena()
+{
+  /* Intentionally never freed, it may still be used by pools destructed after exit. */
+  static tbb::task_arena *arena = new tbb::task_arena(
+      tbb::task_arena::automatic, 1, tbb::task_arena::priority::low);
+  return *arena;
+}
+#  endif
+
 class TBBTaskGroup : public tbb::task_group {
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+  /** Arena that tasks are run and waited on in, null for the default arena. */
+  tbb::task_arena *arena_ = nullptr;
+#  endif
+
  public:
   TBBTaskGroup(eTaskPriority priority)
   {
 #  if TBB_INTERFACE_VERSION_MAJOR >= 12
-    /* TODO: support priorities in TBB 2021, where they are only available as
-     * part of task arenas, no longer for task groups. Or remove support for
-     * task priorities if they are no longer useful. */
-    UNUSED_VARS(priority);
+    if (priority == TASK_PRIORITY_LOW) {
+      arena_ = &low_priority_task_arena();
+    }
 #  else
     switch (priority) {
       case TASK_PRIORITY_LOW:
@@ -141,6 +160,29 @@ class TBBTaskGroup : public tbb::task_group {
     }
 #  endif
   }
+
+  void run_task(Task &&task)
+  {
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+    if (arena_) {
+      arena_->execute([&]() { this->run(std::move(task)); });
+      return;
+    }
+#  endif
+    this->run(std::move(task));
+  }
+
+  void wait_tasks()
+  {
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+    /* Tasks of a group have to be waited on in the arena they were added to. */
+    if (arena_) {
+      arena_->execute([&]() { this->wait(); });
+      return;
+    }
+#  endif
+    this->wait();
+  }
 };
 #endif
 
@@ -366,7 +408,7 @@ void TaskPool::tbb_task_pool_run(Task &&task)
 #ifdef WITH_TBB
   else if (this->use_threads) {
     /* Execute in TBB task group. */
-    this->tbb_group->run(std::move(task));
+    this->tbb_group->run_task(std::move(task));
   }
 #endif
   else {
@@ -394,7 +436,7 @@ void TaskPool::tbb_task_pool_work_and_wait()
     /* This is called wait(), but internally it can actually do work. This
      * matters because we don't want recursive usage of task pools to run
      * out of threads and get stuck. */
-    this->tbb_group->wait();
+    this->tbb_group->wait_tasks();
   }
 #endif
 }
@@ -405,7 +447,7 @@ void TaskPool::tbb_task_pool_cancel()
 #ifdef WITH_TBB
   if (this->use_threads) {
     this->tbb_group->cancel();
-    this->tbb_group->wait();
+    this->tbb_group->wait_tasks();
   }
 #endif
 }
@@ -78,6 +78,31 @@ TEST(index_mask, FromBitsWithUniverse)
   EXPECT_EQ(mask[5], 102);
 }
 
+TEST(index_mask, FromBitsWithMixedUniverse)
+{
+  /* The universe contains long ranges as well as separate indices. */
+  IndexMaskMemory memory;
+  const IndexMask universe = IndexMask::from_predicate(
+      IndexRange(20'000), GrainSize(1024), memory, [](const int64_t i) {
+        return (i / 1000) % 2 == 0 || i % 7 == 0;
+      });
+  BitVector bit_vec(20'000, false);
+  for (const int64_t i : bit_vec.index_range()) {
+    bit_vec[i].set(i % 3 == 0);
+  }
+  const IndexMask mask = IndexMask::from_bits(universe, bit_vec, memory);
+
+  Vector<int64_t> expected;
+  universe.foreach_index([&](const int64_t i) {
+    if (bit_vec[i]) {
+      expected.append(i);
+    }
+  });
+  Array<int64_t> indices(mask.size());
+  mask.to_indices<int64_t>(indices);
+  EXPECT_EQ(indices.as_span(), expected.as_span());
+}
+
 TEST(index_mask, FromBitsSparse)
 {
   BitVector bit_vec(100'000, false);
@@ -4,6 +4,7 @@
 
 #include "testing/testing.h"
 
+#include "BLI_array.hh"
 #include "BLI_linear_allocator.hh"
 #include "BLI_rand.hh"
 
@@ -172,4 +173,19 @@ TEST(linear_allocator, TransferOwnership)
   EXPECT_EQ(values[index], value);
 }
 
+TEST(linear_allocator, ContainerAdaptor)
+{
+  LinearAllocator<> allocator;
+  Vector<int, 0, LinearAllocatorAdaptor<>> vec{LinearAllocatorAdaptor<>(allocator)};
+  for (const int i : IndexRange(1000)) {
+    vec.append(i);
+  }
+  EXPECT_EQ(vec.size(), 1000);
+  EXPECT_EQ(vec[999], 999);
+
+  Array<float, 0, LinearAllocatorAdaptor<>> array(100, 1.0f, LinearAllocatorAdaptor<>(allocator));
+  EXPECT_EQ(array[99], 1.0f);
+  EXPECT_TRUE(is_aligned(array.data(), uint(alignof(float))));
+}
+
 }  // namespace blender::tests
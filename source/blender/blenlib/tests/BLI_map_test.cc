@@ -777,6 +777,29 @@ TEST(map, AddCbMove)
   EXPECT_EQ(value, "");
 }
 
+TEST(map, StringKeysWithHashedSlots)
+{
+  Map<std::string, int> map;
+  for (int i = 0; i < 1000; i++) {
+    map.add_new(std::to_string(i), i);
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    EXPECT_TRUE(map.remove(std::to_string(i)));
+  }
+  /* Growing the map reuses the stored hashes. */
+  for (int i = 1000; i < 2000; i++) {
+    map.add_new(std::to_string(i), i);
+  }
+  EXPECT_EQ(map.size(), 1500);
+  EXPECT_FALSE(map.contains("0"));
+  EXPECT_EQ(map.lookup("1"), 1);
+  EXPECT_EQ(map.lookup(StringRef("1999")), 1999);
+
+  Map<std::string, int> map_copy = map;
+  EXPECT_EQ(map_copy.lookup("999"), 999);
+  EXPECT_EQ(map, map_copy);
+}
+
 /**
  * Set this to 1 to activate the benchmark. It is disabled by default, because it prints a lot.
  */
@@ -24,4 +24,21 @@ TEST(offset_indices, SumSizes)
   EXPECT_EQ(sum_group_sizes(offsets, IndexMask(1)), 3);
 }
 
+TEST(offset_indices, AccumulateLarge)
+{
+  /* Large enough to use the parallel code path. */
+  const int size = 1'000'003;
+  Vector<int> data(size);
+  for (const int i : data.index_range()) {
+    data[i] = i % 7;
+  }
+  const OffsetIndices<int> offsets = accumulate_counts_to_offsets(data, 5);
+  int expected_offset = 5;
+  for (const int i : offsets.index_range()) {
+    EXPECT_EQ(offsets[i].start(), expected_offset);
+    expected_offset += i % 7;
+  }
+  EXPECT_EQ(offsets.total_size(), expected_offset - 5);
+}
+
 }  // namespace blender::offset_indices::tests
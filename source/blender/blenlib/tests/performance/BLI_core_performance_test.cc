@@ -0,0 +1,178 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <atomic>
+#include <string>
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_array.hh"
+#include "BLI_index_mask.hh"
+#include "BLI_linear_allocator.hh"
+#include "BLI_map.hh"
+#include "BLI_set.hh"
+#include "BLI_task.hh"
+#include "BLI_timeit.hh"
+#include "BLI_vector.hh"
+#include "BLI_vector_set.hh"
+#include "BLI_virtual_array.hh"
+
+using namespace blender;
+
+/* Number of elements used by most tests, large enough to make the timings meaningful. */
+static constexpr int64_t ELEMENTS_NUM = 10'000'000;
+
+/* Deterministic, scattered keys so that lookups don't just walk memory linearly. */
+static int key_from_index(const int64_t i)
+{
+  return int((i * 2654435761u) & 0x7fffffff);
+}
+
+TEST(blenlib_core_performance, Containers)
+{
+  {
+    SCOPED_TIMER("Map add + lookup");
+    Map<int, int> map;
+    for (const int64_t i : IndexRange(ELEMENTS_NUM)) {
+      map.add(key_from_index(i), int(i));
+    }
+    int64_t found = 0;
+    for (const int64_t i : IndexRange(ELEMENTS_NUM)) {
+      found += map.contains(key_from_index(i));
+    }
+    EXPECT_EQ(found, ELEMENTS_NUM);
+  }
+  {
+    SCOPED_TIMER("Set add + lookup");
+    Set<int> set;
+    for (const int64_t i : IndexRange(ELEMENTS_NUM)) {
+      set.add(key_from_index(i));
+    }
+    int64_t found = 0;
+    for (const int64_t i : IndexRange(ELEMENTS_NUM)) {
+      found += set.contains(key_from_index(i));
+    }
+    EXPECT_EQ(found, ELEMENTS_NUM);
+  }
+  {
+    SCOPED_TIMER("VectorSet add + index_of");
+    VectorSet<int> vector_set;
+    for (const int64_t i : IndexRange(ELEMENTS_NUM)) {
+      vector_set.add(key_from_index(i));
+    }
+    int64_t index_sum = 0;
+    for (const int64_t i : IndexRange(ELEMENTS_NUM)) {
+      index_sum += vector_set.index_of(key_from_index(i));
+    }
+    EXPECT_EQ(index_sum, ELEMENTS_NUM * (ELEMENTS_NUM - 1) / 2);
+  }
+}
+
+TEST(blenlib_core_performance, IndexMask)
+{
+  IndexMaskMemory memory;
+  IndexMask mask;
+  {
+    SCOPED_TIMER("IndexMask from_predicate");
+    mask = IndexMask::from_predicate(
+        IndexRange(ELEMENTS_NUM), GrainSize(4096), memory, [](const int64_t i) {
+          return key_from_index(i) % 3 != 0;
+        });
+  }
+  {
+    SCOPED_TIMER("IndexMask foreach_segment");
+    std::atomic<int64_t> sum = 0;
+    mask.foreach_segment(GrainSize(4096), [&](const IndexMaskSegment segment) {
+      int64_t local_sum = 0;
+      for (const int64_t i : segment) {
+        local_sum += i & 1;
+      }
+      sum += local_sum;
+    });
+    EXPECT_GT(sum.load(), 0);
+  }
+}
+
+TEST(blenlib_core_performance, ParallelForOverhead)
+{
+  Array<int> values(ELEMENTS_NUM, 0);
+  for (const int64_t grain_size : {64, 1024, 65536}) {
+    SCOPED_TIMER("parallel_for grain size " + std::to_string(grain_size));
+    threading::parallel_for(values.index_range(), grain_size, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        values[i] += int(i & 0xff);
+      }
+    });
+  }
+  {
+    /* Many small loops, which mostly measures the cost of starting a parallel loop. */
+    SCOPED_TIMER("parallel_for small ranges");
+    for ([[maybe_unused]] const int iteration : IndexRange(10'000)) {
+      threading::parallel_for(IndexRange(512), 256, [&](const IndexRange range) {
+        for (const int64_t i : range) {
+          values[i]++;
+        }
+      });
+    }
+  }
+}
+
+TEST(blenlib_core_performance, LinearAllocator)
+{
+  const int64_t allocations_num = ELEMENTS_NUM / 10;
+  {
+    SCOPED_TIMER("LinearAllocator allocate");
+    LinearAllocator<> allocator;
+    for ([[maybe_unused]] const int64_t i : IndexRange(allocations_num)) {
+      int *value = allocator.allocate<int>();
+      *value = 0;
+    }
+  }
+  {
+    SCOPED_TIMER("MEM_mallocN + MEM_freeN");
+    Vector<int *> pointers;
+    pointers.reserve(allocations_num);
+    for ([[maybe_unused]] const int64_t i : IndexRange(allocations_num)) {
+      int *value = MEM_mallocN<int>(__func__);
+      *value = 0;
+      pointers.append(value);
+    }
+    for (int *value : pointers) {
+      MEM_freeN(value);
+    }
+  }
+}
+
+TEST(blenlib_core_performance, VArrayDevirtualize)
+{
+  Array<float> data(ELEMENTS_NUM);
+  for (const int64_t i : data.index_range()) {
+    data[i] = float(i % 100);
+  }
+  const VArray<float> varray = VArray<float>::ForSpan(data);
+  double expected_sum = 0.0;
+  for (const float value : data) {
+    expected_sum += value;
+  }
+  {
+    SCOPED_TIMER("VArray virtual get");
+    double sum = 0.0;
+    for (const int64_t i : varray.index_range()) {
+      sum += varray[i];
+    }
+    EXPECT_EQ(sum, expected_sum);
+  }
+  {
+    SCOPED_TIMER("VArray devirtualized");
+    double sum = 0.0;
+    devirtualize_varray(varray, [&](const auto &devirtualized) {
+      for (const int64_t i : varray.index_range()) {
+        sum += devirtualized[i];
+      }
+    });
+    EXPECT_EQ(sum, expected_sum);
+  }
+}
@@ -243,6 +243,19 @@ TEST(ghash, TextMap)
   str_map_tests(map, "StrMap - DefaultHash");
 }
 
+TEST(ghash, TextMapSimpleSlot)
+{
+  Map<StringRef,
+      int64_t,
+      default_inline_buffer_capacity(sizeof(StringRef) + sizeof(int64_t)),
+      DefaultProbingStrategy,
+      DefaultHash<StringRef>,
+      DefaultEquality<StringRef>,
+      SimpleMapSlot<StringRef, int64_t>>
+      map;
+  str_map_tests(map, "StrMap - DefaultHash, SimpleMapSlot");
+}
+
 /* Int: uniform 100M first integers. */
 
 static void int_ghash_tests(GHash *ghash, const char *id, const uint count)
@@ -371,6 +371,33 @@ const blender::ImplicitSharingInfo *BLO_read_shared(
   return shared_data.sharing_info;
 }
 
+blender::ImplicitSharingInfoAndData blo_read_shared_plain_data_impl(
+    BlendDataReader *reader,
+    const void **ptr_p,
+    int64_t size_in_bytes,
+    blender::FunctionRef<const blender::ImplicitSharingInfo *()> read_fn);
+
+/**
+ * Same as #BLO_read_shared, for an array of plain data (which does not contain any pointer, and
+ * does not need any processing after being read) of the given size.
+ *
+ * When the blend-file is memory-mapped (see #G_BACKGROUND_FILE_DATA_MMAP), the returned data may
+ * directly reference the mapped file instead of being copied. In that case, \a read_fn is not
+ * called.
+ */
+template<typename T>
+const blender::ImplicitSharingInfo *BLO_read_shared_plain_data(
+    BlendDataReader *reader,
+    T **data_ptr,
+    const int64_t size_in_bytes,
+    blender::FunctionRef<const blender::ImplicitSharingInfo *()> read_fn)
+{
+  blender::ImplicitSharingInfoAndData shared_data = blo_read_shared_plain_data_impl(
+      reader, (const void **)data_ptr, size_in_bytes, read_fn);
+  *data_ptr = const_cast<T *>(static_cast<const T *>(shared_data.data));
+  return shared_data.sharing_info;
+}
+
 int BLO_read_fileversion_get(BlendDataReader *reader);
 bool BLO_read_requires_endian_switch(BlendDataReader *reader);
 bool BLO_read_data_is_undo(BlendDataReader *reader);
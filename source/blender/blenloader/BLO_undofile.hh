@@ -35,6 +35,12 @@ struct MemFileChunk {
   size_t size;
   /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
   bool is_identical;
+  /**
+   * When true, this chunk doesn't own the memory either, but it was found from its content in a
+   * different position of the previous step (or earlier in the same step). Unlike #is_identical,
+   * this does not mean the data at this position is unchanged.
+   */
+  bool is_shared;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
    * detect unchanged IDs).
    * Defined when writing the next step (i.e. last undo step has those always false). */
@@ -42,6 +48,8 @@ struct MemFileChunk {
   /** Session UID of the ID being currently written (MAIN_ID_SESSION_UID_UNSET when not writing
    * ID-related data). Used to find matching chunks in previous memundo step. */
   uint id_session_uid;
+  /** Hash of the content of #buf, used to share identical buffers regardless of position. */
+  uint64_t hash;
 };
 
 struct MemFile {
@@ -63,6 +71,8 @@ struct MemFileWriteData {
 
   /** Maps an ID session uid to its first reference MemFileChunk, if existing. */
   blender::Map<uint, MemFileChunk *> id_session_uid_mapping;
+  /** Maps content hashes to the chunks of the reference and written memfiles having it. */
+  blender::Map<uint64_t, MemFileChunk *> chunk_by_hash;
 };
 
 struct MemFileUndoData {
@@ -217,36 +217,52 @@ PreviewImage *BLO_blendhandle_get_preview_for_id(BlendHandle *bh,
                                                  const char *name)
 {
   FileData *fd = (FileData *)bh;
-  bool looking = false;
   const int sdna_preview_image = DNA_struct_find_with_alias(fd->filesdna, "PreviewImage");
 
-  for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
-    if (bhead->code == BLO_CODE_DATA) {
-      if (looking && bhead->SDNAnr == sdna_preview_image) {
-        PreviewImage *preview_from_file = static_cast<PreviewImage *>(
-            BLO_library_read_struct(fd, bhead, "PreviewImage"));
-
-        if (preview_from_file == nullptr) {
+  /* Find the ID block first, linkable IDs can be looked up directly by name which avoids going
+   * over all blocks of the file when a preview of every ID of a library is requested. */
+  BHead *id_bhead = nullptr;
+  if (BKE_idtype_idcode_is_linkable(ofblocktype)) {
+    id_bhead = blo_bhead_find_linkable_id(fd, ofblocktype, name);
+  }
+  else {
+    for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+      if (bhead->code == BLO_CODE_ENDB) {
+        break;
+      }
+      if (bhead->code == ofblocktype) {
+        const char *idname = blo_bhead_id_name(fd, bhead);
+        if (STREQ(&idname[2], name)) {
+          id_bhead = bhead;
           break;
         }
-
-        PreviewImage *result = static_cast<PreviewImage *>(MEM_dupallocN(preview_from_file));
-        result->runtime = MEM_new<blender::bke::PreviewImageRuntime>(__func__);
-        bhead = blo_blendhandle_read_preview_rects(fd, bhead, result, preview_from_file);
-        MEM_freeN(preview_from_file);
-        return result;
       }
     }
-    else if (looking || bhead->code == BLO_CODE_ENDB) {
+  }
+  if (id_bhead == nullptr) {
+    return nullptr;
+  }
+
+  /* The preview is stored in the data blocks directly following the ID block. */
+  for (BHead *bhead = blo_bhead_next(fd, id_bhead); bhead; bhead = blo_bhead_next(fd, bhead)) {
+    if (bhead->code != BLO_CODE_DATA) {
       /* We were looking for a preview image, but didn't find any belonging to block. So it doesn't
        * exist. */
       break;
     }
-    else if (bhead->code == ofblocktype) {
-      const char *idname = blo_bhead_id_name(fd, bhead);
-      if (STREQ(&idname[2], name)) {
-        looking = true;
+    if (bhead->SDNAnr == sdna_preview_image) {
+      PreviewImage *preview_from_file = static_cast<PreviewImage *>(
+          BLO_library_read_struct(fd, bhead, "PreviewImage"));
+
+      if (preview_from_file == nullptr) {
+        break;
       }
+
+      PreviewImage *result = static_cast<PreviewImage *>(MEM_dupallocN(preview_from_file));
+      result->runtime = MEM_new<blender::bke::PreviewImageRuntime>(__func__);
+      bhead = blo_blendhandle_read_preview_rects(fd, bhead, result, preview_from_file);
+      MEM_freeN(preview_from_file);
+      return result;
     }
   }
 
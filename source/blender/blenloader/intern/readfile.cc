@@ -14,6 +14,7 @@
 #include <cstdlib> /* for atoi. */
 #include <ctime>   /* for gmtime. */
 #include <fcntl.h> /* for open flags (O_BINARY, O_RDONLY). */
+#include <sstream>
 
 #ifndef WIN32
 #  include <unistd.h> /* for read close */
@@ -48,13 +49,18 @@
 #include "BLI_endian_switch.h"
 #include "BLI_fileops.h"
 #include "BLI_ghash.h"
+#include "BLI_implicit_sharing.hh"
 #include "BLI_map.hh"
 #include "BLI_memarena.h"
+#include "BLI_mmap.h"
+#include "BLI_serialize.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -205,6 +211,52 @@ struct BHeadN {
  */
 #define BHEAD_USE_READ_ON_DEMAND(bhead) ((bhead)->code == BLO_CODE_DATA)
 
+/**
+ * Minimum size of the data blocks which can directly reference the memory-mapped file,
+ * see #G_BACKGROUND_FILE_DATA_MMAP. Smaller blocks are not worth the sharing overhead.
+ */
+#define READ_DATA_MMAP_MIN_SIZE (64 * 1024)
+/**
+ * Required alignment of the data blocks in the file for them to be directly referenced. Data is
+ * not padded in blend-files, so blocks which are not aligned are still copied.
+ */
+#define READ_DATA_MMAP_ALIGNMENT 8
+
+/**
+ * A memory-mapped blend-file (using copy-on-write pages), kept alive as long as some data
+ * references it.
+ */
+struct MappedBlendFile : public blender::ImplicitSharingMixin {
+  BLI_mmap_file *mmap_file;
+
+  MappedBlendFile(BLI_mmap_file *mmap_file) : mmap_file(mmap_file) {}
+
+ private:
+  void delete_self() override
+  {
+    BLI_mmap_free(mmap_file);
+    MEM_delete(this);
+  }
+};
+
+/** Sharing info of an array which directly references the content of a memory-mapped file. */
+class MappedDataSharingInfo : public blender::ImplicitSharingInfo {
+  const MappedBlendFile *mapped_file_;
+
+ public:
+  MappedDataSharingInfo(const MappedBlendFile *mapped_file) : mapped_file_(mapped_file)
+  {
+    mapped_file_->add_user();
+  }
+
+ private:
+  void delete_self_with_data() override
+  {
+    mapped_file_->remove_user_and_delete_if_last();
+    MEM_delete(this);
+  }
+};
+
 /* -------------------------------------------------------------------- */
 /** \name Blend Loader Reporting Wrapper
  * \{ */
@@ -239,6 +291,79 @@ static const char *library_parent_filepath(Library *lib)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Load Profiling
+ *
+ * Enabled with #G_DEBUG_IO_LOAD (`--debug-load`), see #BlendFileReadProfile.
+ * \{ */
+
+/**
+ * Adds the time spent in its scope to an entry of the load profile of the file.
+ * Does nothing when profiling is disabled.
+ */
+class ReadProfileTimer {
+  BlendFileReadProfile *profile_;
+  BlendFileReadProfile::Category category_;
+  blender::StringRef name_;
+  double start_time_ = 0.0;
+  int64_t bytes_ = 0;
+
+ public:
+  ReadProfileTimer(const FileData *fd,
+                   const BlendFileReadProfile::Category category,
+                   const blender::StringRef name)
+      : profile_(fd ? fd->profile.get() : nullptr), category_(category), name_(name)
+  {
+    if (profile_) {
+      start_time_ = BLI_time_now_seconds();
+    }
+  }
+
+  ~ReadProfileTimer()
+  {
+    if (profile_) {
+      /* Look the entry up only now, nested timers may have reallocated the map. */
+      BlendFileReadProfile::Entry &entry =
+          profile_->categories[category_].lookup_or_add_default(name_);
+      entry.duration += BLI_time_now_seconds() - start_time_;
+      entry.bytes += bytes_;
+      entry.count++;
+    }
+  }
+
+  void add_bytes(const int64_t bytes)
+  {
+    bytes_ += bytes;
+  }
+};
+
+static void read_profile_print(const BlendFileReadProfile &profile, const char *filepath)
+{
+  using namespace blender::io::serialize;
+  static const char *category_names[BlendFileReadProfile::CATEGORIES_NUM] = {
+      "stages", "id_types", "versioning", "libraries"};
+
+  DictionaryValue root;
+  root.append_str("filepath", filepath);
+  for (const int category : blender::IndexRange(BlendFileReadProfile::CATEGORIES_NUM)) {
+    std::shared_ptr<DictionaryValue> category_value = root.append_dict(category_names[category]);
+    for (const auto item : profile.categories[category].items()) {
+      std::shared_ptr<DictionaryValue> entry_value = category_value->append_dict(item.key);
+      entry_value->append_double("duration", item.value.duration);
+      entry_value->append_int("bytes", item.value.bytes);
+      entry_value->append_int("count", item.value.count);
+    }
+  }
+
+  std::stringstream stream;
+  JsonFormatter formatter;
+  formatter.indentation_len = 2;
+  formatter.serialize(stream, root);
+  printf("Blend file load profile:\n%s\n", stream.str().c_str());
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name OldNewMap API
  * \{ */
@@ -336,6 +461,13 @@ static void oldnewmap_free(OldNewMap *onm)
 /** \name Helper Functions
  * \{ */
 
+/** Free all the data of the last read ID that has not been used. */
+static void read_data_clear(FileData *fd)
+{
+  oldnewmap_clear(fd->datamap);
+  fd->mapped_data_blocks.clear();
+}
+
 static void add_main_to_main(Main *mainvar, Main *from)
 {
   if (from->is_read_invalid) {
@@ -1264,10 +1396,21 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
   /* Rewind the file after reading the header. */
   rawfile->seek(rawfile, 0, SEEK_SET);
 
+  MappedBlendFile *mapped_file = nullptr;
+
   /* Check if we have a regular file. */
   if (memcmp(header, "BLENDER", sizeof(header)) == 0) {
     /* Try opening the file with memory-mapped IO. */
-    file = BLI_filereader_new_mmap(filedes);
+    if (G.background && (G.fileflags & G_BACKGROUND_FILE_DATA_MMAP)) {
+      /* Use copy-on-write pages, so that data referencing the file directly can be modified. */
+      if (BLI_mmap_file *mmap_file = BLI_mmap_open_copy_on_write(filedes)) {
+        mapped_file = MEM_new<MappedBlendFile>(__func__, mmap_file);
+        file = BLI_filereader_new_mmap_file(mmap_file);
+      }
+    }
+    else {
+      file = BLI_filereader_new_mmap(filedes);
+    }
     if (file == nullptr) {
       /* `mmap` failed, so just keep using `rawfile`. */
       file = rawfile;
@@ -1298,6 +1441,7 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
 
   FileData *fd = filedata_new(reports);
   fd->file = file;
+  fd->mapped_file = mapped_file;
 
   return fd;
 }
@@ -1413,6 +1557,10 @@ void blo_filedata_free(FileData *fd)
   }
 #endif
   fd->file->close(fd->file);
+  if (fd->mapped_file) {
+    /* The mapped file may still be referenced by some loaded data. */
+    fd->mapped_file->remove_user_and_delete_if_last();
+  }
 
   if (fd->filesdna) {
     DNA_sdna_free(fd->filesdna);
@@ -1497,16 +1645,37 @@ short BLO_version_from_file(const char *filepath)
 /** \name Old/New Pointer Map
  * \{ */
 
+/**
+ * Copy the content of a data block kept in the memory-mapped file into the datamap, when it is
+ * accessed through the regular reading API.
+ */
+static void *read_mapped_data_block(FileData *fd, const void *adr, const bool increase_users)
+{
+  const std::optional<MappedDataBlock> block = fd->mapped_data_blocks.pop_try(adr);
+  if (!block) {
+    return nullptr;
+  }
+  void *data = read_struct(fd, block->bhead, block->blockname, block->id_type_index);
+  oldnewmap_insert(fd->datamap, adr, data, increase_users ? 1 : 0);
+  return data;
+}
+
 /* Only direct data-blocks. */
 static void *newdataadr(FileData *fd, const void *adr)
 {
-  return oldnewmap_lookup_and_inc(fd->datamap, adr, true);
+  if (void *data = oldnewmap_lookup_and_inc(fd->datamap, adr, true)) {
+    return data;
+  }
+  return fd->mapped_data_blocks.is_empty() ? nullptr : read_mapped_data_block(fd, adr, true);
 }
 
 /* Only direct data-blocks. */
 static void *newdataadr_no_us(FileData *fd, const void *adr)
 {
-  return oldnewmap_lookup_and_inc(fd->datamap, adr, false);
+  if (void *data = oldnewmap_lookup_and_inc(fd->datamap, adr, false)) {
+    return data;
+  }
+  return fd->mapped_data_blocks.is_empty() ? nullptr : read_mapped_data_block(fd, adr, false);
 }
 
 void *blo_read_get_new_globaldata_address(FileData *fd, const void *adr)
@@ -2579,29 +2748,182 @@ static bool direct_link_id(FileData *fd,
   return success;
 }
 
-/* Read all data associated with a datablock into datamap. */
+/**
+ * Maximum amount of block data loaded on demand and kept in memory, while waiting for its
+ * conversion in #read_data_into_datamap.
+ */
+#define READ_DATA_CONVERT_BATCH_SIZE (64 * 1024 * 1024)
+
+/** A data block of an ID, as processed by #read_data_into_datamap. */
+struct ReadDataBlock {
+  BHead *bhead;
+  /**
+   * Block with its content fully loaded, when it needs to be converted. Either the same as
+   * #bhead, or a temporary copy (owned by this struct) if its content was read on demand.
+   */
+  BHead *bhead_full;
+  const char *alloc_name;
+  void *data;
+};
+
+/**
+ * Whether the content of this block can be directly referenced from the memory-mapped file,
+ * instead of being read now, see #G_BACKGROUND_FILE_DATA_MMAP.
+ */
+static bool read_data_block_can_be_mapped(const FileData *fd, const BHead *bh)
+{
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  if (fd->mapped_file == nullptr || bh->len < READ_DATA_MMAP_MIN_SIZE) {
+    return false;
+  }
+  if ((fd->flags & FD_FLAGS_SWITCH_ENDIAN) || fd->compflags[bh->SDNAnr] != SDNA_CMP_EQUAL) {
+    return false;
+  }
+  const BHeadN *bheadn = BHEADN_FROM_BHEAD(bh);
+  /* Only blocks which are read on demand are not already copied in memory. */
+  return !bheadn->has_data && (bheadn->file_offset % READ_DATA_MMAP_ALIGNMENT) == 0 &&
+         !fd->mapped_data_blocks.contains(bh->old);
+#else
+  UNUSED_VARS(fd, bh);
+  return false;
+#endif
+}
+
+/**
+ * Whether reading the content of this block requires processing it (endian switching and/or DNA
+ * struct reconstruction), rather than simply copying it from the file.
+ */
+static bool read_struct_needs_conversion(const FileData *fd, const BHead *bh)
+{
+  if (bh->len == 0 || fd->compflags[bh->SDNAnr] == SDNA_CMP_REMOVED) {
+    return false;
+  }
+  if (bh->SDNAnr > SDNA_RAW_DATA_STRUCT_INDEX && (fd->flags & FD_FLAGS_SWITCH_ENDIAN)) {
+    return true;
+  }
+  return fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL;
+}
+
+/**
+ * Same as #read_struct, for a block which content is already fully loaded in memory.
+ *
+ * Does not modify the #FileData, so it is safe to call it concurrently for different blocks.
+ */
+static void *read_struct_convert(const FileData *fd, BHead *bh, const char *alloc_name)
+{
+  if (bh->SDNAnr > SDNA_RAW_DATA_STRUCT_INDEX && (fd->flags & FD_FLAGS_SWITCH_ENDIAN)) {
+    switch_endian_structs(fd->filesdna, bh);
+  }
+  if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
+    return DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1), alloc_name);
+  }
+  const int alignment = DNA_struct_alignment(fd->filesdna, bh->SDNAnr);
+  void *temp = MEM_mallocN_aligned(bh->len, alignment, alloc_name);
+  memcpy(temp, (bh + 1), bh->len);
+  return temp;
+}
+
+/**
+ * Convert all pending blocks that need it in parallel, then insert all of them in the datamap, in
+ * file order.
+ */
+static void read_data_into_datamap_flush(FileData *fd,
+                                         blender::Vector<ReadDataBlock> &blocks,
+                                         blender::Vector<int64_t> &convert_indices)
+{
+  blender::threading::parallel_for(
+      convert_indices.index_range(),
+      256 * 1024,
+      [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          ReadDataBlock &block = blocks[convert_indices[i]];
+          block.data = read_struct_convert(fd, block.bhead_full, block.alloc_name);
+        }
+      },
+      blender::threading::individual_task_sizes(
+          [&](const int64_t i) { return int64_t(blocks[convert_indices[i]].bhead->len); },
+          convert_indices.size()));
+
+  for (ReadDataBlock &block : blocks) {
+#ifdef USE_BHEAD_READ_ON_DEMAND
+    if (block.bhead_full && block.bhead_full != block.bhead) {
+      MEM_freeN(BHEADN_FROM_BHEAD(block.bhead_full));
+    }
+#endif
+    if (block.data) {
+      const bool is_new = oldnewmap_insert(fd->datamap, block.bhead->old, block.data, 0);
+      if (!is_new) {
+        CLOG_ERROR(&LOG,
+                   "Blendfile corruption: Invalid, or multiple `bhead` with same old address "
+                   "value (%p) for a given ID.",
+                   block.bhead->old);
+      }
+    }
+  }
+
+  blocks.clear();
+  convert_indices.clear();
+}
+
+/**
+ * Read all data associated with a datablock into datamap.
+ *
+ * Reading the blocks from the file is sequential, but their conversion (endian switching and DNA
+ * struct reconstruction, typically needed when loading files from older versions of Blender) is
+ * dispatched over multiple threads. Blocks are always added to the datamap in file order.
+ */
 static BHead *read_data_into_datamap(FileData *fd,
                                      BHead *bhead,
                                      const char *allocname,
                                      const int id_type_index)
 {
+  blender::Vector<ReadDataBlock> blocks;
+  blender::Vector<int64_t> convert_indices;
+  int64_t loaded_on_demand_size = 0;
+
   bhead = blo_bhead_next(fd, bhead);
 
   while (bhead && bhead->code == BLO_CODE_DATA) {
-    void *data = read_struct(fd, bhead, allocname, id_type_index);
-    if (data) {
-      const bool is_new = oldnewmap_insert(fd->datamap, bhead->old, data, 0);
-      if (!is_new) {
-        CLOG_ERROR(&LOG,
-                   "Blendfile corruption: Invalid, or multiple `bhead` with same old address "
-                   "value (%p) for a given ID.",
-                   bhead->old);
+    ReadDataBlock block = {bhead, nullptr, nullptr, nullptr};
+    if (read_data_block_can_be_mapped(fd, bhead)) {
+      /* Only read when actually accessed, see #newdataadr and #blo_read_shared_plain_data_impl. */
+      fd->mapped_data_blocks.add_new(bhead->old, {bhead, allocname, id_type_index});
+      bhead = blo_bhead_next(fd, bhead);
+      continue;
+    }
+    if (read_struct_needs_conversion(fd, bhead)) {
+      block.bhead_full = bhead;
+#ifdef USE_BHEAD_READ_ON_DEMAND
+      if (BHEADN_FROM_BHEAD(bhead)->has_data == false) {
+        block.bhead_full = blo_bhead_read_full(fd, bhead);
+        if (UNLIKELY(block.bhead_full == nullptr)) {
+          fd->flags &= ~FD_FLAGS_FILE_OK;
+        }
+        else {
+          loaded_on_demand_size += bhead->len;
+        }
+      }
+#endif
+      if (block.bhead_full) {
+        block.alloc_name = get_alloc_name(fd, bhead, allocname, id_type_index);
+        convert_indices.append(blocks.size());
       }
     }
+    else {
+      block.data = read_struct(fd, bhead, allocname, id_type_index);
+    }
+    blocks.append(block);
+
+    if (loaded_on_demand_size > READ_DATA_CONVERT_BATCH_SIZE) {
+      read_data_into_datamap_flush(fd, blocks, convert_indices);
+      loaded_on_demand_size = 0;
+    }
 
     bhead = blo_bhead_next(fd, bhead);
   }
 
+  read_data_into_datamap_flush(fd, blocks, convert_indices);
+
   return bhead;
 }
 
@@ -2980,13 +3302,13 @@ static bool read_libblock_undo_restore(
  * When reading for undo, libraries, linked datablocks and unchanged datablocks
  * will be restored from the old database. Only new or changed datablocks will
  * actually be read. */
-static BHead *read_libblock(FileData *fd,
-                            Main *main,
-                            BHead *bhead,
-                            int id_tag,
-                            ID_Readfile_Data::Tags id_read_tags,
-                            const bool placeholder_set_indirect_extern,
-                            ID **r_id)
+static BHead *read_libblock_impl(FileData *fd,
+                                 Main *main,
+                                 BHead *bhead,
+                                 int id_tag,
+                                 ID_Readfile_Data::Tags id_read_tags,
+                                 const bool placeholder_set_indirect_extern,
+                                 ID **r_id)
 {
   const bool do_partial_undo = (fd->skip_flags & BLO_READ_SKIP_UNDO_OLD_MAIN) == 0;
 
@@ -3082,7 +3404,7 @@ static BHead *read_libblock(FileData *fd,
    * Use convenient malloc name for debugging and better memory link prints. */
   bhead = read_data_into_datamap(fd, bhead, blockname, id_type_index);
   const bool success = direct_link_id(fd, main, id_tag, id_read_tags, id, id_old);
-  oldnewmap_clear(fd->datamap);
+  read_data_clear(fd);
 
   if (!success) {
     /* XXX This is probably working OK currently given the very limited scope of that flag.
@@ -3110,6 +3432,37 @@ static BHead *read_libblock(FileData *fd,
   return bhead;
 }
 
+/**
+ * Read an ID block and all its data blocks, see #read_libblock_impl. Also accounts for the time
+ * and bytes spent per ID type when profiling is enabled.
+ */
+static BHead *read_libblock(FileData *fd,
+                            Main *main,
+                            BHead *bhead,
+                            int id_tag,
+                            ID_Readfile_Data::Tags id_read_tags,
+                            const bool placeholder_set_indirect_extern,
+                            ID **r_id)
+{
+  if (!fd->profile) {
+    return read_libblock_impl(
+        fd, main, bhead, id_tag, id_read_tags, placeholder_set_indirect_extern, r_id);
+  }
+
+  const char *idtype_name = BKE_idtype_idcode_to_name(bhead->code);
+  ReadProfileTimer timer(fd,
+                         BlendFileReadProfile::ID_TYPES,
+                         idtype_name ? idtype_name : "LINK_PLACEHOLDER");
+  BHead *bhead_next = read_libblock_impl(
+      fd, main, bhead, id_tag, id_read_tags, placeholder_set_indirect_extern, r_id);
+  for (BHead *bhead_iter = bhead; bhead_iter && bhead_iter != bhead_next;
+       bhead_iter = blo_bhead_next(fd, bhead_iter))
+  {
+    timer.add_bytes(bhead_iter->len);
+  }
+  return bhead_next;
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -3126,7 +3479,7 @@ BHead *blo_read_asset_data_block(FileData *fd, BHead *bhead, AssetMetaData **r_a
   BLO_read_struct(&reader, AssetMetaData, r_asset_data);
   BKE_asset_metadata_read(&reader, *r_asset_data);
 
-  oldnewmap_clear(fd->datamap);
+  read_data_clear(fd);
 
   return bhead;
 }
@@ -3252,27 +3605,35 @@ static void do_versions(FileData *fd, Library *lib, Main *main)
   }
 
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "blo_do_versions_pre250");
     blo_do_versions_pre250(fd, lib, main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "blo_do_versions_250");
     blo_do_versions_250(fd, lib, main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "blo_do_versions_260");
     blo_do_versions_260(fd, lib, main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "blo_do_versions_270");
     blo_do_versions_270(fd, lib, main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "blo_do_versions_280");
     blo_do_versions_280(fd, lib, main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "blo_do_versions_290");
     blo_do_versions_290(fd, lib, main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "blo_do_versions_300");
     blo_do_versions_300(fd, lib, main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "blo_do_versions_400");
     blo_do_versions_400(fd, lib, main);
   }
 
@@ -3300,24 +3661,31 @@ static void do_versions_after_linking(FileData *fd, Main *main)
   main->is_locked_for_linking = true;
 
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "do_versions_after_linking_250");
     do_versions_after_linking_250(main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "do_versions_after_linking_260");
     do_versions_after_linking_260(main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "do_versions_after_linking_270");
     do_versions_after_linking_270(main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "do_versions_after_linking_280");
     do_versions_after_linking_280(fd, main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "do_versions_after_linking_290");
     do_versions_after_linking_290(fd, main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "do_versions_after_linking_300");
     do_versions_after_linking_300(fd, main);
   }
   if (!main->is_read_invalid) {
+    ReadProfileTimer timer(fd, BlendFileReadProfile::VERSIONING, "do_versions_after_linking_400");
     do_versions_after_linking_400(fd, main);
   }
 
@@ -3360,6 +3728,7 @@ static int lib_link_cb(LibraryIDLinkCallbackData *cb_data)
 
 static void lib_link_all(FileData *fd, Main *bmain)
 {
+  ReadProfileTimer timer(fd, BlendFileReadProfile::STAGES, "lib_link_all");
   BlendLibReader reader = {fd, bmain};
 
   ID *id;
@@ -3566,7 +3935,7 @@ static BHead *read_userdef(BlendFileData *bfd, FileData *fd, BHead *bhead)
   user->edit_studio_light = 0;
 
   /* free fd->datamap again */
-  oldnewmap_clear(fd->datamap);
+  read_data_clear(fd);
 
   return bhead;
 }
@@ -3655,6 +4024,12 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
    * non-BLO functions (e.g. ID deletion) can indirectly trigger it. */
   BKE_layer_collection_resync_forbid();
 
+  if ((G.debug & G_DEBUG_IO_LOAD) && !is_undo && !fd->profile) {
+    fd->profile = std::make_shared<BlendFileReadProfile>();
+  }
+  std::optional<ReadProfileTimer> timer_total;
+  timer_total.emplace(fd, BlendFileReadProfile::STAGES, "total");
+
   bfd = MEM_new<BlendFileData>(__func__);
 
   bfd->main = BKE_main_new();
@@ -3805,12 +4180,18 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
 
   if ((fd->skip_flags & BLO_READ_SKIP_DATA) == 0) {
     fd->reports->duration.libraries = BLI_time_now_seconds();
-    read_libraries(fd, &mainlist);
+    {
+      ReadProfileTimer timer(fd, BlendFileReadProfile::STAGES, "read_libraries");
+      read_libraries(fd, &mainlist);
+    }
 
     blo_join_main(&mainlist);
 
     lib_link_all(fd, bfd->main);
-    after_liblink_merged_bmain_process(bfd->main, fd->reports);
+    {
+      ReadProfileTimer timer(fd, BlendFileReadProfile::STAGES, "after_liblink");
+      after_liblink_merged_bmain_process(bfd->main, fd->reports);
+    }
 
     if (is_undo) {
       /* Ensure ID usages of reused 'no undo' IDs remain valid. */
@@ -3830,7 +4211,10 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
        * from groups to collections... We could optimize out that first call when we are reading a
        * current version file, but again this is really not a bottle neck currently.
        * So not worth it. */
-      BKE_main_id_refcount_recompute(bfd->main, false);
+      {
+        ReadProfileTimer timer(fd, BlendFileReadProfile::STAGES, "id_refcount_recompute");
+        BKE_main_id_refcount_recompute(bfd->main, false);
+      }
 
       /* Necessary to allow 2.80 layer collections conversion code to work. */
       BKE_layer_collection_resync_allow();
@@ -3855,7 +4239,10 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
       /* And we have to compute those user-reference-counts again, as `do_versions_after_linking()`
        * does not always properly handle user counts, and/or that function does not take into
        * account old, deprecated data. */
-      BKE_main_id_refcount_recompute(bfd->main, false);
+      {
+        ReadProfileTimer timer(fd, BlendFileReadProfile::STAGES, "id_refcount_recompute");
+        BKE_main_id_refcount_recompute(bfd->main, false);
+      }
     }
 
     LISTBASE_FOREACH_MUTABLE (Library *, lib, &bfd->main->libraries) {
@@ -3894,7 +4281,10 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
     /* After all data has been read and versioned, uses ID_TAG_NEW. Theoretically this should
      * not be calculated in the undo case, but it is currently needed even on undo to recalculate
      * a cache. */
-    blender::bke::node_tree_update_all_new(*bfd->main);
+    {
+      ReadProfileTimer timer(fd, BlendFileReadProfile::STAGES, "node_tree_update");
+      blender::bke::node_tree_update_all_new(*bfd->main);
+    }
 
     placeholders_ensure_valid(bfd->main);
 
@@ -3908,6 +4298,7 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
      * we can re-generate overrides from their references. */
     if (!is_undo) {
       /* Do not apply in undo case! */
+      ReadProfileTimer timer(fd, BlendFileReadProfile::STAGES, "lib_overrides");
       fd->reports->duration.lib_overrides = BLI_time_now_seconds();
 
       std::string cur_view_layer_name = bfd->cur_view_layer != nullptr ?
@@ -3954,6 +4345,11 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
   /* Sanity checks. */
   blo_read_file_checks(bfd->main);
 
+  timer_total.reset();
+  if (fd->profile) {
+    read_profile_print(*fd->profile, filepath);
+  }
+
   return bfd;
 }
 
@@ -4068,6 +4464,15 @@ static BHead *find_bhead_from_code_name(FileData *fd, const short idcode, const
   return fd->bhead_idname_map->lookup_default(idname_full, nullptr);
 }
 
+BHead *blo_bhead_find_linkable_id(FileData *fd, const short idcode, const char *name)
+{
+  BLI_assert(BKE_idtype_idcode_is_linkable(idcode));
+  if (!fd->bhead_idname_map) {
+    read_file_bhead_idname_map_create(fd);
+  }
+  return find_bhead_from_code_name(fd, idcode, name);
+}
+
 static BHead *find_bhead_from_idname(FileData *fd, const char *idname)
 {
   BHead *bhead = fd->bhead_idname_map->lookup_default(idname, nullptr);
@@ -4823,6 +5228,7 @@ static FileData *read_library_file_data(FileData *basefd,
     fd->mainlist = mainlist;
 
     fd->reports = basefd->reports;
+    fd->profile = basefd->profile;
 
     if (fd->libmap) {
       oldnewmap_free(fd->libmap);
@@ -4882,6 +5288,9 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
                   mainptr->curlib->id.name,
                   mainptr->curlib->filepath);
 
+        ReadProfileTimer timer(
+            basefd, BlendFileReadProfile::LIBRARIES, mainptr->curlib->runtime->filepath_abs);
+
         /* Open file if it has not been done yet. */
         FileData *fd = read_library_file_data(basefd, mainlist, mainl, mainptr);
 
@@ -5258,6 +5667,32 @@ blender::ImplicitSharingInfoAndData blo_read_shared_impl(
   return shared_data;
 }
 
+blender::ImplicitSharingInfoAndData blo_read_shared_plain_data_impl(
+    BlendDataReader *reader,
+    const void **ptr_p,
+    const int64_t size_in_bytes,
+    const blender::FunctionRef<const blender::ImplicitSharingInfo *()> read_fn)
+{
+  FileData *fd = reader->fd;
+  const void *old_address = *ptr_p;
+  if (const MappedDataBlock *block = fd->mapped_data_blocks.lookup_ptr(old_address)) {
+    if (block->bhead->len >= size_in_bytes) {
+      const BHeadN *bheadn = BHEADN_FROM_BHEAD(block->bhead);
+      const void *new_address = POINTER_OFFSET(BLI_mmap_get_pointer(fd->mapped_file->mmap_file),
+                                               bheadn->file_offset);
+      const blender::ImplicitSharingInfo *sharing_info = MEM_new<MappedDataSharingInfo>(
+          __func__, fd->mapped_file);
+      fd->mapped_data_blocks.remove(old_address);
+
+      /* Other users of the same data will share it, see #blo_read_shared_impl. */
+      const blender::ImplicitSharingInfoAndData shared_data{sharing_info, new_address};
+      reader->shared_data_by_stored_address.add(old_address, shared_data);
+      return shared_data;
+    }
+  }
+  return blo_read_shared_impl(reader, ptr_p, read_fn);
+}
+
 bool BLO_read_data_is_undo(BlendDataReader *reader)
 {
   return (reader->fd->flags & FD_FLAGS_IS_MEMFILE);
@@ -9,8 +9,11 @@
 
 #pragma once
 
+#include <array>
 #include <cstdio> /* IWYU pragma: keep. Include header using off_t before poisoning it below. */
+#include <memory>
 #include <optional>
+#include <string>
 
 #ifdef WIN32
 #  include "BLI_winstuff.h"
@@ -34,6 +37,7 @@ struct DNA_ReconstructInfo;
 struct IDNameLib_Map;
 struct Key;
 struct Main;
+struct MappedBlendFile;
 struct MemFile;
 struct Object;
 struct OldNewMap;
@@ -58,12 +62,49 @@ ENUM_OPERATORS(eFileDataFlag, FD_FLAGS_IS_MEMFILE)
 #  pragma GCC poison off_t
 #endif
 
+/**
+ * A data block which content has been kept in the memory-mapped blend-file, see
+ * #G_BACKGROUND_FILE_DATA_MMAP.
+ */
+struct MappedDataBlock {
+  BHead *bhead;
+  /** Used to read the block when it needs to be copied after all, see #read_struct. */
+  const char *blockname;
+  int id_type_index;
+};
+
 /**
  * General data used during a blend-file reading.
  *
  * Note that this data (and its accesses) are absolutely not thread-safe currently. It should never
  * be accessed concurrently.
  */
+/**
+ * Timing information gathered while reading a blend-file and its libraries, only used when
+ * #G_DEBUG_IO_LOAD is enabled. Printed as JSON once the file has been read.
+ */
+struct BlendFileReadProfile {
+  enum Category {
+    /** Main steps of the file reading. */
+    STAGES = 0,
+    /** Reading (and converting) of the ID blocks and their data, by ID type. */
+    ID_TYPES,
+    /** Versioning functions. */
+    VERSIONING,
+    /** Reading of linked data, by library file. */
+    LIBRARIES,
+    CATEGORIES_NUM,
+  };
+
+  struct Entry {
+    double duration = 0.0;
+    int64_t bytes = 0;
+    int64_t count = 0;
+  };
+
+  std::array<blender::Map<std::string, Entry>, CATEGORIES_NUM> categories;
+};
+
 struct FileData {
   /** Linked list of BHeadN's. */
   ListBase bhead_list = {};
@@ -72,6 +113,18 @@ struct FileData {
 
   FileReader *file = nullptr;
 
+  /**
+   * The memory-mapped blend-file, when data can directly reference it instead of being copied
+   * (see #G_BACKGROUND_FILE_DATA_MMAP). It is shared with all such data, and may outlive the
+   * #FileData.
+   */
+  MappedBlendFile *mapped_file = nullptr;
+  /**
+   * Data blocks of the ID currently being read, which content has not been copied from the
+   * memory-mapped file (yet), using their old address as key.
+   */
+  blender::Map<const void *, MappedDataBlock> mapped_data_blocks;
+
   /**
    * Whether we are undoing (< 0) or redoing (> 0), used to choose which 'unchanged' flag to use
    * to detect unchanged data from memfile.
@@ -153,6 +206,9 @@ struct FileData {
 
   BlendFileReadReport *reports = nullptr;
 
+  /** Shared with the #FileData of the libraries, null unless profiling is enabled. */
+  std::shared_ptr<BlendFileReadProfile> profile;
+
   /** Opaque handle to the storage system used for non-static allocation strings. */
   void *storage_handle = nullptr;
 };
@@ -199,6 +255,12 @@ BHead *blo_bhead_prev(FileData *fd, BHead *thisblock) ATTR_NONNULL(1, 2);
  * Warning! Caller's responsibility to ensure given bhead **is** an ID one!
  */
 const char *blo_bhead_id_name(const FileData *fd, const BHead *bhead);
+/**
+ * Find the #BHead of a linkable ID from its type and name (without the ID code prefix), using the
+ * ID name lookup table of the file, which is created on first use.
+ * Avoids scanning the whole list of blocks when only a few IDs are needed.
+ */
+BHead *blo_bhead_find_linkable_id(FileData *fd, short idcode, const char *name) ATTR_NONNULL(1, 3);
 /**
  * Warning! Caller's responsibility to ensure given bhead **is** an ID one!
  */
@@ -11,6 +11,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <fcntl.h>
+#include <xxhash.h>
 
 /* open/close */
 #ifndef _WIN32
@@ -39,7 +40,7 @@
 void BLO_memfile_free(MemFile *memfile)
 {
   while (MemFileChunk *chunk = static_cast<MemFileChunk *>(BLI_pophead(&memfile->chunks))) {
-    if (chunk->is_identical == false) {
+    if (!chunk->is_identical && !chunk->is_shared) {
       MEM_freeN((void *)chunk->buf);
     }
     MEM_freeN(chunk);
@@ -65,7 +66,7 @@ void BLO_memfile_merge(MemFile *first, MemFile *second)
 
   /* First, detect all memchunks in second memfile that are not owned by it. */
   LISTBASE_FOREACH (MemFileChunk *, sc, &second->chunks) {
-    if (sc->is_identical) {
+    if (sc->is_identical || sc->is_shared) {
       buffer_to_second_memchunk.add(sc->buf, sc);
     }
   }
@@ -73,10 +74,11 @@ void BLO_memfile_merge(MemFile *first, MemFile *second)
   /* Now, check all chunks from first memfile (the one we are removing), and if a memchunk owned by
    * it is also used by the second memfile, transfer the ownership. */
   LISTBASE_FOREACH (MemFileChunk *, fc, &first->chunks) {
-    if (!fc->is_identical) {
+    if (!fc->is_identical && !fc->is_shared) {
       if (MemFileChunk *sc = buffer_to_second_memchunk.lookup_default(fc->buf, nullptr)) {
-        BLI_assert(sc->is_identical);
+        BLI_assert(sc->is_identical || sc->is_shared);
         sc->is_identical = false;
+        sc->is_shared = false;
         fc->is_identical = true;
       }
       /* Note that if the second memfile does not use that chunk, we assume that the first one
@@ -117,6 +119,9 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
         current_session_uid = mem_chunk->id_session_uid;
         mem_data->id_session_uid_mapping.add_new(current_session_uid, mem_chunk);
       }
+      /* Also allow finding existing buffers from their content, so that data shifted to another
+       * position in the chunk stream (e.g. after an insertion) remains shared. */
+      mem_data->chunk_by_hash.add(mem_chunk->hash, mem_chunk);
     }
   }
 }
@@ -124,6 +129,7 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
 void BLO_memfile_write_finalize(MemFileWriteData *mem_data)
 {
   mem_data->id_session_uid_mapping.clear();
+  mem_data->chunk_by_hash.clear();
 }
 
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size)
@@ -135,6 +141,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   curchunk->size = size;
   curchunk->buf = nullptr;
   curchunk->is_identical = false;
+  curchunk->is_shared = false;
   /* This is unsafe in the sense that an app handler or other code that does not
    * perform an undo push may make changes after the last undo push that
    * will then not be undo. Though it's not entirely clear that is wrong behavior. */
@@ -148,6 +155,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
     if (compchunk->size == curchunk->size) {
       if (memcmp(compchunk->buf, buf, size) == 0) {
         curchunk->buf = compchunk->buf;
+        curchunk->hash = compchunk->hash;
         curchunk->is_identical = true;
         compchunk->is_identical_future = true;
       }
@@ -155,12 +163,26 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
     *compchunk_step = static_cast<MemFileChunk *>(compchunk->next);
   }
 
+  /* Not equal to the chunk at the same position, look for the same content elsewhere. */
+  if (curchunk->buf == nullptr) {
+    curchunk->hash = XXH3_64bits(buf, size);
+    if (const MemFileChunk *hashchunk = mem_data->chunk_by_hash.lookup_default(curchunk->hash,
+                                                                               nullptr))
+    {
+      if (hashchunk->size == size && memcmp(hashchunk->buf, buf, size) == 0) {
+        curchunk->buf = hashchunk->buf;
+        curchunk->is_shared = true;
+      }
+    }
+  }
+
   /* not equal... */
   if (curchunk->buf == nullptr) {
     char *buf_new = static_cast<char *>(MEM_mallocN(size, "Chunk buffer"));
     memcpy(buf_new, buf, size);
     curchunk->buf = buf_new;
     memfile->size += size;
+    mem_data->chunk_by_hash.add(curchunk->hash, curchunk);
   }
 }
 
@@ -154,6 +154,14 @@
 
 #define ZSTD_COMPRESSION_LEVEL 3
 
+/**
+ * Maximum number of frames compressed at the same time. Each of them holds a copy of its
+ * uncompressed data and its compressed result, so this bounds the memory used for writing
+ * independently of the number of CPU cores. More threads would not help much either,
+ * since writing to storage is the bottleneck by then.
+ */
+#define ZSTD_WRITE_THREADS_MAX 16
+
 static CLG_LogRef LOG = {"blo.writefile"};
 
 /** Use if we want to store how many bytes have been written to the file. */
@@ -212,6 +220,96 @@ bool RawWriteWrap::write(const void *buf, size_t buf_len)
   return ::write(file_handle, buf, buf_len) == buf_len;
 }
 
+/**
+ * Write the buffers of an other #WriteWrap from a worker thread, so the (potentially slow, e.g.
+ * on network storage) file writes overlap with the serialization of the following data.
+ * At most one buffer is in flight, so the memory overhead is bounded to a single buffer.
+ */
+class ThreadedWriteWrap : public WriteWrap {
+  WriteWrap &base_wrap;
+
+  ListBase threadpool = {};
+  struct WriteBlockTask;
+  WriteBlockTask *pending_task = nullptr;
+
+  bool write_error = false;
+
+ public:
+  ThreadedWriteWrap(WriteWrap &base_wrap) : base_wrap(base_wrap) {}
+
+  bool open(const char *filepath) override;
+  bool close() override;
+  bool write(const void *buf, size_t buf_len) override;
+
+ private:
+  void wait_pending();
+};
+
+struct ThreadedWriteWrap::WriteBlockTask {
+  void *data;
+  size_t size;
+  bool success;
+  ThreadedWriteWrap *ww;
+
+  static void *write_task(void *userdata)
+  {
+    auto *task = static_cast<WriteBlockTask *>(userdata);
+    task->success = task->ww->base_wrap.write(task->data, task->size);
+    return nullptr;
+  }
+};
+
+bool ThreadedWriteWrap::open(const char *filepath)
+{
+  if (!base_wrap.open(filepath)) {
+    return false;
+  }
+  BLI_threadpool_init(&threadpool, WriteBlockTask::write_task, 1);
+  return true;
+}
+
+void ThreadedWriteWrap::wait_pending()
+{
+  if (pending_task == nullptr) {
+    return;
+  }
+  BLI_threadpool_remove(&threadpool, pending_task);
+  if (!pending_task->success) {
+    write_error = true;
+  }
+  MEM_freeN(pending_task->data);
+  MEM_freeN(pending_task);
+  pending_task = nullptr;
+}
+
+bool ThreadedWriteWrap::close()
+{
+  wait_pending();
+  BLI_threadpool_end(&threadpool);
+  return base_wrap.close() && !write_error;
+}
+
+bool ThreadedWriteWrap::write(const void *buf, const size_t buf_len)
+{
+  /* Only one write is in flight, wait for the previous one to finish. */
+  wait_pending();
+  if (write_error) {
+    return false;
+  }
+
+  WriteBlockTask *task = MEM_mallocN<WriteBlockTask>(__func__);
+  task->data = MEM_mallocN(buf_len, __func__);
+  memcpy(task->data, buf, buf_len);
+  task->size = buf_len;
+  task->success = false;
+  task->ww = this;
+
+  pending_task = task;
+  BLI_threadpool_insert(&threadpool, task);
+
+  return true;
+}
+
 class ZstdWriteWrap : public WriteWrap {
   WriteWrap &base_wrap;
 
@@ -300,7 +398,7 @@ bool ZstdWriteWrap::open(const char *filepath)
   }
 
   /* Leave one thread open for the main writing logic, unless we only have one HW thread. */
-  int num_threads = max_ii(1, BLI_system_thread_count() - 1);
+  int num_threads = std::clamp(BLI_system_thread_count() - 1, 1, ZSTD_WRITE_THREADS_MAX);
   BLI_threadpool_init(&threadpool, ZstdWriteBlockTask::write_task, num_threads);
   BLI_mutex_init(&mutex);
   BLI_condition_init(&condition);
@@ -1793,7 +1891,9 @@ bool BLO_write_file(Main *mainvar,
     return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, zstd_wrap);
   }
 
-  return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, raw_wrap);
+  /* Compressed writing already writes from worker threads. */
+  ThreadedWriteWrap threaded_wrap(raw_wrap);
+  return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, threaded_wrap);
 }
 
 bool BLO_write_file_mem(Main *mainvar, MemFile *compare, MemFile *current, const int write_flags)
@@ -23,6 +23,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -7641,29 +7642,41 @@ static float vertex_collide_offset(BevelParams *bp, EdgeHalf *ea)
  */
 static void bevel_limit_offset(BevelParams *bp, BMesh *bm)
 {
-  float limited_offset = bp->offset;
   BMIter iter;
   BMVert *bmv;
-  BM_ITER_MESH (bmv, &iter, bm, BM_VERTS_OF_MESH) {
-    if (!BM_elem_flag_test(bmv, BM_ELEM_TAG)) {
-      continue;
-    }
-    BevVert *bv = find_bevvert(bp, bmv);
-    if (!bv) {
-      continue;
-    }
-    for (int i = 0; i < bv->edgecount; i++) {
-      EdgeHalf *eh = &bv->edges[i];
-      if (bp->affect_type == BEVEL_AFFECT_VERTICES) {
-        float collision_offset = vertex_collide_offset(bp, eh);
-        limited_offset = std::min(collision_offset, limited_offset);
-      }
-      else {
-        float collision_offset = geometry_collide_offset(bp, eh);
-        limited_offset = std::min(collision_offset, limited_offset);
-      }
-    }
-  }
+
+  /* Finding the collision offsets only reads the mesh and the bevel data, so vertices can be
+   * processed in parallel. */
+  BM_mesh_elem_table_ensure(bm, BM_VERT);
+  const float limited_offset = blender::threading::parallel_reduce(
+      blender::IndexRange(bm->totvert),
+      1024,
+      bp->offset,
+      [&](const blender::IndexRange range, float limited_offset) {
+        for (const int vert_i : range) {
+          BMVert *v = BM_vert_at_index(bm, vert_i);
+          if (!BM_elem_flag_test(v, BM_ELEM_TAG)) {
+            continue;
+          }
+          BevVert *bv = find_bevvert(bp, v);
+          if (!bv) {
+            continue;
+          }
+          for (int i = 0; i < bv->edgecount; i++) {
+            EdgeHalf *eh = &bv->edges[i];
+            if (bp->affect_type == BEVEL_AFFECT_VERTICES) {
+              float collision_offset = vertex_collide_offset(bp, eh);
+              limited_offset = std::min(collision_offset, limited_offset);
+            }
+            else {
+              float collision_offset = geometry_collide_offset(bp, eh);
+              limited_offset = std::min(collision_offset, limited_offset);
+            }
+          }
+        }
+        return limited_offset;
+      },
+      [](const float a, const float b) { return std::min(a, b); });
 
   if (limited_offset < bp->offset) {
     /* All current offset specs have some number times bp->offset,
@@ -13,14 +13,17 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
 #include "BLI_heap.h"
 #include "BLI_linklist.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
+#include "BLI_math_vector_types.hh"
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_quadric.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines_stack.h"
 
 #include "BKE_customdata.hh"
@@ -66,28 +69,59 @@ ENUM_OPERATORS(CD_UseFlag, CD_DO_LOOP)
 /* BMesh Helper Functions
  * ********************** */
 
+/**
+ * Grain size for computing face planes and edge costs in parallel. The results are still
+ * accumulated into the quadrics and the heap in order, so decimation doesn't depend on threading.
+ */
+#define DECIM_PARALLEL_THRESHOLD 4096
+
+static bool bm_decim_edge_boundary_plane(const BMEdge *e, double r_edge_plane_db[4])
+{
+  float edge_vector[3];
+  float edge_plane[3];
+  float center[3];
+  sub_v3_v3v3(edge_vector, e->v2->co, e->v1->co);
+
+  cross_v3_v3v3(edge_plane, edge_vector, e->l->f->no);
+  copy_v3db_v3fl(r_edge_plane_db, edge_plane);
+
+  if (normalize_v3_db(r_edge_plane_db) > double(FLT_EPSILON)) {
+    mid_v3_v3v3(center, e->v1->co, e->v2->co);
+    r_edge_plane_db[3] = -dot_v3db_v3fl(r_edge_plane_db, center);
+    return true;
+  }
+  return false;
+}
+
 /**
  * \param vquadrics: must be calloc'd
  */
 static void bm_decim_build_quadrics(BMesh *bm, Quadric *vquadrics)
 {
-  BMIter iter;
-  BMFace *f;
-  BMEdge *e;
+  using namespace blender;
+  BM_mesh_elem_table_ensure(bm, BM_EDGE | BM_FACE);
+
+  /* Face planes, computed in parallel since finding the center is the expensive part. */
+  Array<double4> face_planes(bm->totface);
+  threading::parallel_for(
+      IndexRange(bm->totface), DECIM_PARALLEL_THRESHOLD, [&](const IndexRange range) {
+        for (const int i : range) {
+          const BMFace *f = BM_face_at_index(bm, i);
+          float center[3];
+          double *plane_db = face_planes[i];
+          BM_face_calc_center_median(f, center);
+          copy_v3db_v3fl(plane_db, f->no);
+          plane_db[3] = -dot_v3db_v3fl(plane_db, center);
+        }
+      });
 
-  BM_ITER_MESH (f, &iter, bm, BM_FACES_OF_MESH) {
+  for (const int i : face_planes.index_range()) {
+    BMFace *f = BM_face_at_index(bm, i);
     BMLoop *l_first;
     BMLoop *l_iter;
-
-    float center[3];
-    double plane_db[4];
     Quadric q;
 
-    BM_face_calc_center_median(f, center);
-    copy_v3db_v3fl(plane_db, f->no);
-    plane_db[3] = -dot_v3db_v3fl(plane_db, center);
-
-    BLI_quadric_from_plane(&q, plane_db);
+    BLI_quadric_from_plane(&q, face_planes[i]);
 
     l_iter = l_first = BM_FACE_FIRST_LOOP(f);
     do {
@@ -96,31 +130,29 @@ static void bm_decim_build_quadrics(BMesh *bm, Quadric *vquadrics)
   }
 
   /* boundary edges */
-  BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
-    if (UNLIKELY(BM_edge_is_boundary(e))) {
-      float edge_vector[3];
-      float edge_plane[3];
-      double edge_plane_db[4];
-      sub_v3_v3v3(edge_vector, e->v2->co, e->v1->co);
-      f = e->l->f;
-
-      cross_v3_v3v3(edge_plane, edge_vector, f->no);
-      copy_v3db_v3fl(edge_plane_db, edge_plane);
-
-      if (normalize_v3_db(edge_plane_db) > double(FLT_EPSILON)) {
-        Quadric q;
-        float center[3];
+  Array<double4> edge_planes(bm->totedge);
+  Array<bool> edge_use_plane(bm->totedge);
+  threading::parallel_for(
+      IndexRange(bm->totedge), DECIM_PARALLEL_THRESHOLD, [&](const IndexRange range) {
+        for (const int i : range) {
+          const BMEdge *e = BM_edge_at_index(bm, i);
+          edge_use_plane[i] = UNLIKELY(BM_edge_is_boundary(e)) &&
+                              bm_decim_edge_boundary_plane(e, edge_planes[i]);
+        }
+      });
 
-        mid_v3_v3v3(center, e->v1->co, e->v2->co);
+  for (const int i : edge_planes.index_range()) {
+    if (!edge_use_plane[i]) {
+      continue;
+    }
+    BMEdge *e = BM_edge_at_index(bm, i);
+    Quadric q;
 
-        edge_plane_db[3] = -dot_v3db_v3fl(edge_plane_db, center);
-        BLI_quadric_from_plane(&q, edge_plane_db);
-        BLI_quadric_mul(&q, BOUNDARY_PRESERVE_WEIGHT);
+    BLI_quadric_from_plane(&q, edge_planes[i]);
+    BLI_quadric_mul(&q, BOUNDARY_PRESERVE_WEIGHT);
 
-        BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(e->v1)], &q);
-        BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(e->v2)], &q);
-      }
-    }
+    BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(e->v1)], &q);
+    BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(e->v2)], &q);
   }
 }
 
@@ -227,19 +259,24 @@ static float bm_decim_build_edge_cost_single__topology(BMEdge *e)
 
 #endif /* USE_TOPOLOGY_FALLBACK */
 
-static void bm_decim_build_edge_cost_single(BMEdge *e,
-                                            const Quadric *vquadrics,
-                                            const float *vweights,
-                                            const float vweight_factor,
-                                            Heap *eheap,
-                                            HeapNode **eheap_table)
+/**
+ * Calculate the collapse cost of an edge without modifying any data,
+ * so this can be called from multiple threads.
+ *
+ * \return false when the edge should not be collapsed.
+ */
+static bool bm_decim_calc_edge_cost_single(BMEdge *e,
+                                           const Quadric *vquadrics,
+                                           const float *vweights,
+                                           const float vweight_factor,
+                                           float *r_cost)
 {
   float cost;
 
   if (UNLIKELY(vweights && ((vweights[BM_elem_index_get(e->v1)] == 0.0f) ||
                             (vweights[BM_elem_index_get(e->v2)] == 0.0f))))
   {
-    goto clear;
+    return false;
   }
 
   /* Check we can collapse, some edges we better not touch. */
@@ -249,7 +286,7 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* Only collapse triangles. */
-      goto clear;
+      return false;
     }
   }
   else if (BM_edge_is_manifold(e)) {
@@ -258,11 +295,11 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* Only collapse triangles. */
-      goto clear;
+      return false;
     }
   }
   else {
-    goto clear;
+    return false;
   }
   /* End sanity check. */
 
@@ -315,10 +352,23 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
   }
 
-  BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
-  return;
+  *r_cost = cost;
+  return true;
+}
+
+static void bm_decim_build_edge_cost_single(BMEdge *e,
+                                            const Quadric *vquadrics,
+                                            const float *vweights,
+                                            const float vweight_factor,
+                                            Heap *eheap,
+                                            HeapNode **eheap_table)
+{
+  float cost;
+  if (bm_decim_calc_edge_cost_single(e, vquadrics, vweights, vweight_factor, &cost)) {
+    BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
+    return;
+  }
 
-clear:
   if (eheap_table[BM_elem_index_get(e)]) {
     BLI_heap_remove(eheap, eheap_table[BM_elem_index_get(e)]);
   }
@@ -340,14 +390,25 @@ static void bm_decim_build_edge_cost(BMesh *bm,
                                      Heap *eheap,
                                      HeapNode **eheap_table)
 {
-  BMIter iter;
-  BMEdge *e;
-  uint i;
+  using namespace blender;
+  BM_mesh_elem_table_ensure(bm, BM_EDGE);
+
+  /* Calculate the costs in parallel, then insert them into the heap in order
+   * so the collapse order is the same as when building the heap directly. */
+  Array<float> costs(bm->totedge);
+  Array<bool> use_edge(bm->totedge);
+  threading::parallel_for(
+      IndexRange(bm->totedge), DECIM_PARALLEL_THRESHOLD, [&](const IndexRange range) {
+        for (const int i : range) {
+          use_edge[i] = bm_decim_calc_edge_cost_single(
+              BM_edge_at_index(bm, i), vquadrics, vweights, vweight_factor, &costs[i]);
+        }
+      });
 
-  BM_ITER_MESH_INDEX (e, &iter, bm, BM_EDGES_OF_MESH, i) {
-    /* keep sanity check happy */
-    eheap_table[i] = nullptr;
-    bm_decim_build_edge_cost_single(e, vquadrics, vweights, vweight_factor, eheap, eheap_table);
+  for (const int i : costs.index_range()) {
+    BMEdge *e = BM_edge_at_index(bm, i);
+    BLI_assert(BM_elem_index_get(e) == i);
+    eheap_table[i] = use_edge[i] ? BLI_heap_insert(eheap, costs[i], e) : nullptr;
   }
 }
 
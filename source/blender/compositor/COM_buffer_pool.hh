@@ -0,0 +1,57 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+#include "BLI_vector.hh"
+
+namespace blender::compositor {
+
+/* -------------------------------------------------------------------------------------------------
+ * Buffer Pool
+ *
+ * A pool of CPU buffers that is used to allocate the data of CPU results. This is the CPU analog of
+ * the GPU texture pool. Released buffers are kept in the pool and reused by later allocations of
+ * the same size and alignment, which avoids reallocating and page faulting large image buffers
+ * for every result of every evaluation, most notably during playback where the same buffers are
+ * needed frame after frame.
+ *
+ * Buffers that were not acquired since the previous reset are freed in the reset() method, which
+ * should be called before every evaluation. So the pool holds at most the buffers needed by a
+ * single evaluation. */
+class BufferPool {
+ private:
+  struct Buffer {
+    void *data;
+    int64_t size;
+    int64_t alignment;
+    /* True if the buffer was acquired since the last reset. */
+    bool needed;
+  };
+
+  /* Buffers that are not currently acquired and are ready to be reused. */
+  Vector<Buffer> available_buffers_;
+  /* Buffers that are currently acquired, tracked to know their size and alignment on release. */
+  Vector<Buffer> acquired_buffers_;
+  std::mutex mutex_;
+
+ public:
+  ~BufferPool();
+
+  /* Returns a buffer of the given size in bytes and alignment, reusing an available buffer if one
+   * exists. The content of the buffer is undefined. */
+  void *acquire(int64_t size, int64_t alignment);
+
+  /* Returns the given buffer, which should have been acquired from this pool, back to the pool so
+   * that it can be reused. */
+  void release(void *data);
+
+  /* Frees the available buffers that were not acquired since the last reset. */
+  void reset();
+};
+
+}  // namespace blender::compositor
@@ -19,6 +19,7 @@
 #include "COM_profiler.hh"
 #include "COM_render_context.hh"
 #include "COM_result.hh"
+#include "COM_buffer_pool.hh"
 #include "COM_static_cache_manager.hh"
 
 namespace blender::compositor {
@@ -47,6 +48,9 @@ class Context {
    * efficiently. */
   StaticCacheManager cache_manager_;
 
+  /* A pool of buffers used to allocate the data of CPU results, see BufferPool. */
+  BufferPool buffer_pool_;
+
  public:
   /* Get the compositing scene. */
   virtual const Scene &get_scene() const = 0;
@@ -167,6 +171,9 @@ class Context {
 
   /* Get a reference to the static cache manager of this context. */
   StaticCacheManager &cache_manager();
+
+  /* Get a reference to the CPU buffer pool of this context. */
+  BufferPool &buffer_pool();
 };
 
 }  // namespace blender::compositor
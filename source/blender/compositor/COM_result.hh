@@ -138,9 +138,9 @@ class Result {
    * This is set up by a call to the wrap_external method. In that case, when the reference count
    * eventually reach zero, the data will not be freed. */
   bool is_external_ = false;
-  /* If true, the GPU texture that holds the data was allocated from the texture pool of the
-   * context and should be released back into the pool instead of being freed. For CPU storage,
-   * this is irrelevant. */
+  /* If true, the GPU texture or CPU buffer that holds the data was allocated from the texture
+   * pool or buffer pool of the context and should be released back into the pool instead of being
+   * freed. */
   bool is_from_pool_ = false;
   /* Stores resources that are derived from this result. Lazily allocated if needed. See the class
    * description for more information. */
@@ -202,8 +202,8 @@ class Result {
   /* Declare the result to be a texture result, allocate a texture of an appropriate type with
    * the size of the given domain, and set the domain of the result to the given domain.
    *
-   * If from_pool is true, the texture will be allocated from the texture pool of the context,
-   * otherwise, a new texture will be allocated. Pooling should not be used for persistent
+   * If from_pool is true, the texture will be allocated from the texture pool of the context, or
+   * its buffer pool for CPU allocations, otherwise, a new texture will be allocated. Pooling should not be used for persistent
    * results that might span more than one evaluation, like cached resources. While pooling should
    * be used for most other cases where the result will be allocated then later released in the
    * same evaluation.
@@ -15,6 +15,7 @@
 #include "COM_keying_screen.hh"
 #include "COM_morphological_distance_feather_weights.hh"
 #include "COM_ocio_color_space_conversion_shader.hh"
+#include "COM_oidn_device.hh"
 #include "COM_pixel_coordinates.hh"
 #include "COM_smaa_precomputed_textures.hh"
 #include "COM_symmetric_blur_weights.hh"
@@ -67,6 +68,7 @@ class StaticCacheManager {
   FogGlowKernelContainer fog_glow_kernels;
   TextureCoordinatesContainer texture_coordinates;
   PixelCoordinatesContainer pixel_coordinates;
+  OIDNDeviceContainer oidn_device;
 
  private:
   /* The cache manager should skip the next reset. See the skip_next_reset() method for more
@@ -0,0 +1,61 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+#include <memory>
+
+#include "COM_cached_resource.hh"
+
+#ifdef WITH_OPENIMAGEDENOISE
+#  include <OpenImageDenoise/oidn.hpp>
+#endif
+
+namespace blender::compositor {
+
+#ifdef WITH_OPENIMAGEDENOISE
+
+/* -------------------------------------------------------------------------------------------------
+ * OIDN Device.
+ *
+ * A cached resource that caches a committed OIDN device. Creating and committing a device
+ * initializes its thread pool and kernels, which is expensive compared to denoising small images,
+ * so the device is shared between all denoise operations and across evaluations. This is a
+ * parameterless cached resource. */
+class OIDNDevice : public CachedResource {
+ public:
+  oidn::DeviceRef device;
+
+ public:
+  OIDNDevice();
+};
+
+/* ------------------------------------------------------------------------------------------------
+ * OIDN Device Container.
+ */
+class OIDNDeviceContainer : public CachedResourceContainer {
+ private:
+  std::unique_ptr<OIDNDevice> device_;
+
+ public:
+  void reset() override;
+
+  /* Check if a cached OIDN device exists, if it does, return it, otherwise, return a newly created
+   * one and store it in the container. In both cases, tag the cached resource as needed to keep it
+   * cached for the next evaluation. */
+  oidn::DeviceRef &get();
+};
+
+#else
+
+/* Building without OIDN, define a dummy container. User is not expected to use it if OIDN is not
+ * available. */
+class OIDNDeviceContainer : public CachedResourceContainer {
+ public:
+  void reset() override {}
+};
+
+#endif
+
+}  // namespace blender::compositor
@@ -0,0 +1,56 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#ifdef WITH_OPENIMAGEDENOISE
+
+#  include <memory>
+
+#  include "COM_oidn_device.hh"
+
+#  include <OpenImageDenoise/oidn.hpp>
+
+namespace blender::compositor {
+
+/* ------------------------------------------------------------------------------------------------
+ * OIDN Device.
+ */
+
+OIDNDevice::OIDNDevice()
+{
+  this->device = oidn::newDevice(oidn::DeviceType::CPU);
+  this->device.set("setAffinity", false);
+  this->device.commit();
+}
+
+/* ------------------------------------------------------------------------------------------------
+ * OIDN Device Container.
+ */
+
+void OIDNDeviceContainer::reset()
+{
+  /* First, delete the device if it is no longer needed. */
+  if (device_ && !device_->needed) {
+    device_.reset();
+  }
+
+  /* Second, if it was not deleted, reset its needed status to false to ready it to track its
+   * needed status for the next evaluation. */
+  if (device_) {
+    device_->needed = false;
+  }
+}
+
+oidn::DeviceRef &OIDNDeviceContainer::get()
+{
+  if (!device_) {
+    device_ = std::make_unique<OIDNDevice>();
+  }
+
+  device_->needed = true;
+  return device_->device;
+}
+
+}  // namespace blender::compositor
+
+#endif
@@ -94,8 +94,7 @@ DenoisedAuxiliaryPass::DenoisedAuxiliaryPass(Context &context,
                                 GPU_texture_component_len(GPU_texture_format(pass)) :
                                 pass.channels_count());
 
-  oidn::DeviceRef device = oidn::newDevice(oidn::DeviceType::CPU);
-  device.commit();
+  oidn::DeviceRef &device = context.cache_manager().oidn_device.get();
 
   /* Denoise the pass in place, so set it to both the input and output. */
   oidn::FilterRef filter = device.newFilter("RT");
@@ -0,0 +1,78 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include <cstdint>
+#include <mutex>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_assert.h"
+
+#include "COM_buffer_pool.hh"
+
+namespace blender::compositor {
+
+BufferPool::~BufferPool()
+{
+  BLI_assert_msg(acquired_buffers_.is_empty(), "Buffers are still acquired from the pool.");
+  for (const Buffer &buffer : available_buffers_) {
+    MEM_freeN(buffer.data);
+  }
+}
+
+void *BufferPool::acquire(const int64_t size, const int64_t alignment)
+{
+  std::scoped_lock lock(mutex_);
+
+  for (const int64_t i : available_buffers_.index_range()) {
+    const Buffer &buffer = available_buffers_[i];
+    if (buffer.size == size && buffer.alignment == alignment) {
+      void *data = buffer.data;
+      acquired_buffers_.append({data, size, alignment, true});
+      available_buffers_.remove_and_reorder(i);
+      return data;
+    }
+  }
+
+  void *data = MEM_mallocN_aligned(size, alignment, __func__);
+  acquired_buffers_.append({data, size, alignment, true});
+  return data;
+}
+
+void BufferPool::release(void *data)
+{
+  std::scoped_lock lock(mutex_);
+
+  for (const int64_t i : acquired_buffers_.index_range()) {
+    if (acquired_buffers_[i].data == data) {
+      available_buffers_.append(acquired_buffers_[i]);
+      acquired_buffers_.remove_and_reorder(i);
+      return;
+    }
+  }
+
+  BLI_assert_unreachable();
+}
+
+void BufferPool::reset()
+{
+  std::scoped_lock lock(mutex_);
+
+  available_buffers_.remove_if([](const Buffer &buffer) {
+    if (!buffer.needed) {
+      MEM_freeN(buffer.data);
+      return true;
+    }
+    return false;
+  });
+
+  for (Buffer &buffer : available_buffers_) {
+    buffer.needed = false;
+  }
+  for (Buffer &buffer : acquired_buffers_) {
+    buffer.needed = false;
+  }
+}
+
+}  // namespace blender::compositor
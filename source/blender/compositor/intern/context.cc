@@ -13,6 +13,7 @@
 
 #include "BKE_node_runtime.hh"
 
+#include "COM_buffer_pool.hh"
 #include "COM_context.hh"
 #include "COM_profiler.hh"
 #include "COM_render_context.hh"
@@ -55,6 +56,7 @@ bool Context::is_canceled() const
 void Context::reset()
 {
   cache_manager_.reset();
+  buffer_pool_.reset();
 }
 
 int2 Context::get_compositing_region_size() const
@@ -116,4 +118,9 @@ StaticCacheManager &Context::cache_manager()
   return cache_manager_;
 }
 
+BufferPool &Context::buffer_pool()
+{
+  return buffer_pool_;
+}
+
 }  // namespace blender::compositor
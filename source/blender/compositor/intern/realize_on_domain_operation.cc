@@ -23,6 +23,10 @@
 
 namespace blender::compositor {
 
+/* If the transformations of the input and output domains are within this tolerance value, then
+ * realization shouldn't be needed. */
+static constexpr float transformation_tolerance = 10e-6f;
+
 /* ------------------------------------------------------------------------------------------------
  * Realize On Domain Operation
  */
@@ -163,6 +167,51 @@ const char *RealizeOnDomainOperation::get_realization_shader_name()
   return nullptr;
 }
 
+/* Returns true if realizing an input using the given inverse transformation and interpolation is
+ * identical to reading the input pixels at a fixed integer offset, that is, the transformation is
+ * a translation that maps output pixel centers to input pixels exactly. The offset is written to
+ * r_offset in that case. */
+static bool is_integer_translation(const float3x3 &inverse_transformation,
+                                   const Interpolation interpolation,
+                                   int2 &r_offset)
+{
+  if (!math::is_equal(
+          float2x2(inverse_transformation), float2x2::identity(), transformation_tolerance))
+  {
+    return false;
+  }
+
+  const float2 translation = inverse_transformation.location();
+  switch (interpolation) {
+    case Interpolation::Nearest: {
+      /* Nearest interpolation picks the pixel containing the transformed pixel center, which is
+       * a fixed offset as long as the center is not too close to a pixel boundary, where the
+       * floating point error in the sampler could pick either pixel. */
+      const float2 coordinates = translation + float2(0.5f);
+      const float2 fraction = coordinates - math::floor(coordinates);
+      if (math::reduce_min(math::min(fraction, 1.0f - fraction)) < 10e-3f) {
+        return false;
+      }
+      r_offset = int2(math::floor(coordinates));
+      return true;
+    }
+    case Interpolation::Bilinear: {
+      /* Bilinear interpolation at pixel centers returns the pixel itself. */
+      const float2 rounded_translation = math::round(translation);
+      if (!math::is_equal(translation, rounded_translation, transformation_tolerance)) {
+        return false;
+      }
+      r_offset = int2(rounded_translation);
+      return true;
+    }
+    case Interpolation::Bicubic:
+      /* The cubic B-Spline filter is not interpolating, so it blurs even at pixel centers. */
+      return false;
+  }
+
+  return false;
+}
+
 void RealizeOnDomainOperation::realize_on_domain_cpu(const float3x3 &inverse_transformation)
 {
   Result &input = this->get_input();
@@ -172,6 +221,25 @@ void RealizeOnDomainOperation::realize_on_domain_cpu(const float3x3 &inverse_tra
   output.allocate_texture(domain);
 
   const RealizationOptions realization_options = input.get_realization_options();
+
+  /* Common case of inputs that are only translated by whole pixels, for instance, inputs that are
+   * centered in a larger domain. Copy the pixels directly, writing zeros outside of the input to
+   * match the sampler's border extension. */
+  int2 offset;
+  if (!realization_options.repeat_x && !realization_options.repeat_y &&
+      is_integer_translation(inverse_transformation, realization_options.interpolation, offset))
+  {
+    const int2 input_size = input.domain().size;
+    parallel_for(domain.size, [&](const int2 texel) {
+      const int2 input_texel = texel + offset;
+      const bool is_inside = input_texel.x >= 0 && input_texel.y >= 0 &&
+                             input_texel.x < input_size.x && input_texel.y < input_size.y;
+      output.store_pixel_generic_type(
+          texel, is_inside ? input.load_pixel_generic_type(input_texel) : float4(0.0f));
+    });
+    return;
+  }
+
   parallel_for(domain.size, [&](const int2 texel) {
     /* Add 0.5 to evaluate the input sampler at the center of the pixel. */
     float2 coordinates = float2(texel) + float2(0.5f);
@@ -210,10 +278,6 @@ Domain RealizeOnDomainOperation::compute_domain()
   return target_domain_;
 }
 
-/* If the transformations of the input and output domains are within this tolerance value, then
- * realization shouldn't be needed. */
-static constexpr float transformation_tolerance = 10e-6f;
-
 /* Given a potentially transformed domain, compute a domain such that its rotation and scale become
  * identity and the size of the domain is increased/reduced to adapt to the new transformation. For
  * instance, if the domain is rotated, the returned domain will have zero rotation but expanded
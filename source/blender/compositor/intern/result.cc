@@ -570,7 +570,12 @@ void Result::free()
       gpu_texture_ = nullptr;
       break;
     case ResultStorageType::CPU:
-      MEM_freeN(this->cpu_data().data());
+      if (is_from_pool_) {
+        context_->buffer_pool().release(this->cpu_data().data());
+      }
+      else {
+        MEM_freeN(this->cpu_data().data());
+      }
       cpu_data_ = GMutableSpan();
       break;
   }
@@ -704,6 +709,7 @@ void Result::allocate_data(int2 size, bool from_pool)
   }
   else {
     storage_type_ = ResultStorageType::CPU;
+    is_from_pool_ = from_pool;
 
     const CPPType &cpp_type = this->get_cpp_type();
     const int64_t item_size = cpp_type.size();
@@ -711,7 +717,8 @@ void Result::allocate_data(int2 size, bool from_pool)
     const int64_t array_size = int64_t(size.x) * int64_t(size.y);
     const int64_t memory_size = array_size * item_size;
 
-    void *data = MEM_mallocN_aligned(memory_size, alignment, AT);
+    void *data = from_pool ? context_->buffer_pool().acquire(memory_size, alignment) :
+                             MEM_mallocN_aligned(memory_size, alignment, AT);
     cpp_type.default_construct_n(data, array_size);
 
     cpu_data_ = GMutableSpan(cpp_type, data, array_size);
@@ -30,6 +30,9 @@
 
 #pragma once
 
+#include "BLI_function_ref.hh"
+#include "BLI_span.hh"
+
 #include "DNA_ID.h"
 
 /* Dependency Graph */
@@ -38,6 +41,7 @@ struct Depsgraph;
 /* ------------------------------------------------ */
 
 struct Main;
+struct Object;
 struct Scene;
 struct ViewLayer;
 
@@ -200,6 +204,25 @@ void DEG_evaluate_on_refresh(
     Depsgraph *graph,
     DepsgraphEvaluateSyncWriteback sync_writeback = DEG_EVALUATE_SYNC_WRITEBACK_NO);
 
+/**
+ * Evaluate the view layer at the given frames, using up to `max_graphs` dependency graphs which
+ * are evaluated in parallel. Intended for exporting and caching animation which has no dependency
+ * between frames (no simulations), where evaluating a single frame does not use all the cores.
+ *
+ * The graphs are built from the original data, which is not modified during the evaluation.
+ * `frame_fn` is called for every frame right after its evaluation, with the depsgraph which has
+ * been evaluated at that frame. It is called from multiple threads concurrently and frames are
+ * not guaranteed to be passed in order.
+ */
+void DEG_evaluate_frames_parallel(
+    Main *bmain,
+    Scene *scene,
+    ViewLayer *view_layer,
+    eEvaluationMode mode,
+    blender::Span<float> frames,
+    int max_graphs,
+    blender::FunctionRef<void(Depsgraph *depsgraph, float frame)> frame_fn);
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -245,6 +268,14 @@ uint64_t DEG_get_update_count(const Depsgraph *depsgraph);
  * whether the object is hidden or the modifier is disabled. */
 void DEG_disable_visibility_optimization(Depsgraph *depsgraph);
 
+/**
+ * Defer evaluation of the given original objects, for example because they are outside of all
+ * views. Such objects are handled as disabled: their geometry is not evaluated unless it is needed
+ * by another object, and they are skipped by the object iterators. The objects which are no longer
+ * in the list are evaluated on the next update.
+ */
+void DEG_set_deferred_objects(Depsgraph *depsgraph, blender::Span<const Object *> objects);
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -52,6 +52,13 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/**
+ * Write the timeline of the last evaluation of the graph in the Chrome trace event format, with
+ * one event per evaluated operation. The timing is only gathered when time debugging is enabled
+ * for the graph (#G_DEBUG_DEPSGRAPH_TIME).
+ */
+void DEG_debug_eval_trace_json(const Depsgraph *graph, FILE *fp);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
@@ -30,6 +30,7 @@
 #include "intern/depsgraph_tag.hh"
 #include "intern/depsgraph_type.hh"
 #include "intern/eval/deg_eval_copy_on_write.h"
+#include "intern/eval/deg_eval_stats.h"
 #include "intern/eval/deg_eval_visibility.h"
 #include "intern/node/deg_node.hh"
 #include "intern/node/deg_node_component.hh"
@@ -177,6 +178,9 @@ void deg_graph_build_finalize(Main *bmain, Depsgraph *graph)
 {
   deg_graph_flush_visibility_flags(graph);
   deg_graph_remove_unused_noops(graph);
+  /* No timing is known for the newly built graph, estimate the critical path from the graph
+   * topology only. */
+  deg_eval_stats_update_critical_path(graph, false);
 
   /* Re-tag IDs for update if it was tagged before the relations
    * update tag. */
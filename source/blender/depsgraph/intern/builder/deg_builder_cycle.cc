@@ -56,6 +56,9 @@ struct CyclesSolverState {
   Depsgraph *graph;
   BLI_Stack *traversal_stack;
   int num_cycles = 0;
+  /* Index of the first operation which might not have been checked yet. Operations before it are
+   * known to be visited, which avoids scanning them again for every closed loop cycle. */
+  int64_t next_non_checked_index = 0;
 };
 
 inline void set_node_visited_state(Node *node, eCyclicCheckVisitedState state)
@@ -96,6 +99,7 @@ void schedule_leaf_nodes(CyclesSolverState *state)
     for (Relation *rel : node->inlinks) {
       if (rel->from->type == NodeType::OPERATION) {
         has_inlinks = true;
+        break;
       }
     }
     node->custom_flags = 0;
@@ -113,7 +117,9 @@ void schedule_leaf_nodes(CyclesSolverState *state)
  */
 bool schedule_non_checked_node(CyclesSolverState *state)
 {
-  for (OperationNode *node : state->graph->operations) {
+  const Span<OperationNode *> operations = state->graph->operations;
+  while (state->next_non_checked_index < operations.size()) {
+    OperationNode *node = operations[state->next_non_checked_index++];
     if (get_node_visited_state(node) == NODE_NOT_VISITED) {
       schedule_node_to_stack(state, node);
       return true;
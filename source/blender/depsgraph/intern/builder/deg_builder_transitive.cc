@@ -40,14 +40,15 @@ enum {
   OP_REACHABLE = 2,
 };
 
-static void deg_graph_tag_paths_recursive(Node *node)
+static void deg_graph_tag_paths_recursive(Node *node, Vector<Node *> &r_tagged_nodes)
 {
   if (node->custom_flags & OP_VISITED) {
     return;
   }
   node->custom_flags |= OP_VISITED;
+  r_tagged_nodes.append(node);
   for (Relation *rel : node->inlinks) {
-    deg_graph_tag_paths_recursive(rel->from);
+    deg_graph_tag_paths_recursive(rel->from, r_tagged_nodes);
     /* Do this only in inlinks loop, so the target node does not get
      * flagged. */
     rel->from->custom_flags |= OP_REACHABLE;
@@ -58,18 +59,27 @@ void deg_graph_transitive_reduction(Depsgraph *graph)
 {
   int num_removed_relations = 0;
   Vector<Relation *> relations_to_remove;
+  /* Nodes tagged while handling the current target. Only those are cleared before handling the
+   * next target, instead of clearing all operations of the graph for every target. */
+  Vector<Node *> tagged_nodes;
+
+  for (OperationNode *node : graph->operations) {
+    node->custom_flags = 0;
+  }
 
   for (OperationNode *target : graph->operations) {
     /* Clear tags. */
-    for (OperationNode *node : graph->operations) {
+    for (Node *node : tagged_nodes) {
       node->custom_flags = 0;
     }
+    tagged_nodes.clear();
     /* Mark nodes from which we can reach the target
      * start with children, so the target node and direct children are not
      * flagged. */
     target->custom_flags |= OP_VISITED;
+    tagged_nodes.append(target);
     for (Relation *rel : target->inlinks) {
-      deg_graph_tag_paths_recursive(rel->from);
+      deg_graph_tag_paths_recursive(rel->from, tagged_nodes);
     }
     /* Remove redundant paths to the target. */
     for (Relation *rel : target->inlinks) {
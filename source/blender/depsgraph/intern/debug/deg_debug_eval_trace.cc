@@ -0,0 +1,72 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ *
+ * Export of the evaluation timeline in the Chrome trace event format, which can be inspected in
+ * `chrome://tracing` or https://ui.perfetto.dev.
+ */
+
+#include "DEG_depsgraph_debug.hh"
+
+#include <sstream>
+
+#include "BLI_serialize.hh"
+
+#include "intern/depsgraph.hh"
+#include "intern/node/deg_node_component.hh"
+#include "intern/node/deg_node_id.hh"
+#include "intern/node/deg_node_operation.hh"
+
+namespace deg = blender::deg;
+
+void DEG_debug_eval_trace_json(const Depsgraph *graph, FILE *fp)
+{
+  using namespace blender::io::serialize;
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
+
+  /* Make the timeline start at the first evaluated operation. */
+  double time_origin = 0.0;
+  bool has_evaluated_operations = false;
+  for (const deg::OperationNode *op_node : deg_graph->operations) {
+    if (op_node->stats.current_thread_id == -1) {
+      continue;
+    }
+    if (!has_evaluated_operations || op_node->stats.current_begin_time < time_origin) {
+      time_origin = op_node->stats.current_begin_time;
+    }
+    has_evaluated_operations = true;
+  }
+
+  DictionaryValue root;
+  root.append_str("displayTimeUnit", "ms");
+  std::shared_ptr<ArrayValue> events = root.append_array("traceEvents");
+  for (const deg::OperationNode *op_node : deg_graph->operations) {
+    const deg::Node::Stats &stats = op_node->stats;
+    if (stats.current_thread_id == -1) {
+      continue;
+    }
+    const deg::ComponentNode *comp_node = op_node->owner;
+    const deg::IDNode *id_node = comp_node->owner;
+
+    /* Complete event, timestamps are in microseconds. */
+    std::shared_ptr<DictionaryValue> event = events->append_dict();
+    event->append_str("name", op_node->identifier());
+    event->append_str("cat", id_node->name);
+    event->append_str("ph", "X");
+    event->append_double("ts", (stats.current_begin_time - time_origin) * 1e6);
+    event->append_double("dur", (stats.current_end_time - stats.current_begin_time) * 1e6);
+    event->append_int("pid", 0);
+    event->append_int("tid", stats.current_thread_id);
+    std::shared_ptr<DictionaryValue> args = event->append_dict("args");
+    args->append_str("id", id_node->name);
+    args->append_str("component", comp_node->identifier());
+  }
+
+  std::stringstream stream;
+  JsonFormatter formatter;
+  formatter.serialize(stream, root);
+  fputs(stream.str().c_str(), fp);
+}
@@ -198,9 +198,13 @@ Relation *Depsgraph::check_nodes_connected(const Node *from,
                                            const Node *to,
                                            const char *description)
 {
-  for (Relation *rel : from->outlinks) {
-    BLI_assert(rel->from == from);
-    if (rel->to != to) {
+  /* Iterate over the shorter list of relations. Nodes like the time source or a collection with
+   * many objects have a lot of outgoing relations, checking them all for every new relation
+   * would make building the graph quadratic. */
+  const bool use_inlinks = to->inlinks.size() < from->outlinks.size();
+  for (Relation *rel : use_inlinks ? to->inlinks : from->outlinks) {
+    BLI_assert(use_inlinks ? rel->to == to : rel->from == from);
+    if (rel->from != from || rel->to != to) {
       continue;
     }
     if (description != nullptr && !STREQ(rel->name, description)) {
@@ -341,6 +345,42 @@ void DEG_disable_visibility_optimization(Depsgraph *depsgraph)
   deg_graph->use_visibility_optimization = false;
 }
 
+void DEG_set_deferred_objects(Depsgraph *depsgraph, const blender::Span<const Object *> objects)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(depsgraph);
+  BLI_assert(!deg_graph->is_evaluating);
+
+  blender::Set<const Object *> deferred_objects;
+  deferred_objects.add_multiple(objects);
+
+  /* Re-evaluate the visibility of objects which got deferred or are no longer deferred. */
+  auto tag_visibility_update = [&](const Object *object) {
+    deg::IDNode *id_node = deg_graph->find_id_node(&object->id);
+    if (id_node == nullptr) {
+      return;
+    }
+    deg::ComponentNode *visibility_component = id_node->find_component(
+        deg::NodeType::VISIBILITY);
+    if (visibility_component == nullptr) {
+      return;
+    }
+    visibility_component->tag_update(deg_graph, deg::DEG_UPDATE_SOURCE_VISIBILITY);
+    deg_graph->need_update_nodes_visibility = true;
+  };
+  for (const Object *object : deferred_objects) {
+    if (!deg_graph->deferred_objects.contains(object)) {
+      tag_visibility_update(object);
+    }
+  }
+  for (const Object *object : deg_graph->deferred_objects) {
+    if (!deferred_objects.contains(object)) {
+      tag_visibility_update(object);
+    }
+  }
+
+  deg_graph->deferred_objects = std::move(deferred_objects);
+}
+
 uint64_t DEG_get_update_count(const Depsgraph *depsgraph)
 {
   const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(depsgraph);
@@ -32,6 +32,7 @@
 #include "intern/depsgraph_light_linking.hh"
 
 struct ID;
+struct Object;
 struct Scene;
 struct ViewLayer;
 
@@ -156,6 +157,11 @@ struct Depsgraph {
   /* Optimize out evaluation of operations which affect hidden objects or disabled modifiers. */
   bool use_visibility_optimization;
 
+  /* Original objects whose evaluation is deferred by the caller, for example because they are
+   * outside of all views. They are handled as disabled ones: their evaluation is skipped unless
+   * it is needed by another enabled object. Requires the visibility optimization. */
+  Set<const Object *> deferred_objects;
+
   DepsgraphDebug debug;
 
   bool is_evaluating;
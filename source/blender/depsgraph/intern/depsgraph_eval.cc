@@ -8,11 +8,18 @@
  * Evaluation engine entry-points for Depsgraph Engine.
  */
 
+#include <algorithm>
+
+#include "BLI_array.hh"
+#include "BLI_task.hh"
+#include "BLI_threads.h"
+
 #include "BKE_scene.hh"
 
 #include "DNA_scene_types.h"
 
 #include "DEG_depsgraph.hh"
+#include "DEG_depsgraph_build.hh"
 #include "DEG_depsgraph_query.hh"
 #include "DEG_depsgraph_writeback_sync.hh"
 
@@ -25,6 +32,10 @@
 #include "intern/depsgraph.hh"
 #include "intern/depsgraph_tag.hh"
 
+#ifdef WITH_PYTHON
+#  include "BPY_extern.hh"
+#endif
+
 namespace deg = blender::deg;
 
 static void deg_flush_updates_and_refresh(deg::Depsgraph *deg_graph,
@@ -85,3 +96,58 @@ void DEG_evaluate_on_framechange(Depsgraph *graph,
   deg_graph->ctime = BKE_scene_frame_to_ctime(scene, frame);
   deg_flush_updates_and_refresh(deg_graph, sync_writeback);
 }
+
+void DEG_evaluate_frames_parallel(Main *bmain,
+                                  Scene *scene,
+                                  ViewLayer *view_layer,
+                                  const eEvaluationMode mode,
+                                  const blender::Span<float> frames,
+                                  const int max_graphs,
+                                  const blender::FunctionRef<void(Depsgraph *, float)> frame_fn)
+{
+  using namespace blender;
+  if (frames.is_empty()) {
+    return;
+  }
+
+  const int graphs_num = std::max(
+      1, std::min({max_graphs, int(frames.size()), BLI_system_thread_count()}));
+
+  /* Building is not thread-safe, so the graphs are built upfront. */
+  Array<Depsgraph *> graphs(graphs_num);
+  for (const int graph_index : graphs.index_range()) {
+    graphs[graph_index] = DEG_graph_new(bmain, scene, view_layer, mode);
+    DEG_graph_build_from_view_layer(graphs[graph_index]);
+  }
+
+#ifdef WITH_PYTHON
+  /* Release the GIL, otherwise the calling thread would keep it while waiting for other threads
+   * which need it for the evaluation of Python drivers. */
+  BPy_BEGIN_ALLOW_THREADS;
+#endif
+
+  threading::parallel_for(graphs.index_range(), 1, [&](const IndexRange range) {
+    for (const int graph_index : range) {
+      Depsgraph *graph = graphs[graph_index];
+      /* Isolate the evaluation, so that a thread waiting for the operations of one graph does not
+       * start evaluating another graph in the middle of it. */
+      threading::isolate_task([&]() {
+        /* Every graph takes every N-th frame, so that frames are finished roughly in order. */
+        for (int64_t frame_index = graph_index; frame_index < frames.size();
+             frame_index += graphs_num)
+        {
+          DEG_evaluate_on_framechange(graph, frames[frame_index]);
+          frame_fn(graph, frames[frame_index]);
+        }
+      });
+    }
+  });
+
+#ifdef WITH_PYTHON
+  BPy_END_ALLOW_THREADS;
+#endif
+
+  for (Depsgraph *graph : graphs) {
+    DEG_graph_free(graph);
+  }
+}
@@ -253,6 +253,11 @@ bool deg_iterator_objects_step(DEGObjectIterData *data)
       }
     }
 
+    /* Objects with deferred evaluation might not be evaluated at all. */
+    if (deg_graph->deferred_objects.contains(object_orig)) {
+      continue;
+    }
+
     /* NOTE: The object might be invisible after the latest depsgraph evaluation, in which case
      * going into its evaluated state might not be safe. For example, its evaluated mesh state
      * might point to a freed data-block if the mesh is animated.
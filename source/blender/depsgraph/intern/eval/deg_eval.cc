@@ -8,6 +8,7 @@
  * Evaluation engine entry-points for Depsgraph Engine.
  */
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 
@@ -17,6 +18,7 @@
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.hh"
 
@@ -94,7 +96,11 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
   if (state->do_stats) {
     const double start_time = BLI_time_now_seconds();
     operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += BLI_time_now_seconds() - start_time;
+    const double end_time = BLI_time_now_seconds();
+    operation_node->stats.current_time += end_time - start_time;
+    operation_node->stats.current_begin_time = start_time;
+    operation_node->stats.current_end_time = end_time;
+    operation_node->stats.current_thread_id = BLI_task_parallel_thread_id(nullptr);
   }
   else {
     operation_node->evaluate(depsgraph);
@@ -107,19 +113,50 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
   operation_node->flag &= ~DEPSOP_FLAG_CLEAR_ON_EVAL;
 }
 
+/* Operations whose whole chain of dependents is measured to be cheaper than this (in seconds) are
+ * evaluated in the thread which made them ready instead of being pushed to the task pool: the
+ * overhead of a task is higher than the work itself. */
+static constexpr double CHEAP_OPERATION_CHAIN_COST = 2e-6;
+
 void deg_task_run_func(TaskPool *pool, void *taskdata)
 {
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
-  OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  /* Operations to be evaluated by this task. */
+  Vector<OperationNode *, 16> local_queue;
+  local_queue.append(reinterpret_cast<OperationNode *>(taskdata));
+
+  while (!local_queue.is_empty()) {
+    OperationNode *operation_node = local_queue.pop_last();
+
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+    /* Schedule children. The child which is on the longest remaining chain of operations is
+     * evaluated in this thread right away, together with children which are too cheap to be
+     * worth a task. Other children are pushed to the pool. This keeps the critical path of the
+     * graph busy and avoids a task pool round-trip for linear chains. */
+    OperationNode *next_node = nullptr;
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+      if (next_node == nullptr) {
+        next_node = node;
+        return;
+      }
+      if (node->critical_path_cost > next_node->critical_path_cost) {
+        std::swap(node, next_node);
+      }
+      if (node->critical_path_cost < CHEAP_OPERATION_CHAIN_COST) {
+        local_queue.append(node);
+      }
+      else {
+        BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+      }
+    });
+    if (next_node != nullptr) {
+      local_queue.append(next_node);
+    }
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
@@ -316,9 +353,18 @@ void evaluate_graph_threaded_stage(DepsgraphEvalState *state,
 
   calculate_pending_parents_if_needed(state);
 
-  schedule_graph(state, [&](OperationNode *node) {
+  /* Push operations with the most expensive chain of dependents first, so that they get picked up
+   * by worker threads before the cheap ones. */
+  Vector<OperationNode *> ready_nodes;
+  schedule_graph(state, [&](OperationNode *node) { ready_nodes.append(node); });
+  std::stable_sort(ready_nodes.begin(),
+                   ready_nodes.end(),
+                   [](const OperationNode *a, const OperationNode *b) {
+                     return a->critical_path_cost > b->critical_path_cost;
+                   });
+  for (OperationNode *node : ready_nodes) {
     BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
-  });
+  }
   BLI_task_pool_work_and_wait(task_pool);
 }
 
@@ -463,6 +509,8 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
    * synchronization. */
   if (state.do_stats) {
     deg_eval_stats_aggregate(graph);
+    /* Use the measured timing to prioritize expensive chains of operations on the next update. */
+    deg_eval_stats_update_critical_path(graph, true);
   }
 
   /* Clear any uncleared tags. */
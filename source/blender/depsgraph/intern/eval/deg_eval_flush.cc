@@ -10,8 +10,6 @@
 
 #include "intern/eval/deg_eval_flush.h"
 
-#include <deque>
-
 #include "BLI_listbase.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
@@ -39,6 +37,8 @@
 
 #include "intern/eval/deg_eval_copy_on_write.h"
 
+#include "atomic_ops.h"
+
 /* Invalidate data-block data when update is flushed on it.
  *
  * The idea of this is to help catching cases when area is accessing data which
@@ -63,10 +63,19 @@ enum {
   COMPONENT_STATE_DONE = 2,
 };
 
-using FlushQueue = std::deque<OperationNode *>;
+/* Graphs with fewer operations are flushed in the calling thread, where the overhead of the
+ * threaded traversal is not worth it. */
+static constexpr int64_t THREADED_FLUSH_MIN_OPERATIONS = 10000;
 
 namespace {
 
+void flush_task_run_func(TaskPool *pool, void *taskdata);
+
+inline void flush_schedule_node(TaskPool *pool, OperationNode *op_node)
+{
+  BLI_task_pool_push(pool, flush_task_run_func, op_node, false, nullptr);
+}
+
 void flush_init_id_node_func(void *__restrict data_v,
                              const int i,
                              const TaskParallelTLS *__restrict /*tls*/)
@@ -76,15 +85,14 @@ void flush_init_id_node_func(void *__restrict data_v,
   id_node->custom_flags = ID_STATE_NONE;
   for (ComponentNode *comp_node : id_node->components.values()) {
     comp_node->custom_flags = COMPONENT_STATE_NONE;
+    for (OperationNode *op_node : comp_node->operations) {
+      op_node->scheduled = false;
+    }
   }
 }
 
 inline void flush_prepare(Depsgraph *graph)
 {
-  for (OperationNode *node : graph->operations) {
-    node->scheduled = false;
-  }
-
   {
     const int num_id_nodes = graph->id_nodes.size();
     TaskParallelSettings settings;
@@ -94,11 +102,14 @@ inline void flush_prepare(Depsgraph *graph)
   }
 }
 
-inline void flush_schedule_entrypoints(Depsgraph *graph, FlushQueue *queue)
+inline void flush_schedule_entrypoints(Depsgraph *graph, TaskPool *pool)
 {
   for (OperationNode *op_node : graph->entry_tags) {
-    queue->push_back(op_node);
+    if (op_node->scheduled) {
+      continue;
+    }
     op_node->scheduled = true;
+    flush_schedule_node(pool, op_node);
     DEG_DEBUG_PRINTF((::Depsgraph *)graph,
                      EVAL,
                      "Operation is entry point for update: %s\n",
@@ -108,19 +119,34 @@ inline void flush_schedule_entrypoints(Depsgraph *graph, FlushQueue *queue)
 
 inline void flush_handle_id_node(IDNode *id_node)
 {
-  id_node->custom_flags = ID_STATE_MODIFIED;
+  if (id_node->custom_flags != ID_STATE_MODIFIED) {
+    atomic_cas_int32(&id_node->custom_flags, ID_STATE_NONE, ID_STATE_MODIFIED);
+  }
+}
+
+/* Atomically mark the component as handled.
+ * Returns false if the component has already been handled by another flush task. */
+inline bool flush_component_mark_done(ComponentNode *comp_node)
+{
+  int32_t state = comp_node->custom_flags;
+  while (state != COMPONENT_STATE_DONE) {
+    const int32_t prev_state = atomic_cas_int32(
+        &comp_node->custom_flags, state, COMPONENT_STATE_DONE);
+    if (prev_state == state) {
+      return true;
+    }
+    state = prev_state;
+  }
+  return false;
 }
 
 /* TODO(sergey): We can reduce number of arguments here. */
-inline void flush_handle_component_node(IDNode *id_node,
-                                        ComponentNode *comp_node,
-                                        FlushQueue *queue)
+inline void flush_handle_component_node(IDNode *id_node, ComponentNode *comp_node, TaskPool *pool)
 {
   /* We only handle component once. */
-  if (comp_node->custom_flags == COMPONENT_STATE_DONE) {
+  if (!flush_component_mark_done(comp_node)) {
     return;
   }
-  comp_node->custom_flags = COMPONENT_STATE_DONE;
   /* Tag all required operations in component for update, unless this is a
    * special component where we don't want all operations to be tagged.
    *
@@ -138,7 +164,7 @@ inline void flush_handle_component_node(IDNode *id_node,
       if (is_geometry_component && op->opcode == OperationCode::VISIBILITY) {
         continue;
       }
-      op->flag |= DEPSOP_FLAG_NEEDS_UPDATE;
+      atomic_fetch_and_or_int32(&op->flag, DEPSOP_FLAG_NEEDS_UPDATE);
     }
   }
   /* when some target changes bone, we might need to re-run the
@@ -146,20 +172,21 @@ inline void flush_handle_component_node(IDNode *id_node,
   if (comp_node->type == NodeType::BONE) {
     ComponentNode *pose_comp = id_node->find_component(NodeType::EVAL_POSE);
     BLI_assert(pose_comp != nullptr);
-    if (pose_comp->custom_flags == COMPONENT_STATE_NONE) {
-      queue->push_front(pose_comp->get_entry_operation());
-      pose_comp->custom_flags = COMPONENT_STATE_SCHEDULED;
+    if (atomic_cas_int32(
+            &pose_comp->custom_flags, COMPONENT_STATE_NONE, COMPONENT_STATE_SCHEDULED) ==
+        COMPONENT_STATE_NONE)
+    {
+      flush_schedule_node(pool, pose_comp->get_entry_operation());
     }
   }
 }
 
 /* Schedule children of the given operation node for traversal.
  *
- * One of the children will by-pass the queue and will be returned as a function
- * return value, so it can start being handled right away, without building too
- * much of a queue.
+ * One of the children will by-pass the task pool and will be returned as a function
+ * return value, so it can start being handled right away by the current task.
  */
-inline OperationNode *flush_schedule_children(OperationNode *op_node, FlushQueue *queue)
+inline OperationNode *flush_schedule_children(OperationNode *op_node, TaskPool *pool)
 {
   if (op_node->flag & DEPSOP_FLAG_USER_MODIFIED) {
     IDNode *id_node = op_node->owner->owner;
@@ -182,22 +209,43 @@ inline OperationNode *flush_schedule_children(OperationNode *op_node, FlushQueue
     OperationNode *to_node = (OperationNode *)rel->to;
     /* Always flush flushable flags, so children always know what happened
      * to their parents. */
-    to_node->flag |= (op_node->flag & DEPSOP_FLAG_FLUSH);
+    const int flush_flags = op_node->flag & DEPSOP_FLAG_FLUSH;
+    if (flush_flags && (to_node->flag & flush_flags) != flush_flags) {
+      atomic_fetch_and_or_int32(&to_node->flag, flush_flags);
+    }
     /* Flush update over the relation, if it was not flushed yet. */
     if (to_node->scheduled) {
       continue;
     }
+    if (atomic_fetch_and_or_uint8((uint8_t *)&to_node->scheduled, uint8_t(true))) {
+      continue;
+    }
     if (result != nullptr) {
-      queue->push_front(to_node);
+      flush_schedule_node(pool, to_node);
     }
     else {
       result = to_node;
     }
-    to_node->scheduled = true;
   }
   return result;
 }
 
+void flush_task_run_func(TaskPool *pool, void *taskdata)
+{
+  OperationNode *op_node = static_cast<OperationNode *>(taskdata);
+  while (op_node != nullptr) {
+    /* Tag operation as required for update. */
+    atomic_fetch_and_or_int32(&op_node->flag, DEPSOP_FLAG_NEEDS_UPDATE);
+    /* Inform corresponding ID and component nodes about the change. */
+    ComponentNode *comp_node = op_node->owner;
+    IDNode *id_node = comp_node->owner;
+    flush_handle_id_node(id_node);
+    flush_handle_component_node(id_node, comp_node, pool);
+    /* Flush to nodes along links. */
+    op_node = flush_schedule_children(op_node, pool);
+  }
+}
+
 /* NOTE: It will also accumulate flags from changed components. */
 void flush_editors_id_update(Depsgraph *graph, const DEGEditorUpdateContext *update_ctx)
 {
@@ -316,9 +364,13 @@ void deg_graph_flush_updates(Depsgraph *graph)
   }
   /* Reset all flags, get ready for the flush. */
   flush_prepare(graph);
-  /* Starting from the tagged "entry" nodes, flush outwards. */
-  FlushQueue queue;
-  flush_schedule_entrypoints(graph, &queue);
+  /* Starting from the tagged "entry" nodes, flush outwards. The traversal only sets flags, so the
+   * order in which nodes are visited does not matter and it can happen from multiple threads. */
+  TaskPool *task_pool = (graph->operations.size() < THREADED_FLUSH_MIN_OPERATIONS ||
+                         (G.debug & G_DEBUG_DEPSGRAPH_NO_THREADS)) ?
+                            BLI_task_pool_create_no_threads(nullptr) :
+                            BLI_task_pool_create_suspended(nullptr, TASK_PRIORITY_HIGH);
+  flush_schedule_entrypoints(graph, task_pool);
   /* Prepare update context for editors. */
   DEGEditorUpdateContext update_ctx;
   update_ctx.bmain = bmain;
@@ -326,21 +378,8 @@ void deg_graph_flush_updates(Depsgraph *graph)
   update_ctx.scene = graph->scene;
   update_ctx.view_layer = graph->view_layer;
   /* Do actual flush. */
-  while (!queue.empty()) {
-    OperationNode *op_node = queue.front();
-    queue.pop_front();
-    while (op_node != nullptr) {
-      /* Tag operation as required for update. */
-      op_node->flag |= DEPSOP_FLAG_NEEDS_UPDATE;
-      /* Inform corresponding ID and component nodes about the change. */
-      ComponentNode *comp_node = op_node->owner;
-      IDNode *id_node = comp_node->owner;
-      flush_handle_id_node(id_node);
-      flush_handle_component_node(id_node, comp_node, &queue);
-      /* Flush to nodes along links. */
-      op_node = flush_schedule_children(op_node, &queue);
-    }
-  }
+  BLI_task_pool_work_and_wait(task_pool);
+  BLI_task_pool_free(task_pool);
   /* Inform editors about all changes. */
   flush_editors_id_update(graph, &update_ctx);
   /* Reset evaluation result tagged which is tagged for update to some state
@@ -11,6 +11,7 @@
 #include "DNA_ID.h"
 
 #include "intern/eval/deg_eval_runtime_backup_animation.h"
+#include "intern/eval/deg_eval_runtime_backup_mesh.h"
 #include "intern/eval/deg_eval_runtime_backup_movieclip.h"
 #include "intern/eval/deg_eval_runtime_backup_object.h"
 #include "intern/eval/deg_eval_runtime_backup_scene.h"
@@ -53,6 +54,7 @@ class RuntimeBackup {
   ObjectRuntimeBackup object_backup;
   MovieClipBackup movieclip_backup;
   VolumeBackup volume_backup;
+  MeshBackup mesh_backup;
 };
 
 }  // namespace blender::deg
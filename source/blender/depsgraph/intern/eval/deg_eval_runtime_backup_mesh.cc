@@ -0,0 +1,158 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/eval/deg_eval_runtime_backup_mesh.h"
+
+#include "DNA_mesh_types.h"
+
+#include "BKE_customdata.hh"
+#include "BKE_shrinkwrap.hh"
+
+namespace blender::deg {
+
+namespace {
+
+MeshBackup::DataReference layer_reference(const CustomData &data,
+                                          const eCustomDataType type,
+                                          const StringRef name)
+{
+  MeshBackup::DataReference reference;
+  const int layer_index = CustomData_get_named_layer_index(&data, type, name);
+  if (layer_index == -1) {
+    return reference;
+  }
+  const CustomDataLayer &layer = data.layers[layer_index];
+  if (layer.sharing_info == nullptr) {
+    return reference;
+  }
+  layer.sharing_info->add_user();
+  reference.data = layer.data;
+  reference.sharing_info = ImplicitSharingPtr<>(layer.sharing_info);
+  return reference;
+}
+
+MeshBackup::DataReference face_offsets_reference(const Mesh &mesh)
+{
+  MeshBackup::DataReference reference;
+  const ImplicitSharingInfo *sharing_info = mesh.runtime->face_offsets_sharing_info;
+  if (sharing_info == nullptr) {
+    return reference;
+  }
+  sharing_info->add_user();
+  reference.data = mesh.face_offset_indices;
+  reference.sharing_info = ImplicitSharingPtr<>(sharing_info);
+  return reference;
+}
+
+template<typename T> void restore_cache(SharedCache<T> &dst, const SharedCache<T> &src)
+{
+  if (src.is_cached() && !dst.is_cached()) {
+    dst = src;
+  }
+}
+
+}  // namespace
+
+bool MeshBackup::DataReference::matches(const DataReference &other) const
+{
+  return sharing_info && data == other.data && sharing_info == other.sharing_info;
+}
+
+MeshBackup::MeshBackup(const Depsgraph * /*depsgraph*/)
+    : have_backup_(false), verts_num_(0), edges_num_(0), faces_num_(0), corners_num_(0)
+{
+}
+
+void MeshBackup::init_from_mesh(Mesh *mesh)
+{
+  if (mesh->runtime == nullptr) {
+    return;
+  }
+  have_backup_ = true;
+
+  verts_num_ = mesh->verts_num;
+  edges_num_ = mesh->edges_num;
+  faces_num_ = mesh->faces_num;
+  corners_num_ = mesh->corners_num;
+
+  positions_ = layer_reference(mesh->vert_data, CD_PROP_FLOAT3, "position");
+  edges_ = layer_reference(mesh->edge_data, CD_PROP_INT32_2D, ".edge_verts");
+  face_offsets_ = face_offsets_reference(*mesh);
+  corner_verts_ = layer_reference(mesh->corner_data, CD_PROP_INT32, ".corner_vert");
+  corner_edges_ = layer_reference(mesh->corner_data, CD_PROP_INT32, ".corner_edge");
+
+  const bke::MeshRuntime &runtime = *mesh->runtime;
+  bounds_cache_ = runtime.bounds_cache;
+  vert_normals_cache_ = runtime.vert_normals_cache;
+  face_normals_cache_ = runtime.face_normals_cache;
+  corner_tris_cache_.data = runtime.corner_tris_cache.data;
+  bvh_cache_verts_ = runtime.bvh_cache_verts;
+  bvh_cache_edges_ = runtime.bvh_cache_edges;
+  bvh_cache_faces_ = runtime.bvh_cache_faces;
+  bvh_cache_corner_tris_ = runtime.bvh_cache_corner_tris;
+  bvh_cache_loose_verts_ = runtime.bvh_cache_loose_verts;
+  bvh_cache_loose_edges_ = runtime.bvh_cache_loose_edges;
+  shrinkwrap_boundary_cache_ = runtime.shrinkwrap_boundary_cache;
+
+  corner_tri_faces_cache_ = runtime.corner_tri_faces_cache;
+  vert_to_face_offset_cache_ = runtime.vert_to_face_offset_cache;
+  vert_to_face_map_cache_ = runtime.vert_to_face_map_cache;
+  vert_to_corner_map_cache_ = runtime.vert_to_corner_map_cache;
+  corner_to_face_map_cache_ = runtime.corner_to_face_map_cache;
+  loose_edges_cache_ = runtime.loose_edges_cache;
+  loose_verts_cache_ = runtime.loose_verts_cache;
+  verts_no_face_cache_ = runtime.verts_no_face_cache;
+}
+
+void MeshBackup::restore_to_mesh(Mesh *mesh)
+{
+  if (!have_backup_ || mesh->runtime == nullptr) {
+    return;
+  }
+
+  /* The arrays are compared by their identity: as long as the backup holds a reference to the
+   * data it can not be modified in-place, so the same pointer means the same content. */
+  const bool topology_unchanged =
+      mesh->verts_num == verts_num_ && mesh->edges_num == edges_num_ &&
+      mesh->faces_num == faces_num_ && mesh->corners_num == corners_num_ &&
+      edges_.matches(layer_reference(mesh->edge_data, CD_PROP_INT32_2D, ".edge_verts")) &&
+      face_offsets_.matches(face_offsets_reference(*mesh)) &&
+      corner_verts_.matches(layer_reference(mesh->corner_data, CD_PROP_INT32, ".corner_vert")) &&
+      corner_edges_.matches(layer_reference(mesh->corner_data, CD_PROP_INT32, ".corner_edge"));
+  if (!topology_unchanged) {
+    return;
+  }
+
+  bke::MeshRuntime &runtime = *mesh->runtime;
+  restore_cache(runtime.corner_tri_faces_cache, corner_tri_faces_cache_);
+  restore_cache(runtime.vert_to_face_offset_cache, vert_to_face_offset_cache_);
+  restore_cache(runtime.vert_to_face_map_cache, vert_to_face_map_cache_);
+  restore_cache(runtime.vert_to_corner_map_cache, vert_to_corner_map_cache_);
+  restore_cache(runtime.corner_to_face_map_cache, corner_to_face_map_cache_);
+  restore_cache(runtime.loose_edges_cache, loose_edges_cache_);
+  restore_cache(runtime.loose_verts_cache, loose_verts_cache_);
+  restore_cache(runtime.verts_no_face_cache, verts_no_face_cache_);
+
+  if (!positions_.matches(layer_reference(mesh->vert_data, CD_PROP_FLOAT3, "position"))) {
+    return;
+  }
+
+  restore_cache(runtime.bounds_cache, bounds_cache_);
+  restore_cache(runtime.vert_normals_cache, vert_normals_cache_);
+  restore_cache(runtime.face_normals_cache, face_normals_cache_);
+  restore_cache(runtime.corner_tris_cache.data, corner_tris_cache_.data);
+  restore_cache(runtime.bvh_cache_verts, bvh_cache_verts_);
+  restore_cache(runtime.bvh_cache_edges, bvh_cache_edges_);
+  restore_cache(runtime.bvh_cache_faces, bvh_cache_faces_);
+  restore_cache(runtime.bvh_cache_corner_tris, bvh_cache_corner_tris_);
+  restore_cache(runtime.bvh_cache_loose_verts, bvh_cache_loose_verts_);
+  restore_cache(runtime.bvh_cache_loose_edges, bvh_cache_loose_edges_);
+  restore_cache(runtime.shrinkwrap_boundary_cache, shrinkwrap_boundary_cache_);
+}
+
+}  // namespace blender::deg
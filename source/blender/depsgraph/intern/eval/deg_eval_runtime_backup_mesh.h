@@ -0,0 +1,81 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#pragma once
+
+#include "BLI_implicit_sharing_ptr.hh"
+#include "BLI_shared_cache.hh"
+
+#include "BKE_mesh_types.hh"
+
+struct Mesh;
+
+namespace blender::deg {
+
+struct Depsgraph;
+
+/* Backup of derived caches of an evaluated mesh.
+ *
+ * When the evaluated copy of a mesh is re-created (for example after editing UVs of the original
+ * mesh) most of its attributes are still shared with the previous copy. The caches which only
+ * depend on such unchanged attributes are moved to the new copy instead of being recomputed. */
+class MeshBackup {
+ public:
+  MeshBackup(const Depsgraph *depsgraph);
+
+  void init_from_mesh(Mesh *mesh);
+  void restore_to_mesh(Mesh *mesh);
+
+  /* Data of a geometry array the caches depend on. The sharing info reference is kept so the
+   * memory can not be re-used by other data while the backup is alive. */
+  struct DataReference {
+    const void *data = nullptr;
+    ImplicitSharingPtr<> sharing_info;
+
+    bool matches(const DataReference &other) const;
+  };
+
+ private:
+  bool have_backup_;
+
+  int verts_num_;
+  int edges_num_;
+  int faces_num_;
+  int corners_num_;
+
+  DataReference positions_;
+  DataReference edges_;
+  DataReference face_offsets_;
+  DataReference corner_verts_;
+  DataReference corner_edges_;
+
+  /* Caches depending on positions and topology. */
+  SharedCache<Bounds<float3>> bounds_cache_;
+  SharedCache<Vector<float3>> vert_normals_cache_;
+  SharedCache<Vector<float3>> face_normals_cache_;
+  bke::TrianglesCache corner_tris_cache_;
+  SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_verts_;
+  SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_edges_;
+  SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_faces_;
+  SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_corner_tris_;
+  SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_verts_;
+  SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_edges_;
+  SharedCache<ShrinkwrapBoundaryData> shrinkwrap_boundary_cache_;
+
+  /* Caches depending on topology only. */
+  SharedCache<Array<int>> corner_tri_faces_cache_;
+  SharedCache<Array<int>> vert_to_face_offset_cache_;
+  SharedCache<Array<int>> vert_to_face_map_cache_;
+  SharedCache<Array<int>> vert_to_corner_map_cache_;
+  SharedCache<Array<int>> corner_to_face_map_cache_;
+  SharedCache<bke::LooseEdgeCache> loose_edges_cache_;
+  SharedCache<bke::LooseVertCache> loose_verts_cache_;
+  SharedCache<bke::LooseVertCache> verts_no_face_cache_;
+};
+
+}  // namespace blender::deg
@@ -8,7 +8,12 @@
 
 #include "intern/eval/deg_eval_stats.h"
 
+#include <algorithm>
+
+#include "BLI_vector.hh"
+
 #include "intern/depsgraph.hh"
+#include "intern/depsgraph_relation.hh"
 
 #include "intern/node/deg_node.hh"
 #include "intern/node/deg_node_component.hh"
@@ -37,4 +42,60 @@ void deg_eval_stats_aggregate(Depsgraph *graph)
   }
 }
 
+/* Cost in seconds given to operations which were too fast to be measured, so that long chains of
+ * cheap operations are still preferred over short ones. */
+static constexpr double MIN_OPERATION_COST = 1e-7;
+
+/* Cost in seconds assumed for operations which were never timed. Deliberately pessimistic, so that
+ * operations are only considered cheap once their timing has actually been measured. */
+static constexpr double UNTIMED_OPERATION_COST = 1e-5;
+
+static bool is_critical_path_relation(const Relation *rel)
+{
+  return rel->to->type == NodeType::OPERATION && (rel->flag & RELATION_FLAG_CYCLIC) == 0;
+}
+
+void deg_eval_stats_update_critical_path(Depsgraph *graph, const bool use_timing)
+{
+  /* Traverse the graph in reverse topological order, starting from operations which have no
+   * dependents. The number of not yet visited dependents is stored in the custom flags. */
+  Vector<OperationNode *> stack;
+  for (OperationNode *op_node : graph->operations) {
+    int num_dependents = 0;
+    for (const Relation *rel : op_node->outlinks) {
+      if (is_critical_path_relation(rel)) {
+        num_dependents++;
+      }
+    }
+    op_node->custom_flags = num_dependents;
+    op_node->critical_path_cost = 0.0;
+    if (num_dependents == 0) {
+      stack.append(op_node);
+    }
+  }
+
+  while (!stack.is_empty()) {
+    OperationNode *op_node = stack.pop_last();
+    double own_cost = UNTIMED_OPERATION_COST;
+    if (op_node->is_noop()) {
+      own_cost = 0.0;
+    }
+    else if (use_timing && op_node->stats.current_time > 0.0) {
+      /* The operation was evaluated during the last update, its timing is known. */
+      own_cost = std::max(op_node->stats.current_time, MIN_OPERATION_COST);
+    }
+    op_node->critical_path_cost += own_cost;
+    for (Relation *rel : op_node->inlinks) {
+      if (rel->from->type != NodeType::OPERATION || (rel->flag & RELATION_FLAG_CYCLIC)) {
+        continue;
+      }
+      OperationNode *from = static_cast<OperationNode *>(rel->from);
+      from->critical_path_cost = std::max(from->critical_path_cost, op_node->critical_path_cost);
+      if (--from->custom_flags == 0) {
+        stack.append(from);
+      }
+    }
+  }
+}
+
 }  // namespace blender::deg
@@ -15,4 +15,9 @@ struct Depsgraph;
 /* Aggregate operation timings to overall component and ID nodes timing. */
 void deg_eval_stats_aggregate(Depsgraph *graph);
 
+/* Update the critical path cost of every operation: the cost in seconds of the longest chain of
+ * operations which depends on it. When `use_timing` is true the timing of the last evaluation is
+ * used as a cost of an operation, otherwise every operation has the same estimated cost. */
+void deg_eval_stats_update_critical_path(Depsgraph *graph, bool use_timing);
+
 }  // namespace blender::deg
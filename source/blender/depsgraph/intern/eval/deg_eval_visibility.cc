@@ -40,7 +40,9 @@ void deg_evaluate_object_node_visibility(::Depsgraph *depsgraph, IDNode *id_node
                                                                   BASE_ENABLED_RENDER;
 
   const bool is_enabled = !graph->use_visibility_optimization ||
-                          object->base_flag & required_flags;
+                          ((object->base_flag & required_flags) &&
+                           !graph->deferred_objects.contains(
+                               reinterpret_cast<const Object *>(id_node->id_orig)));
 
   if (id_node->is_enabled_on_eval != is_enabled) {
     id_node->is_enabled_on_eval = is_enabled;
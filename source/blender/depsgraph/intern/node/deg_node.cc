@@ -268,12 +268,15 @@ Node::Stats::Stats()
 
 void Node::Stats::reset()
 {
-  current_time = 0.0;
+  reset_current();
 }
 
 void Node::Stats::reset_current()
 {
   current_time = 0.0;
+  current_begin_time = 0.0;
+  current_end_time = 0.0;
+  current_thread_id = -1;
 }
 
 /*******************************************************************************
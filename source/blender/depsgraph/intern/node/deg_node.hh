@@ -170,6 +170,12 @@ struct Node {
     void reset_current();
     /* Time spent on this node during current graph evaluation. */
     double current_time;
+    /* Point in time when evaluation of the node began and ended during current graph evaluation,
+     * and index of the thread which evaluated it. Only filled in for operation nodes, used for the
+     * evaluation timeline export. */
+    double current_begin_time;
+    double current_end_time;
+    int current_thread_id;
   };
   /* Relationships between nodes
    * The reason why all depsgraph nodes are descended from this type (apart
@@ -285,6 +285,10 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Estimated cost of the longest chain of operations which starts at this operation, including
+   * its own cost. Used by the evaluation engine to run operations on the critical path first. */
+  double critical_path_cost;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
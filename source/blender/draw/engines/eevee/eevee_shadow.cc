@@ -102,6 +102,12 @@ void ShadowTileMap::sync_cubeface(eLightType light_type_,
     set_dirty();
   }
 
+  if (!is_dirty) {
+    /* The matrices only depend on the parameters above which did not change since the last
+     * sync. Skipping their computation matters for scenes with many static lights. */
+    return;
+  }
+
   winmat = math::projection::perspective(
       -half_size, half_size, -half_size, half_size, clip_near, clip_far);
   viewmat = float4x4(float3x3(shadow_face_mat[cubeface])) * math::invert(object_mat);
@@ -311,7 +311,8 @@ static DRWVolumeGrid *volume_grid_cache_get(const Volume *volume,
   }
 
   DenseFloatVolumeGrid dense_grid;
-  if (BKE_volume_grid_dense_floats(volume, grid, &dense_grid)) {
+  /* Don't extract voxels for grids that are too large to be uploaded as texture. */
+  if (BKE_volume_grid_dense_floats(volume, grid, &dense_grid, GPU_max_texture_3d_size())) {
     cache_grid->texture_to_object = float4x4(dense_grid.texture_to_object);
     cache_grid->object_to_texture = math::invert(cache_grid->texture_to_object);
 
@@ -40,6 +40,8 @@ void Manager::begin_sync()
   matrix_buf.swap();
   bounds_buf.swap();
   infos_buf.swap();
+  /* The cached index refers to the previous bounds buffer. */
+  last_instance_bounds_ = {};
 
   matrix_buf.current().trim_to_next_power_of_2(resource_len_);
   bounds_buf.current().trim_to_next_power_of_2(resource_len_);
@@ -115,6 +115,17 @@ class Manager {
 
   Object *object_active = nullptr;
 
+  /**
+   * Data and resource index of the last instance whose bounds were computed. Instances of the same
+   * geometry are usually synced one after the other and share their local bounds, which can be
+   * expensive to compute for some object types.
+   */
+  struct {
+    const ID *data = nullptr;
+    float inflate_bounds = 0.0f;
+    uint resource_index = 0;
+  } last_instance_bounds_;
+
  public:
   Manager(){};
   ~Manager();
@@ -302,6 +313,8 @@ class Manager {
 
  private:
   void sync_layer_attributes();
+  /** Compute the bounds of a new resource, reusing those of the previous instance if possible. */
+  void sync_object_bounds(const ObjectRef &ref, float inflate_bounds);
 
   /* Fingerprint of the manager in a certain state. Assured to not be 0.
    * Not reliable enough for general update detection. Only to be used for debugging assertion. */
@@ -321,7 +334,7 @@ inline ResourceHandleRange Manager::resource_handle(const ObjectRef &ref, float
 {
   bool is_active_object = (ref.dupli_object ? ref.dupli_parent : ref.object) == object_active;
   matrix_buf.current().get_or_resize(resource_len_).sync(*ref.object);
-  bounds_buf.current().get_or_resize(resource_len_).sync(*ref.object, inflate_bounds);
+  sync_object_bounds(ref, inflate_bounds);
   infos_buf.current().get_or_resize(resource_len_).sync(ref, is_active_object);
   return ResourceHandle(resource_len_++, (ref.object->transflag & OB_NEG_SCALE) != 0);
 }
@@ -342,12 +355,34 @@ inline ResourceHandle Manager::resource_handle(const ObjectRef &ref,
     bounds_buf.current().get_or_resize(resource_len_).sync(*bounds_center, *bounds_half_extent);
   }
   else {
-    bounds_buf.current().get_or_resize(resource_len_).sync(*ref.object);
+    sync_object_bounds(ref, 0.0f);
   }
   infos_buf.current().get_or_resize(resource_len_).sync(ref, is_active_object);
   return ResourceHandle(resource_len_++, (ref.object->transflag & OB_NEG_SCALE) != 0);
 }
 
+inline void Manager::sync_object_bounds(const ObjectRef &ref, const float inflate_bounds)
+{
+  ObjectBoundsBuf &buf = bounds_buf.current();
+  ObjectBounds &bounds = buf.get_or_resize(resource_len_);
+  const ID *data = static_cast<const ID *>(ref.object->data);
+  /* The bounds of these types don't only depend on their data. */
+  const bool bounds_from_data = ref.is_dupli() && data != nullptr &&
+                                !ELEM(ref.object->type, OB_MBALL, OB_ARMATURE);
+  if (bounds_from_data && data == last_instance_bounds_.data &&
+      inflate_bounds == last_instance_bounds_.inflate_bounds)
+  {
+    bounds = buf[last_instance_bounds_.resource_index];
+    return;
+  }
+  bounds.sync(*ref.object, inflate_bounds);
+  if (bounds_from_data) {
+    last_instance_bounds_.data = data;
+    last_instance_bounds_.inflate_bounds = inflate_bounds;
+    last_instance_bounds_.resource_index = resource_len_;
+  }
+}
+
 inline ResourceHandle Manager::resource_handle(const float4x4 &model_matrix)
 {
   matrix_buf.current().get_or_resize(resource_len_).sync(model_matrix);
@@ -381,6 +416,9 @@ inline void Manager::update_handle_bounds(ResourceHandle handle,
                                           float inflate_bounds)
 {
   bounds_buf.current()[handle.resource_index()].sync(*ref.object, inflate_bounds);
+  if (handle.resource_index() == last_instance_bounds_.resource_index) {
+    last_instance_bounds_ = {};
+  }
 }
 
 inline void Manager::update_handle_bounds(ResourceHandle handle,
@@ -388,6 +426,9 @@ inline void Manager::update_handle_bounds(ResourceHandle handle,
                                           const float3 &bounds_half_extent)
 {
   bounds_buf.current()[handle.resource_index()].sync(bounds_center, bounds_half_extent);
+  if (handle.resource_index() == last_instance_bounds_.resource_index) {
+    last_instance_bounds_ = {};
+  }
 }
 
 inline void Manager::extract_object_attributes(ResourceHandle handle,
@@ -9,6 +9,7 @@
  * Embeds GPU meshes inside of bke::pbvh::Tree nodes, used by mesh sculpt mode.
  */
 
+#include "BLI_bit_span_ops.hh"
 #include "BLI_map.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector_types.hh"
@@ -1798,9 +1799,15 @@ Span<gpu::VertBuf *> DrawCacheImpl::ensure_attribute_data(const Object &object,
     }
   }
 
-  /* TODO: It would be good to deallocate the bit vector if all of the bits have been reset to
-   * avoid unnecessary processing in subsequent redraws. */
-  dirty_mask.foreach_index_optimized<int>([&](const int i) { data.dirty_nodes[i].reset(); });
+  if (!dirty_mask.is_empty()) {
+    dirty_mask.foreach_index_optimized<int>([&](const int i) { data.dirty_nodes[i].reset(); });
+    /* Deallocate the bit vector once every tagged node has been updated, so subsequent redraws
+     * don't have to scan it. Nodes outside of the requested mask (e.g. hidden by frustum culling)
+     * keep their tags until they are drawn. */
+    if (!bits::any_bit_set(data.dirty_nodes)) {
+      data.dirty_nodes.clear_and_shrink();
+    }
+  }
 
   flush_vbo_data(vbos, mask);
 
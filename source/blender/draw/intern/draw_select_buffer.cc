@@ -158,10 +158,15 @@ uint *DRW_select_buffer_bitmap_from_rect(
 
   BLI_bitmap *bitmap_buf = BLI_BITMAP_NEW(bitmap_len, __func__);
   const uint *buf_iter = buf;
+  /* Neighboring pixels mostly belong to the same element, skip runs of the same ID. */
+  uint prev_id = 0;
   while (buf_len--) {
-    const uint index = *buf_iter - 1;
-    if (index < bitmap_len) {
-      BLI_BITMAP_ENABLE(bitmap_buf, index);
+    if (*buf_iter != prev_id) {
+      prev_id = *buf_iter;
+      const uint index = prev_id - 1;
+      if (index < bitmap_len) {
+        BLI_BITMAP_ENABLE(bitmap_buf, index);
+      }
     }
     buf_iter++;
   }
@@ -276,10 +281,16 @@ uint *DRW_select_buffer_bitmap_from_poly(Depsgraph *depsgraph,
   BLI_bitmap *bitmap_buf = BLI_BITMAP_NEW(bitmap_len, __func__);
   const uint *buf_iter = buf;
   int i = 0;
+  /* Neighboring pixels mostly belong to the same element, skip runs of the same ID. An ID is only
+   * remembered once it was inside the mask, so it is not skipped for later masked pixels. */
+  uint prev_id = 0;
   while (buf_len--) {
-    const uint index = *buf_iter - 1;
-    if (index < bitmap_len && BLI_BITMAP_TEST(buf_mask, i)) {
-      BLI_BITMAP_ENABLE(bitmap_buf, index);
+    if (*buf_iter != prev_id && BLI_BITMAP_TEST(buf_mask, i)) {
+      prev_id = *buf_iter;
+      const uint index = prev_id - 1;
+      if (index < bitmap_len) {
+        BLI_BITMAP_ENABLE(bitmap_buf, index);
+      }
     }
     buf_iter++;
     i++;
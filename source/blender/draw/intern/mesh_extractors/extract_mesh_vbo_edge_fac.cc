@@ -253,18 +253,17 @@ void extract_edge_factor_subdiv(const DRWSubdivCache &subdiv_cache,
   /* Make sure buffer is active for sending loose data. */
   GPU_vertbuf_use(&vbo);
 
+  /* The values for loose edges are contiguous, upload them at once. */
   const int offset = subdiv_cache.num_subdiv_loops;
   if (GPU_crappy_amd_driver() || GPU_minimum_per_vertex_stride() > 1) {
-    const float values[2] = {1.0f, 1.0f};
-    for (const int i : IndexRange(loose_edges_num)) {
-      GPU_vertbuf_update_sub(&vbo, (offset + i * 2) * sizeof(float), sizeof(values), values);
-    }
+    const Array<float> values(loose_edges_num * 2, 1.0f);
+    GPU_vertbuf_update_sub(
+        &vbo, offset * sizeof(float), values.as_span().size_in_bytes(), values.data());
   }
   else {
-    const uint8_t values[2] = {255, 255};
-    for (const int i : IndexRange(loose_edges_num)) {
-      GPU_vertbuf_update_sub(&vbo, (offset + i * 2) * sizeof(uint8_t), sizeof(values), values);
-    }
+    const Array<uint8_t> values(loose_edges_num * 2, 255);
+    GPU_vertbuf_update_sub(
+        &vbo, offset * sizeof(uint8_t), values.as_span().size_in_bytes(), values.data());
   }
 }
 
@@ -123,12 +123,14 @@ static void extract_edit_data_mesh(const MeshRenderData &mr, MutableSpan<EditLoo
   const Span<int> corner_edges = mr.corner_edges;
   threading::parallel_for(faces.index_range(), 2048, [&](const IndexRange range) {
     for (const int face : range) {
+      /* The face flags are shared by all corners of the face. */
+      EditLoopData face_value{};
+      if (const BMFace *bm_face = bm_original_face_get(mr, face)) {
+        mesh_render_data_face_flag(mr, bm_face, {-1, -1, -1, -1}, face_value);
+      }
       for (const int corner : faces[face]) {
         EditLoopData &value = corners_data[corner];
-        value = {};
-        if (const BMFace *bm_face = bm_original_face_get(mr, face)) {
-          mesh_render_data_face_flag(mr, bm_face, {-1, -1, -1, -1}, value);
-        }
+        value = face_value;
         if (const BMVert *bm_vert = bm_original_vert_get(mr, corner_verts[corner])) {
           mesh_render_data_vert_flag(mr, bm_vert, value);
         }
@@ -185,12 +187,12 @@ static void extract_edit_data_bm(const MeshRenderData &mr, MutableSpan<EditLoopD
   threading::parallel_for(IndexRange(bm.totface), 2048, [&](const IndexRange range) {
     for (const int face_index : range) {
       const BMFace &face = *BM_face_at_index(&const_cast<BMesh &>(bm), face_index);
+      EditLoopData face_value{};
+      mesh_render_data_face_flag(mr, &face, {-1, -1, -1, -1}, face_value);
       const BMLoop *loop = BM_FACE_FIRST_LOOP(&face);
       for ([[maybe_unused]] const int i : IndexRange(face.len)) {
         const int index = BM_elem_index_get(loop);
-        EditLoopData &value = corners_data[index];
-        value = {};
-        mesh_render_data_face_flag(mr, &face, {-1, -1, -1, -1}, corners_data[index]);
+        corners_data[index] = face_value;
         mesh_render_data_edge_flag(mr, loop->e, corners_data[index]);
         mesh_render_data_vert_flag(mr, loop->v, corners_data[index]);
         loop = loop->next;
@@ -255,13 +257,13 @@ static void extract_edit_subdiv_data_mesh(const MeshRenderData &mr,
   threading::parallel_for(IndexRange(subdiv_cache.num_subdiv_quads), 2048, [&](IndexRange range) {
     for (const int subdiv_quad : range) {
       const int coarse_face = subdiv_loop_face_index[subdiv_quad * 4];
+      EditLoopData face_value{};
+      if (const BMFace *bm_face = bm_original_face_get(mr, coarse_face)) {
+        mesh_render_data_face_flag(mr, bm_face, {-1, -1, -1, -1}, face_value);
+      }
       for (const int subdiv_corner : IndexRange(subdiv_quad * 4, 4)) {
         EditLoopData &value = corners_data[subdiv_corner];
-        value = {};
-
-        if (const BMFace *bm_face = bm_original_face_get(mr, coarse_face)) {
-          mesh_render_data_face_flag(mr, bm_face, {-1, -1, -1, -1}, value);
-        }
+        value = face_value;
 
         const int vert_origindex = subdiv_loop_vert_index[subdiv_corner];
         if (vert_origindex != -1) {
@@ -334,11 +336,11 @@ static void extract_edit_subdiv_data_bm(const MeshRenderData &mr,
     for (const int subdiv_quad : range) {
       const int coarse_face = subdiv_loop_face_index[subdiv_quad * 4];
       const BMFace *bm_face = BM_face_at_index(&bm, coarse_face);
+      EditLoopData face_value{};
+      mesh_render_data_face_flag(mr, bm_face, {-1, -1, -1, -1}, face_value);
       for (const int subdiv_corner : IndexRange(subdiv_quad * 4, 4)) {
         EditLoopData &value = corners_data[subdiv_corner];
-        value = {};
-
-        mesh_render_data_face_flag(mr, bm_face, {-1, -1, -1, -1}, value);
+        value = face_value;
 
         const int vert_origindex = subdiv_loop_vert_index[subdiv_corner];
         if (vert_origindex != -1) {
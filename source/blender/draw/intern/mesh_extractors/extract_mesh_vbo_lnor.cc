@@ -341,12 +341,16 @@ void extract_normals_subdiv(const MeshRenderData &mr,
   GPU_vertbuf_use(&lnor);
 
   /* Default to zeroed attribute. The overlay shader should expect this and render engines should
-   * never draw loose geometry. */
-  const float4 default_normal(0.0f, 0.0f, 0.0f, 0.0f);
-  for (const int i : IndexRange::from_begin_end(loose_geom_start, vbo_size)) {
-    /* TODO(fclem): This has HORRENDOUS performance. Prefer clearing the buffer on device with
-     * something like glClearBufferSubData. */
-    GPU_vertbuf_update_sub(&lnor, i * sizeof(float4), sizeof(float4), &default_normal);
+   * never draw loose geometry. The loose geometry is contiguous at the end of the buffer, so
+   * upload it at once rather than with one update per element.
+   * TODO(fclem): Prefer clearing the buffer on device with something like glClearBufferSubData. */
+  const int loose_geom_num = vbo_size - loose_geom_start;
+  if (loose_geom_num > 0) {
+    const Array<float4> default_normals(loose_geom_num, float4(0.0f));
+    GPU_vertbuf_update_sub(&lnor,
+                           loose_geom_start * sizeof(float4),
+                           default_normals.as_span().size_in_bytes(),
+                           default_normals.data());
   }
 }
 }  // namespace blender::draw
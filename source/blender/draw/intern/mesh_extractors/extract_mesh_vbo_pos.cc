@@ -151,33 +151,35 @@ static void extract_loose_positions_subdiv(const DRWSubdivCache &subdiv_cache,
 
   const int loose_geom_start = subdiv_cache.num_subdiv_loops;
 
-  SubdivPosNorLoop edge_data[2];
-  memset(edge_data, 0, sizeof(SubdivPosNorLoop) * 2);
-  for (const int i : IndexRange(loose_edges_num)) {
-    const int edge_offset = loose_geom_start + i * verts_per_edge;
-    const Span<float3> positions = cached_positions.slice(i * resolution, resolution);
-    for (const int edge : IndexRange(edges_per_edge)) {
-      copy_v3_v3(edge_data[0].pos, positions[edge + 0]);
-      copy_v3_v3(edge_data[1].pos, positions[edge + 1]);
-      GPU_vertbuf_update_sub(&vbo,
-                             (edge_offset + edge * 2) * sizeof(SubdivPosNorLoop),
-                             sizeof(SubdivPosNorLoop) * 2,
-                             &edge_data);
+  /* Loose edges and vertices are stored contiguously after the face corners, so gather their
+   * data in a temporary array and upload it at once, rather than with one update per element. */
+  Array<SubdivPosNorLoop> loose_data(loose_edges_num * verts_per_edge + loose_verts.size());
+  memset(loose_data.data(), 0, loose_data.as_span().size_in_bytes());
+  MutableSpan<SubdivPosNorLoop> edge_data = loose_data.as_mutable_span().take_front(
+      loose_edges_num * verts_per_edge);
+  MutableSpan<SubdivPosNorLoop> vert_data = loose_data.as_mutable_span().take_back(
+      loose_verts.size());
+
+  threading::parallel_for(IndexRange(loose_edges_num), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const Span<float3> positions = cached_positions.slice(i * resolution, resolution);
+      MutableSpan<SubdivPosNorLoop> data = edge_data.slice(i * verts_per_edge, verts_per_edge);
+      for (const int edge : IndexRange(edges_per_edge)) {
+        copy_v3_v3(data[edge * 2 + 0].pos, positions[edge + 0]);
+        copy_v3_v3(data[edge * 2 + 1].pos, positions[edge + 1]);
+      }
     }
-  }
+  });
 
-  const int loose_verts_start = loose_geom_start + loose_edges_num * verts_per_edge;
   const Span<float3> positions = mr.vert_positions;
-
-  SubdivPosNorLoop vert_data;
-  memset(&vert_data, 0, sizeof(SubdivPosNorLoop));
   for (const int i : loose_verts.index_range()) {
-    copy_v3_v3(vert_data.pos, positions[loose_verts[i]]);
-    GPU_vertbuf_update_sub(&vbo,
-                           (loose_verts_start + i) * sizeof(SubdivPosNorLoop),
-                           sizeof(SubdivPosNorLoop),
-                           &vert_data);
+    copy_v3_v3(vert_data[i].pos, positions[loose_verts[i]]);
   }
+
+  GPU_vertbuf_update_sub(&vbo,
+                         loose_geom_start * sizeof(SubdivPosNorLoop),
+                         loose_data.as_span().size_in_bytes(),
+                         loose_data.data());
 }
 
 void extract_positions_subdiv(const DRWSubdivCache &subdiv_cache,
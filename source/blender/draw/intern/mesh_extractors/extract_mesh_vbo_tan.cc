@@ -159,6 +159,41 @@ static void extract_tan_init_common(const MeshRenderData &mr,
   *r_tan_len = tan_len;
 }
 
+template<typename GPUType> static GPUType convert_tangent(const float4 &tangent);
+
+template<> short4 convert_tangent(const float4 &tangent)
+{
+  short4 value = gpu::convert_normal<short4>(tangent.xyz());
+  value[3] = (tangent[3] > 0.0f) ? SHRT_MAX : SHRT_MIN;
+  return value;
+}
+
+template<> gpu::PackedNormal convert_tangent(const float4 &tangent)
+{
+  gpu::PackedNormal value = gpu::convert_normal<gpu::PackedNormal>(tangent.xyz());
+  value.w = (tangent[3] > 0.0f) ? 1 : -2;
+  return value;
+}
+
+/**
+ * Tangents are recalculated whenever a deforming mesh changes, so convert the layers to the GPU
+ * format in parallel. The layers are stored one after the other in the buffer.
+ */
+template<typename GPUType>
+static void convert_tangent_layers(const Span<Span<float4>> layers, MutableSpan<GPUType> vbo_data)
+{
+  int offset = 0;
+  for (const Span<float4> src : layers) {
+    MutableSpan<GPUType> dst = vbo_data.slice(offset, src.size());
+    threading::parallel_for(src.index_range(), 4096, [&](const IndexRange range) {
+      for (const int corner : range) {
+        dst[corner] = convert_tangent<GPUType>(src[corner]);
+      }
+    });
+    offset += src.size();
+  }
+}
+
 void extract_tangents(const MeshRenderData &mr,
                       const MeshBatchCache &cache,
                       const bool use_hq,
@@ -187,49 +222,24 @@ void extract_tangents(const MeshRenderData &mr,
   GPU_vertbuf_init_with_format(vbo, format);
   GPU_vertbuf_data_alloc(vbo, v_len);
 
+  Vector<Span<float4>> layers;
+  for (int i = 0; i < tan_len; i++) {
+    const char *name = tangent_names[i];
+    layers.append({static_cast<const float4 *>(
+                       CustomData_get_layer_named(&corner_data, CD_TANGENT, name)),
+                   mr.corners_num});
+  }
+  if (use_orco_tan) {
+    layers.append(
+        {static_cast<const float4 *>(CustomData_get_layer_n(&corner_data, CD_TANGENT, 0)),
+         mr.corners_num});
+  }
+
   if (use_hq) {
-    short4 *tan_data = vbo.data<short4>().data();
-    for (int i = 0; i < tan_len; i++) {
-      const char *name = tangent_names[i];
-      const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_named(
-          &corner_data, CD_TANGENT, name);
-      for (int corner = 0; corner < mr.corners_num; corner++) {
-        *tan_data = gpu::convert_normal<short4>(layer_data[corner]);
-        (*tan_data)[3] = (layer_data[corner][3] > 0.0f) ? SHRT_MAX : SHRT_MIN;
-        tan_data++;
-      }
-    }
-    if (use_orco_tan) {
-      const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_n(
-          &corner_data, CD_TANGENT, 0);
-      for (int corner = 0; corner < mr.corners_num; corner++) {
-        *tan_data = gpu::convert_normal<short4>(layer_data[corner]);
-        (*tan_data)[3] = (layer_data[corner][3] > 0.0f) ? SHRT_MAX : SHRT_MIN;
-        tan_data++;
-      }
-    }
+    convert_tangent_layers(layers, vbo.data<short4>());
   }
   else {
-    gpu::PackedNormal *tan_data = vbo.data<gpu::PackedNormal>().data();
-    for (int i = 0; i < tan_len; i++) {
-      const char *name = tangent_names[i];
-      const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_named(
-          &corner_data, CD_TANGENT, name);
-      for (int corner = 0; corner < mr.corners_num; corner++) {
-        *tan_data = gpu::convert_normal<gpu::PackedNormal>(layer_data[corner]);
-        tan_data->w = (layer_data[corner][3] > 0.0f) ? 1 : -2;
-        tan_data++;
-      }
-    }
-    if (use_orco_tan) {
-      const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_n(
-          &corner_data, CD_TANGENT, 0);
-      for (int corner = 0; corner < mr.corners_num; corner++) {
-        *tan_data = gpu::convert_normal<gpu::PackedNormal>(layer_data[corner]);
-        tan_data->w = (layer_data[corner][3] > 0.0f) ? 1 : -2;
-        tan_data++;
-      }
-    }
+    convert_tangent_layers(layers, vbo.data<gpu::PackedNormal>());
   }
 
   CustomData_free(&corner_data);
@@ -784,31 +784,48 @@ bke::CurvesGeometry create_curves_outline(const bke::greasepencil::Drawing &draw
   Array<int> dst_curve_map(dst_curve_num);
   Array<int> dst_point_map(dst_point_num);
 
-  IndexRange curves;
-  IndexRange points;
-  for (const PerimeterData &data : thread_data) {
-    curves = curves.after(data.point_counts.size());
-    points = points.after(data.positions.size());
-
-    /* Append curve data. */
-    dst_curve_map.as_mutable_span().slice(curves).copy_from(data.curve_indices);
-    /* Curve offsets are accumulated below. */
-    dst_offsets.slice(curves).copy_from(data.point_counts);
-    dst_cyclic.span.slice(curves).fill(true);
-    if (material_index >= 0) {
-      dst_material.span.slice(curves).fill(material_index);
+  /* Find where the data of each thread goes, the copying itself can then run in parallel. */
+  Vector<const PerimeterData *> data_per_thread;
+  Vector<IndexRange> curves_per_thread;
+  Vector<IndexRange> points_per_thread;
+  {
+    IndexRange curves;
+    IndexRange points;
+    for (const PerimeterData &data : thread_data) {
+      curves = curves.after(data.point_counts.size());
+      points = points.after(data.positions.size());
+      data_per_thread.append(&data);
+      curves_per_thread.append(curves);
+      points_per_thread.append(points);
     }
-    else {
-      for (const int i : curves.index_range()) {
-        dst_material.span[curves[i]] = src_material_index[data.curve_indices[i]];
+  }
+
+  threading::parallel_for(data_per_thread.index_range(), 1, [&](const IndexRange range) {
+    for (const int thread_i : range) {
+      const PerimeterData &data = *data_per_thread[thread_i];
+      const IndexRange curves = curves_per_thread[thread_i];
+      const IndexRange points = points_per_thread[thread_i];
+
+      /* Append curve data. */
+      dst_curve_map.as_mutable_span().slice(curves).copy_from(data.curve_indices);
+      /* Curve offsets are accumulated below. */
+      dst_offsets.slice(curves).copy_from(data.point_counts);
+      dst_cyclic.span.slice(curves).fill(true);
+      if (material_index >= 0) {
+        dst_material.span.slice(curves).fill(material_index);
+      }
+      else {
+        for (const int i : curves.index_range()) {
+          dst_material.span[curves[i]] = src_material_index[data.curve_indices[i]];
+        }
       }
-    }
 
-    /* Append point data. */
-    dst_positions.slice(points).copy_from(data.positions);
-    dst_point_map.as_mutable_span().slice(points).copy_from(data.point_indices);
-    dst_radius.span.slice(points).fill(outline_radius);
-  }
+      /* Append point data. */
+      dst_positions.slice(points).copy_from(data.positions);
+      dst_point_map.as_mutable_span().slice(points).copy_from(data.point_indices);
+      dst_radius.span.slice(points).fill(outline_radius);
+    }
+  });
   offset_indices::accumulate_counts_to_offsets(dst_curves.offsets_for_write());
 
   bke::gather_attributes(src_attributes,
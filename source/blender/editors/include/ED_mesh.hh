@@ -126,6 +126,12 @@ struct EDBMUpdate_Params {
  * So many tools call these that we better make it a generic function.
  */
 void EDBM_update(Mesh *mesh, const EDBMUpdate_Params *params);
+/**
+ * A version of #EDBM_update for non-destructive edits that only moved selected vertices.
+ * Only the faces using those vertices are re-tessellated (and optionally have their normals
+ * updated), falling back to a full update for large selections.
+ */
+void EDBM_update_selected_verts_moved(Mesh *mesh, bool calc_normals);
 /**
  * Bad level call from Python API.
  */
@@ -8,6 +8,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_bitmap.h"
 #include "BLI_kdtree.h"
 #include "BLI_listbase.h"
@@ -15,6 +16,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
 #include "BLI_set.hh"
+#include "BLI_task.hh"
 
 #include "BLT_translation.hh"
 
@@ -41,6 +43,8 @@
 
 #include "mesh_intern.hh" /* own include */
 
+using blender::Array;
+using blender::IndexRange;
 using blender::Vector;
 
 /* -------------------------------------------------------------------- */
@@ -149,6 +153,61 @@ static void face_to_plane(const Object *ob, BMFace *face, float r_plane[4])
  *  -SIMFACE_AREA
  *  -SIMFACE_PERIMETER
  */
+/**
+ * Compare a face against the selected faces stored in a KD-tree, for the types that compare
+ * geometric properties. This only reads from the mesh, so it can run on multiple threads.
+ */
+static bool face_is_similar_in_tree(const Object *ob,
+                                    const float ob_m3[3][3],
+                                    const BMFace *face,
+                                    const int type,
+                                    const int compare,
+                                    const float thresh,
+                                    const float thresh_radians,
+                                    const KDTree_1d *tree_1d,
+                                    const KDTree_3d *tree_3d,
+                                    const KDTree_4d *tree_4d)
+{
+  switch (type) {
+    case SIMFACE_AREA: {
+      const float area = BM_face_calc_area_with_mat3(face, ob_m3);
+      return ED_select_similar_compare_float_tree(tree_1d, area, thresh, eSimilarCmp(compare));
+    }
+    case SIMFACE_PERIMETER: {
+      const float perimeter = BM_face_calc_perimeter_with_mat3(face, ob_m3);
+      return ED_select_similar_compare_float_tree(
+          tree_1d, perimeter, thresh, eSimilarCmp(compare));
+    }
+    case SIMFACE_NORMAL: {
+      float normal[3];
+      copy_v3_v3(normal, face->no);
+      mul_transposed_mat3_m4_v3(ob->world_to_object().ptr(), normal);
+      normalize_v3(normal);
+
+      /* We are treating the normals as coordinates, the "nearest" one will
+       * also be the one closest to the angle. */
+      KDTreeNearest_3d nearest;
+      if (BLI_kdtree_3d_find_nearest(tree_3d, normal, &nearest) != -1) {
+        return angle_normalized_v3v3(normal, nearest.co) <= thresh_radians;
+      }
+      return false;
+    }
+    case SIMFACE_COPLANAR: {
+      float plane[4];
+      face_to_plane(ob, const_cast<BMFace *>(face), plane);
+
+      KDTreeNearest_4d nearest;
+      if (BLI_kdtree_4d_find_nearest(tree_4d, plane, &nearest) != -1) {
+        return (nearest.dist <= thresh) && (fabsf(plane[3] - nearest.co[3]) <= thresh) &&
+               (angle_v3v3(plane, nearest.co) <= thresh_radians);
+      }
+      return false;
+    }
+  }
+  BLI_assert_unreachable();
+  return false;
+}
+
 static wmOperatorStatus similar_face_select_exec(bContext *C, wmOperator *op)
 {
   const Scene *scene = CTX_data_scene(C);
@@ -335,122 +394,104 @@ static wmOperatorStatus similar_face_select_exec(bContext *C, wmOperator *op)
       }
     }
 
-    BMFace *face; /* Mesh face. */
-    BMIter iter;  /* Selected faces iterator. */
+    if (ELEM(type, SIMFACE_AREA, SIMFACE_PERIMETER, SIMFACE_NORMAL, SIMFACE_COPLANAR)) {
+      /* Computing the face properties and querying the tree is the expensive part of these
+       * types, do that in parallel and only change the selection on the main thread. */
+      BM_mesh_elem_table_ensure(bm, BM_FACE);
+      Array<bool> faces_to_select(bm->totface);
+      blender::threading::parallel_for(IndexRange(bm->totface), 1024, [&](const IndexRange range) {
+        for (const int i : range) {
+          const BMFace *face = BM_face_at_index(bm, i);
+          faces_to_select[i] = !BM_elem_flag_test(face, BM_ELEM_SELECT) &&
+                               !BM_elem_flag_test(face, BM_ELEM_HIDDEN) &&
+                               face_is_similar_in_tree(ob,
+                                                       ob_m3,
+                                                       face,
+                                                       type,
+                                                       compare,
+                                                       thresh,
+                                                       thresh_radians,
+                                                       tree_1d,
+                                                       tree_3d,
+                                                       tree_4d);
+        }
+      });
+      for (const int i : faces_to_select.index_range()) {
+        if (faces_to_select[i]) {
+          BM_face_select_set(bm, BM_face_at_index(bm, i), true);
+          changed = true;
+        }
+      }
+    }
+    else {
+      BMFace *face; /* Mesh face. */
+      BMIter iter;  /* Selected faces iterator. */
 
-    BM_ITER_MESH (face, &iter, bm, BM_FACES_OF_MESH) {
-      if (!BM_elem_flag_test(face, BM_ELEM_SELECT) && !BM_elem_flag_test(face, BM_ELEM_HIDDEN)) {
-        bool select = false;
-        switch (type) {
-          case SIMFACE_SIDES: {
-            const int num_sides = face->len;
-            GSetIterator gs_iter;
-            GSET_ITER (gs_iter, gset) {
-              const int num_sides_iter = POINTER_AS_INT(BLI_gsetIterator_getKey(&gs_iter));
-              const int delta_i = num_sides - num_sides_iter;
-              if (mesh_select_similar_compare_int(delta_i, compare)) {
-                select = true;
-                break;
+      BM_ITER_MESH (face, &iter, bm, BM_FACES_OF_MESH) {
+        if (!BM_elem_flag_test(face, BM_ELEM_SELECT) && !BM_elem_flag_test(face, BM_ELEM_HIDDEN)) {
+          bool select = false;
+          switch (type) {
+            case SIMFACE_SIDES: {
+              const int num_sides = face->len;
+              GSetIterator gs_iter;
+              GSET_ITER (gs_iter, gset) {
+                const int num_sides_iter = POINTER_AS_INT(BLI_gsetIterator_getKey(&gs_iter));
+                const int delta_i = num_sides - num_sides_iter;
+                if (mesh_select_similar_compare_int(delta_i, compare)) {
+                  select = true;
+                  break;
+                }
               }
+              break;
             }
-            break;
-          }
-          case SIMFACE_MATERIAL: {
-            const Material *material = (*material_array)[face->mat_nr];
-            if (material == nullptr) {
-              continue;
-            }
+            case SIMFACE_MATERIAL: {
+              const Material *material = (*material_array)[face->mat_nr];
+              if (material == nullptr) {
+                continue;
+              }
 
-            GSetIterator gs_iter;
-            GSET_ITER (gs_iter, gset) {
-              const Material *material_iter = static_cast<const Material *>(
-                  BLI_gsetIterator_getKey(&gs_iter));
-              if (material == material_iter) {
-                select = true;
-                break;
+              GSetIterator gs_iter;
+              GSET_ITER (gs_iter, gset) {
+                const Material *material_iter = static_cast<const Material *>(
+                    BLI_gsetIterator_getKey(&gs_iter));
+                if (material == material_iter) {
+                  select = true;
+                  break;
+                }
               }
+              break;
             }
-            break;
-          }
-          case SIMFACE_AREA: {
-            float area = BM_face_calc_area_with_mat3(face, ob_m3);
-            if (ED_select_similar_compare_float_tree(tree_1d, area, thresh, eSimilarCmp(compare)))
-            {
-              select = true;
-            }
-            break;
-          }
-          case SIMFACE_PERIMETER: {
-            float perimeter = BM_face_calc_perimeter_with_mat3(face, ob_m3);
-            if (ED_select_similar_compare_float_tree(
-                    tree_1d, perimeter, thresh, eSimilarCmp(compare)))
-            {
-              select = true;
-            }
-            break;
-          }
-          case SIMFACE_NORMAL: {
-            float normal[3];
-            copy_v3_v3(normal, face->no);
-            mul_transposed_mat3_m4_v3(ob->world_to_object().ptr(), normal);
-            normalize_v3(normal);
-
-            /* We are treating the normals as coordinates, the "nearest" one will
-             * also be the one closest to the angle. */
-            KDTreeNearest_3d nearest;
-            if (BLI_kdtree_3d_find_nearest(tree_3d, normal, &nearest) != -1) {
-              if (angle_normalized_v3v3(normal, nearest.co) <= thresh_radians) {
+            case SIMFACE_SMOOTH:
+              if ((BM_elem_flag_test(face, BM_ELEM_SMOOTH) != 0) ==
+                  ((face_data_value & SIMFACE_DATA_TRUE) != 0))
+              {
                 select = true;
               }
-            }
-            break;
-          }
-          case SIMFACE_COPLANAR: {
-            float plane[4];
-            face_to_plane(ob, face, plane);
+              break;
+            case SIMFACE_FREESTYLE: {
+              FreestyleFace *fface;
 
-            KDTreeNearest_4d nearest;
-            if (BLI_kdtree_4d_find_nearest(tree_4d, plane, &nearest) != -1) {
-              if (nearest.dist <= thresh) {
-                if ((fabsf(plane[3] - nearest.co[3]) <= thresh) &&
-                    (angle_v3v3(plane, nearest.co) <= thresh_radians))
-                {
-                  select = true;
-                }
+              if (!has_custom_data_layer) {
+                BLI_assert(face_data_value == SIMFACE_DATA_FALSE);
+                select = true;
+                break;
               }
-            }
-            break;
-          }
-          case SIMFACE_SMOOTH:
-            if ((BM_elem_flag_test(face, BM_ELEM_SMOOTH) != 0) ==
-                ((face_data_value & SIMFACE_DATA_TRUE) != 0))
-            {
-              select = true;
-            }
-            break;
-          case SIMFACE_FREESTYLE: {
-            FreestyleFace *fface;
 
-            if (!has_custom_data_layer) {
-              BLI_assert(face_data_value == SIMFACE_DATA_FALSE);
-              select = true;
+              fface = static_cast<FreestyleFace *>(
+                  CustomData_bmesh_get(&bm->pdata, face->head.data, CD_FREESTYLE_FACE));
+              if (((fface != nullptr) && (fface->flag & FREESTYLE_FACE_MARK)) ==
+                  ((face_data_value & SIMFACE_DATA_TRUE) != 0))
+              {
+                select = true;
+              }
               break;
             }
-
-            fface = static_cast<FreestyleFace *>(
-                CustomData_bmesh_get(&bm->pdata, face->head.data, CD_FREESTYLE_FACE));
-            if (((fface != nullptr) && (fface->flag & FREESTYLE_FACE_MARK)) ==
-                ((face_data_value & SIMFACE_DATA_TRUE) != 0))
-            {
-              select = true;
-            }
-            break;
           }
-        }
 
-        if (select) {
-          BM_face_select_set(bm, face, true);
-          changed = true;
+          if (select) {
+            BM_face_select_set(bm, face, true);
+            changed = true;
+          }
         }
       }
     }
@@ -2715,13 +2715,17 @@ static wmOperatorStatus edbm_do_smooth_vertex_exec(bContext *C, wmOperator *op)
       EDBM_verts_mirror_apply(em, BM_ELEM_SELECT, 0);
       EDBM_verts_mirror_cache_end(em);
       calc_normals = true;
-    }
 
-    EDBMUpdate_Params params{};
-    params.calc_looptris = true;
-    params.calc_normals = calc_normals;
-    params.is_destructive = false;
-    EDBM_update(static_cast<Mesh *>(obedit->data), &params);
+      /* Mirroring also moves unselected vertices. */
+      EDBMUpdate_Params params{};
+      params.calc_looptris = true;
+      params.calc_normals = calc_normals;
+      params.is_destructive = false;
+      EDBM_update(static_cast<Mesh *>(obedit->data), &params);
+    }
+    else {
+      EDBM_update_selected_verts_moved(static_cast<Mesh *>(obedit->data), calc_normals);
+    }
   }
 
   if (tot_selected == 0 && !tot_locked) {
@@ -2837,13 +2841,17 @@ static wmOperatorStatus edbm_do_smooth_laplacian_vertex_exec(bContext *C, wmOper
       EDBM_verts_mirror_apply(em, BM_ELEM_SELECT, 0);
       EDBM_verts_mirror_cache_end(em);
       calc_normals = true;
-    }
 
-    EDBMUpdate_Params params{};
-    params.calc_looptris = true;
-    params.calc_normals = calc_normals;
-    params.is_destructive = false;
-    EDBM_update(static_cast<Mesh *>(obedit->data), &params);
+      /* Mirroring also moves unselected vertices. */
+      EDBMUpdate_Params params{};
+      params.calc_looptris = true;
+      params.calc_normals = calc_normals;
+      params.is_destructive = false;
+      EDBM_update(static_cast<Mesh *>(obedit->data), &params);
+    }
+    else {
+      EDBM_update_selected_verts_moved(static_cast<Mesh *>(obedit->data), calc_normals);
+    }
   }
 
   if (tot_selected == 0 && !tot_locked) {
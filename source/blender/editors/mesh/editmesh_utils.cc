@@ -13,8 +13,10 @@
 #include "DNA_object_types.h"
 
 #include "BLI_array.hh"
+#include "BLI_bit_vector.hh"
 #include "BLI_kdtree.h"
 #include "BLI_listbase.h"
+#include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
 
@@ -1717,6 +1719,51 @@ void EDBM_update(Mesh *mesh, const EDBMUpdate_Params *params)
 #endif
 }
 
+void EDBM_update_selected_verts_moved(Mesh *mesh, const bool calc_normals)
+{
+  BMEditMesh *em = mesh->runtime->edit_mesh.get();
+  BMesh *bm = em->bm;
+
+  /* Gathering the affected faces has some overhead, so only do a partial update when the
+   * selection is small compared to the mesh and the existing tessellation can be reused. */
+  const bool use_partial = (bm->totvertsel < bm->totvert / 4) &&
+                           (em->looptris.size() == poly_to_tri_count(bm->totface, bm->totloop));
+
+  EDBMUpdate_Params params{};
+  params.calc_looptris = !use_partial;
+  params.calc_normals = calc_normals && !use_partial;
+  params.is_destructive = false;
+
+  if (use_partial) {
+    blender::BitVector<> verts_mask(bm->totvert);
+    int verts_mask_count = 0;
+    BMIter iter;
+    BMVert *eve;
+    int i;
+    BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, i) {
+      if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+        verts_mask[i].set();
+        verts_mask_count += 1;
+      }
+    }
+
+    BMPartialUpdate_Params update_params{};
+    update_params.do_tessellate = true;
+    update_params.do_normals = calc_normals;
+    BMPartialUpdate *bmpinfo = BM_mesh_partial_create_from_verts(
+        *bm, update_params, verts_mask, verts_mask_count);
+    if (calc_normals) {
+      BKE_editmesh_looptris_and_normals_calc_with_partial(em, bmpinfo);
+    }
+    else {
+      BKE_editmesh_looptris_calc_with_partial(em, bmpinfo);
+    }
+    BM_mesh_partial_destroy(bmpinfo);
+  }
+
+  EDBM_update(mesh, &params);
+}
+
 void EDBM_update_extern(Mesh *mesh, const bool do_tessellation, const bool is_destructive)
 {
   EDBMUpdate_Params params{};
@@ -2,12 +2,14 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <functional>
 #include <sstream>
 
 #include "BLI_fileops.hh"
 #include "BLI_listbase.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
@@ -283,6 +285,7 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
 
   Map<NodeBakeRequest *, PackedBake> packed_data_by_bake;
   Map<NodeBakeRequest *, int64_t> size_by_bake;
+  TaskPool *write_pool = BLI_task_pool_create_background_serial(nullptr, TASK_PRIORITY_HIGH);
 
   for (float frame_f = global_bake_start_frame; frame_f <= global_bake_end_frame;
        frame_f += frame_step_size)
@@ -304,6 +307,10 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
 
     const std::string frame_file_name = bake::frame_to_file_name(frame);
 
+    /* Gather the new frame caches here, because the modifier caches must not be accessed from the
+     * write task while the next frame is evaluated. The frame caches themselves are not modified
+     * anymore once they are created. */
+    Vector<std::pair<NodeBakeRequest *, const bake::FrameCache *>> frames_to_write;
     for (NodeBakeRequest &request : job.bake_requests) {
       NodesModifierData &nmd = *request.nmd;
       bake::ModifierCache &modifier_cache = *nmd.runtime->cache;
@@ -318,48 +325,74 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
       if (frame_cache.frame != frame) {
         continue;
       }
+      frames_to_write.append({&request, &frame_cache});
+    }
 
-      int64_t &written_size = size_by_bake.lookup_or_add(&request, 0);
-
-      if (request.path.has_value()) {
-        char meta_path[FILE_MAX];
-        BLI_path_join(meta_path,
-                      sizeof(meta_path),
-                      request.path->meta_dir.c_str(),
-                      (frame_file_name + ".json").c_str());
-        BLI_file_ensure_parent_dir_exists(meta_path);
-        bake::DiskBlobWriter blob_writer{request.path->blobs_dir, frame_file_name};
-        fstream meta_file{meta_path, std::ios::out};
-        bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
-        written_size += blob_writer.written_size();
-        written_size += meta_file.tellp();
-      }
-      else {
-        PackedBake &packed_data = packed_data_by_bake.lookup_or_add_default(&request);
-
-        bake::MemoryBlobWriter blob_writer{frame_file_name};
-        std::ostringstream meta_file{std::ios::binary};
-        bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
-
-        packed_data.meta_files.append({frame_file_name + ".json", meta_file.str()});
-        const Map<std::string, bake::MemoryBlobWriter::OutputStream> &blob_stream_by_name =
-            blob_writer.get_stream_by_name();
-        for (auto &&item : blob_stream_by_name.items()) {
-          std::string data = item.value.stream->str();
-          if (data.empty()) {
-            continue;
+    /* Serialize the frame in the background while the next frame is evaluated. The write tasks
+     * run one after the other, which is necessary for the blob sharing between frames. */
+    auto *write_fn = new std::function<void()>([&,
+                                                frame_file_name,
+                                                frames_to_write = std::move(frames_to_write)]() {
+      for (const auto &[request_ptr, frame_cache_ptr] : frames_to_write) {
+        NodeBakeRequest &request = *request_ptr;
+        const bake::FrameCache &frame_cache = *frame_cache_ptr;
+
+        int64_t &written_size = size_by_bake.lookup_or_add(&request, 0);
+
+        if (request.path.has_value()) {
+          char meta_path[FILE_MAX];
+          BLI_path_join(meta_path,
+                        sizeof(meta_path),
+                        request.path->meta_dir.c_str(),
+                        (frame_file_name + ".json").c_str());
+          BLI_file_ensure_parent_dir_exists(meta_path);
+          bake::DiskBlobWriter blob_writer{request.path->blobs_dir, frame_file_name};
+          fstream meta_file{meta_path, std::ios::out};
+          bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
+          written_size += blob_writer.written_size();
+          written_size += meta_file.tellp();
+        }
+        else {
+          PackedBake &packed_data = packed_data_by_bake.lookup_or_add_default(&request);
+
+          bake::MemoryBlobWriter blob_writer{frame_file_name};
+          std::ostringstream meta_file{std::ios::binary};
+          bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
+
+          packed_data.meta_files.append({frame_file_name + ".json", meta_file.str()});
+          const Map<std::string, bake::MemoryBlobWriter::OutputStream> &blob_stream_by_name =
+              blob_writer.get_stream_by_name();
+          for (auto &&item : blob_stream_by_name.items()) {
+            std::string data = item.value.stream->str();
+            if (data.empty()) {
+              continue;
+            }
+            packed_data.blob_files.append({item.key, std::move(data)});
           }
-          packed_data.blob_files.append({item.key, std::move(data)});
+          written_size += blob_writer.written_size();
+          written_size += meta_file.tellp();
         }
-        written_size += blob_writer.written_size();
-        written_size += meta_file.tellp();
       }
-    }
+    });
+    BLI_task_pool_push(
+        write_pool,
+        [](TaskPool * /*pool*/, void *taskdata) {
+          (*static_cast<std::function<void()> *>(taskdata))();
+        },
+        write_fn,
+        true,
+        [](TaskPool * /*pool*/, void *taskdata) {
+          delete static_cast<std::function<void()> *>(taskdata);
+        });
 
     worker_status->progress += progress_per_frame;
     worker_status->do_update = true;
   }
 
+  /* Wait until all evaluated frames are written. */
+  BLI_task_pool_work_and_wait(write_pool);
+  BLI_task_pool_free(write_pool);
+
   /* Update bake sizes. */
   for (NodeBakeRequest &request : job.bake_requests) {
     NodesModifierBake *bake = request.nmd->find_bake(request.bake_id);
@@ -7164,10 +7164,9 @@ void filter_distances_with_radius(const float radius,
                                   const Span<float> distances,
                                   const MutableSpan<float> factors)
 {
+  /* Written as a select rather than a conditional store so the loop can be vectorized. */
   for (const int i : distances.index_range()) {
-    if (distances[i] >= radius) {
-      factors[i] = 0.0f;
-    }
+    factors[i] = distances[i] < radius ? factors[i] : 0.0f;
   }
 }
 
@@ -655,6 +655,12 @@ void calc_vert_factors(const Depsgraph &depsgraph,
   }
 
   for (const int i : verts.index_range()) {
+    /* Every automasking mode only scales or clears the factor, so vertices that are already
+     * excluded (usually most of the node, outside of the brush radius) can skip the relatively
+     * expensive topology, face set and occlusion queries. */
+    if (factors[i] == 0.0f) {
+      continue;
+    }
     const int vert = verts[i];
     const float3 &normal = orig_normals.is_empty() ? vert_normals[vert] : orig_normals[i];
 
@@ -889,6 +895,9 @@ void calc_grids_factors(const Depsgraph &depsgraph,
     const int grids_start = grids[i] * key.grid_area;
     for (const int offset : IndexRange(key.grid_area)) {
       const int node_vert = node_start + offset;
+      if (factors[node_vert] == 0.0f) {
+        continue;
+      }
       const int vert = grids_start + offset;
       const float3 &normal = orig_normals.is_empty() ? subdiv_ccg.normals[vert] :
                                                        orig_normals[node_vert];
@@ -1005,6 +1014,9 @@ void calc_vert_factors(const Depsgraph &depsgraph,
   int i = 0;
   for (BMVert *vert : verts) {
     BLI_SCOPED_DEFER([&]() { i++; });
+    if (factors[i] == 0.0f) {
+      continue;
+    }
     const int vert_i = BM_elem_index_get(vert);
     const float3 normal = orig_normals.is_empty() ? float3(vert->no) : orig_normals[i];
 
@@ -29,6 +29,7 @@
 #include "CLG_log.h"
 
 #include "BLI_array.hh"
+#include "BLI_array_utils.hh"
 #include "BLI_bit_group_vector.hh"
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
@@ -1778,6 +1779,43 @@ static size_t node_size_in_bytes(const Node &node)
   return size;
 }
 
+/**
+ * Brush strokes usually only move some of the vertices in the BVH nodes they affect. Only the
+ * unique vertices that actually changed have to be restored, so remove the others from position
+ * undo nodes to reduce the memory usage of the undo step. Only nodes without separately stored
+ * original positions are handled, since their positions are swapped with the mesh directly.
+ */
+static void compact_position_nodes_mesh(const Mesh &mesh,
+                                        const MutableSpan<std::unique_ptr<Node>> unodes)
+{
+  const Span<float3> positions = mesh.vert_positions();
+  threading::parallel_for(unodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int node_i : range) {
+      Node &unode = *unodes[node_i];
+      if (!unode.orig_position.is_empty()) {
+        continue;
+      }
+      const Span<int> verts = unode.vert_indices;
+      const Span<float3> undo_positions = unode.position;
+      IndexMaskMemory memory;
+      const IndexMask changed = IndexMask::from_predicate(
+          IndexRange(unode.unique_verts_num), GrainSize(4096), memory, [&](const int i) {
+            return undo_positions[i] != positions[verts[i]];
+          });
+      if (changed.size() == verts.size()) {
+        continue;
+      }
+      Array<int, 0> changed_verts(changed.size());
+      Array<float3, 0> changed_positions(changed.size());
+      array_utils::gather(verts, changed, changed_verts.as_mutable_span());
+      array_utils::gather(undo_positions, changed, changed_positions.as_mutable_span());
+      unode.vert_indices = std::move(changed_verts);
+      unode.position = std::move(changed_positions);
+      unode.unique_verts_num = changed.size();
+    }
+  });
+}
+
 void push_end_ex(Object &ob, const bool use_nested_undo)
 {
   StepData *step_data = get_step_data();
@@ -1793,6 +1831,13 @@ void push_end_ex(Object &ob, const bool use_nested_undo)
   for (std::unique_ptr<Node> &unode : step_data->nodes) {
     unode->normal = {};
   }
+
+  if (step_data->type == Type::Position) {
+    const bke::pbvh::Tree *pbvh = bke::object::pbvh_get(ob);
+    if (pbvh && pbvh->type() == bke::pbvh::Type::Mesh) {
+      compact_position_nodes_mesh(*static_cast<const Mesh *>(ob.data), step_data->nodes);
+    }
+  }
   /* TODO: When #Node.orig_positions is stored, #Node.positions is unnecessary, don't keep it in
    * the stored undo step. In the future the stored undo step should use a different format with
    * just one positions array that has a different semantic meaning depending on whether there are
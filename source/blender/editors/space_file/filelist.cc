@@ -30,6 +30,7 @@
 
 #include "BLF_api.hh"
 
+#include "BLI_array.hh"
 #include "BLI_fileops.h"
 #include "BLI_fileops_types.h"
 #include "BLI_fnmatch.h"
@@ -42,6 +43,7 @@
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -3098,6 +3100,82 @@ static char *current_relpath_append(const FileListReadJob *job_params, const cha
   return BLI_strdup(relpath);
 }
 
+/**
+ * Set the file type and attributes of a directory entry. This queries the file-system (attributes
+ * and alias targets) and is thread-safe, so that it can run for many entries at once.
+ */
+static void filelist_readjob_list_dir_entry_classify(FileListInternEntry *entry,
+                                                     const char *root,
+                                                     const char *relname,
+                                                     const char *filter_glob,
+                                                     const bool do_lib,
+                                                     const char *main_filepath)
+{
+  /* Full path of the item. */
+  char full_path[FILE_MAX];
+  BLI_path_join(full_path, FILE_MAX, root, relname);
+  char *target = full_path;
+
+  /* Set initial file type and attributes. */
+  entry->attributes = BLI_file_attributes(full_path);
+  if (S_ISDIR(entry->st.st_mode)
+#ifdef __APPLE__
+      && !(ED_path_extension_type(full_path) & FILE_TYPE_BUNDLE)
+#endif
+  )
+  {
+    entry->typeflag = FILE_TYPE_DIR;
+  }
+
+  /* Is this a file that points to another file? */
+  if (entry->attributes & FILE_ATTR_ALIAS) {
+    entry->redirection_path = MEM_calloc_arrayN<char>(FILE_MAXDIR, __func__);
+    if (BLI_file_alias_target(full_path, entry->redirection_path)) {
+      if (BLI_is_dir(entry->redirection_path)) {
+        entry->typeflag = FILE_TYPE_DIR;
+        BLI_path_slash_ensure(entry->redirection_path, FILE_MAXDIR);
+      }
+      else {
+        entry->typeflag = (eFileSel_File_Types)ED_path_extension_type(entry->redirection_path);
+      }
+      target = entry->redirection_path;
+#ifdef WIN32
+      /* On Windows don't show `.lnk` extension for valid shortcuts. */
+      BLI_path_extension_strip(entry->relpath);
+#endif
+    }
+    else {
+      MEM_freeN(entry->redirection_path);
+      entry->redirection_path = nullptr;
+      entry->attributes |= FILE_ATTR_HIDDEN;
+    }
+  }
+
+  if (!(entry->typeflag & FILE_TYPE_DIR)) {
+    if (do_lib && BKE_blendfile_extension_check(target)) {
+      /* If we are considering .blend files as libraries, promote them to directory status. */
+      entry->typeflag = FILE_TYPE_BLENDER;
+      /* prevent current file being used as acceptable dir */
+      if (BLI_path_cmp(main_filepath, target) != 0) {
+        entry->typeflag |= FILE_TYPE_DIR;
+      }
+    }
+    else {
+      entry->typeflag = (eFileSel_File_Types)ED_path_extension_type(target);
+      if (filter_glob[0] && BLI_path_extension_check_glob(target, filter_glob)) {
+        entry->typeflag |= FILE_TYPE_OPERATOR;
+      }
+    }
+  }
+
+#ifndef WIN32
+  /* Set linux-style dot files hidden too. */
+  if (BLI_path_has_hidden_component(entry->relpath)) {
+    entry->attributes |= FILE_ATTR_HIDDEN;
+  }
+#endif
+}
+
 static int filelist_readjob_list_dir(FileListReadJob *job_params,
                                      const char *root,
                                      ListBase *entries,
@@ -3108,87 +3186,38 @@ static int filelist_readjob_list_dir(FileListReadJob *job_params,
 {
   direntry *files;
   int entries_num = 0;
-  /* Full path of the item. */
-  char full_path[FILE_MAX];
 
   const int files_num = BLI_filelist_dir_contents(root, &files);
   if (files) {
-    int i = files_num;
-    while (i--) {
-      FileListInternEntry *entry;
-
+    /* Classifying entries does one or more file-system queries per file, which adds up for large
+     * directories and is very noticeable on network storage. The entries are created up-front and
+     * classified in parallel, then added to the list in the same order as before. */
+    Array<FileListInternEntry *> dir_entries(files_num, nullptr);
+    for (const int i : dir_entries.index_range()) {
       if (skip_currpar && FILENAME_IS_CURRPAR(files[i].relname)) {
         continue;
       }
-
-      entry = MEM_new<FileListInternEntry>(__func__);
+      FileListInternEntry *entry = MEM_new<FileListInternEntry>(__func__);
       entry->relpath = current_relpath_append(job_params, files[i].relname);
       entry->st = files[i].s;
+      dir_entries[i] = entry;
+    }
 
-      BLI_path_join(full_path, FILE_MAX, root, files[i].relname);
-      char *target = full_path;
-
-      /* Set initial file type and attributes. */
-      entry->attributes = BLI_file_attributes(full_path);
-      if (S_ISDIR(files[i].s.st_mode)
-#ifdef __APPLE__
-          && !(ED_path_extension_type(full_path) & FILE_TYPE_BUNDLE)
-#endif
-      )
-      {
-        entry->typeflag = FILE_TYPE_DIR;
-      }
-
-      /* Is this a file that points to another file? */
-      if (entry->attributes & FILE_ATTR_ALIAS) {
-        entry->redirection_path = MEM_calloc_arrayN<char>(FILE_MAXDIR, __func__);
-        if (BLI_file_alias_target(full_path, entry->redirection_path)) {
-          if (BLI_is_dir(entry->redirection_path)) {
-            entry->typeflag = FILE_TYPE_DIR;
-            BLI_path_slash_ensure(entry->redirection_path, FILE_MAXDIR);
-          }
-          else {
-            entry->typeflag = (eFileSel_File_Types)ED_path_extension_type(entry->redirection_path);
-          }
-          target = entry->redirection_path;
-#ifdef WIN32
-          /* On Windows don't show `.lnk` extension for valid shortcuts. */
-          BLI_path_extension_strip(entry->relpath);
-#endif
-        }
-        else {
-          MEM_freeN(entry->redirection_path);
-          entry->redirection_path = nullptr;
-          entry->attributes |= FILE_ATTR_HIDDEN;
-        }
-      }
-
-      if (!(entry->typeflag & FILE_TYPE_DIR)) {
-        if (do_lib && BKE_blendfile_extension_check(target)) {
-          /* If we are considering .blend files as libraries, promote them to directory status. */
-          entry->typeflag = FILE_TYPE_BLENDER;
-          /* prevent current file being used as acceptable dir */
-          if (BLI_path_cmp(main_filepath, target) != 0) {
-            entry->typeflag |= FILE_TYPE_DIR;
-          }
-        }
-        else {
-          entry->typeflag = (eFileSel_File_Types)ED_path_extension_type(target);
-          if (filter_glob[0] && BLI_path_extension_check_glob(target, filter_glob)) {
-            entry->typeflag |= FILE_TYPE_OPERATOR;
-          }
+    threading::parallel_for(dir_entries.index_range(), 64, [&](const IndexRange range) {
+      for (const int i : range) {
+        if (dir_entries[i]) {
+          filelist_readjob_list_dir_entry_classify(
+              dir_entries[i], root, files[i].relname, filter_glob, do_lib, main_filepath);
         }
       }
+    });
 
-#ifndef WIN32
-      /* Set linux-style dot files hidden too. */
-      if (BLI_path_has_hidden_component(entry->relpath)) {
-        entry->attributes |= FILE_ATTR_HIDDEN;
+    int i = files_num;
+    while (i--) {
+      if (dir_entries[i]) {
+        BLI_addtail(entries, dir_entries[i]);
+        entries_num++;
       }
-#endif
-
-      BLI_addtail(entries, entry);
-      entries_num++;
     }
     BLI_filelist_free(files, files_num);
   }
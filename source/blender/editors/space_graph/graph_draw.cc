@@ -684,6 +684,9 @@ static void draw_fcurve_curve(bAnimContext *ac,
 
   immBegin(GPU_PRIM_LINE_STRIP, (total_samples + 1));
 
+  /* Samples are evaluated in increasing order, so the keyframe segment can be reused. */
+  int bezt_index_hint = 0;
+
   /* At each sampling interval, add a new vertex.
    *
    * Apply the unit correction factor to the calculated values so that the displayed values appear
@@ -702,7 +705,11 @@ static void draw_fcurve_curve(bAnimContext *ac,
      */
     eval_time = std::min(eval_time, eval_end);
 
-    immVertex2f(pos, ctime, (evaluate_fcurve(&fcurve_for_draw, eval_time) + offset) * unitFac);
+    immVertex2f(
+        pos,
+        ctime,
+        (evaluate_fcurve_with_hint(&fcurve_for_draw, eval_time, &bezt_index_hint) + offset) *
+            unitFac);
   }
 
   /* Ensure we include end boundary point.
@@ -712,7 +719,11 @@ static void draw_fcurve_curve(bAnimContext *ac,
    * eval_start + total_samples * eval_freq < eval_end
    * due to floating point problems.
    */
-  immVertex2f(pos, etime, (evaluate_fcurve(&fcurve_for_draw, eval_end) + offset) * unitFac);
+  immVertex2f(
+      pos,
+      etime,
+      (evaluate_fcurve_with_hint(&fcurve_for_draw, eval_end, &bezt_index_hint) + offset) *
+          unitFac);
 
   immEnd();
 }
@@ -1101,8 +1112,10 @@ static void draw_fcurve_curve_keys(
         /* In case there is no other way to get curve points, evaluate the FCurve. */
         curve_vertices.append(prevbezt->vec[1]);
         float current_frame = prevbezt->vec[1][0] + evaluation_step;
+        int bezt_index_hint = i;
         while (current_frame < bezt->vec[1][0]) {
-          curve_vertices.append({current_frame, evaluate_fcurve(fcu, current_frame)});
+          curve_vertices.append(
+              {current_frame, evaluate_fcurve_with_hint(fcu, current_frame, &bezt_index_hint)});
           current_frame += evaluation_step;
         }
         break;
@@ -1763,6 +1763,11 @@ static void create_inspection_string_for_geometry_info(const geo_log::GeometryIn
       fmt::format_to(fmt::appender(buf), ".\n");
     }
   }
+  if (value_log.memory_bytes > 0) {
+    char memory_str[BLI_STR_FORMAT_INT64_BYTE_UNIT_SIZE];
+    BLI_str_format_byte_unit(memory_str, value_log.memory_bytes, true);
+    fmt::format_to(fmt::appender(buf), fmt::runtime(TIP_("\n\u2022 Memory: {}")), memory_str);
+  }
 }
 
 static void create_inspection_string_for_geometry_socket(fmt::memory_buffer &buf,
@@ -285,6 +285,8 @@ TreeElement *outliner_add_collection_recursive(SpaceOutliner *space_outliner,
                                                TreeElement *ten);
 
 bool outliner_requires_rebuild_on_select_or_active_change(const SpaceOutliner *space_outliner);
+/** Whether renaming an ID can change the elements or their order in the tree. */
+bool outliner_requires_rebuild_on_rename(const SpaceOutliner *space_outliner);
 
 struct IDsSelectedData {
   ListBase selected_array;
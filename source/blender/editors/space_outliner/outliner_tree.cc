@@ -185,6 +185,20 @@ bool outliner_requires_rebuild_on_select_or_active_change(const SpaceOutliner *s
   return exclude_flags & (SO_FILTER_OB_STATE_SELECTED | SO_FILTER_OB_STATE_ACTIVE);
 }
 
+bool outliner_requires_rebuild_on_rename(const SpaceOutliner *space_outliner)
+{
+  /* ID elements reference the name stored in the ID, so the tree only has to be rebuilt when
+   * names affect the order or visibility of elements: alphabetical sorting, name filtering, and
+   * display modes that follow the name sorted order of the main database. */
+  if (space_outliner->outlinevis != SO_VIEW_LAYER) {
+    return true;
+  }
+  if ((space_outliner->flag & SO_SKIP_SORT_ALPHA) == 0) {
+    return true;
+  }
+  return space_outliner->search_string[0] != '\0';
+}
+
 #ifdef WITH_FREESTYLE
 static void outliner_add_line_styles(SpaceOutliner *space_outliner,
                                      ListBase *lb,
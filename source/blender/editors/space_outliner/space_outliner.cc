@@ -221,7 +221,10 @@ static void outliner_main_region_listener(const wmRegionListenerParams *params)
       }
       break;
     case NC_ID:
-      if (ELEM(wmn->action, NA_RENAME, NA_ADDED, NA_REMOVED)) {
+      if (wmn->action == NA_RENAME && !outliner_requires_rebuild_on_rename(space_outliner)) {
+        ED_region_tag_redraw_no_rebuild(region);
+      }
+      else if (ELEM(wmn->action, NA_RENAME, NA_ADDED, NA_REMOVED)) {
         ED_region_tag_redraw(region);
       }
       break;
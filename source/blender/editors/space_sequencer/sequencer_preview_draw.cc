@@ -12,13 +12,16 @@
 
 #include "BLF_api.hh"
 
+#include "BLI_array.hh"
 #include "BLI_index_range.hh"
+#include "BLI_math_half.hh"
 #include "BLI_math_matrix.hh"
 #include "BLI_math_matrix_types.hh"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector_types.hh"
 #include "BLI_rect.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -491,6 +494,21 @@ static void sequencer_draw_display_buffer(const bContext *C,
   void *display_buffer = sequencer_OCIO_transform_ibuf(
       C, ibuf, &glsl_used, &format, &data, &buffer_cache_handle);
 
+  /* Float images are displayed from a half float texture, which has enough precision for the
+   * preview while halving the texture memory and the amount of data uploaded every redraw. */
+  Array<uint16_t> half_buffer;
+  if (display_buffer && data == GPU_DATA_FLOAT && format == GPU_RGBA32F) {
+    const float *float_buffer = static_cast<const float *>(display_buffer);
+    half_buffer.reinitialize(int64_t(ibuf->x) * ibuf->y * 4);
+    threading::parallel_for(half_buffer.index_range(), 64 * 1024, [&](const IndexRange range) {
+      math::float_to_half_array(
+          float_buffer + range.first(), half_buffer.data() + range.first(), range.size());
+    });
+    display_buffer = half_buffer.data();
+    format = GPU_RGBA16F;
+    data = GPU_DATA_HALF_FLOAT;
+  }
+
   if (draw_backdrop) {
     GPU_matrix_push();
     GPU_matrix_identity_set();
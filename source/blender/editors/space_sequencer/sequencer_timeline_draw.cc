@@ -89,6 +89,14 @@ Vector<Strip *> sequencer_visible_strips_get(const Scene *scene, const View2D *v
   Vector<Strip *> strips;
 
   LISTBASE_FOREACH (Strip *, strip, ed->seqbasep) {
+    /* Test channels first, they are cheap and reject most strips when zoomed in vertically.
+     * Frame tests may need to evaluate retiming, so only do them for strips in visible channels. */
+    if (strip->machine + 1.0f < v2d->cur.ymin) {
+      continue;
+    }
+    if (strip->machine > v2d->cur.ymax) {
+      continue;
+    }
     if (min_ii(seq::time_left_handle_frame_get(scene, strip), seq::time_start_frame_get(strip)) >
         v2d->cur.xmax)
     {
@@ -99,12 +107,6 @@ Vector<Strip *> sequencer_visible_strips_get(const Scene *scene, const View2D *v
     {
       continue;
     }
-    if (strip->machine + 1.0f < v2d->cur.ymin) {
-      continue;
-    }
-    if (strip->machine > v2d->cur.ymax) {
-      continue;
-    }
     strips.append(strip);
   }
   return strips;
@@ -23,6 +23,16 @@ static IndexMask apply_filter_operation(const VArray<T> &data,
                                         const IndexMask &mask,
                                         IndexMaskMemory &memory)
 {
+  /* Avoid a virtual function call per row for the common cases, this is noticeable for large
+   * geometries. */
+  if (data.is_single()) {
+    return check_fn(data.get_internal_single()) ? mask : IndexMask();
+  }
+  if (data.is_span()) {
+    const Span<T> span = data.get_internal_span();
+    return IndexMask::from_predicate(
+        mask, GrainSize(1024), memory, [&](const int64_t i) { return check_fn(span[i]); });
+  }
   return IndexMask::from_predicate(
       mask, GrainSize(1024), memory, [&](const int64_t i) { return check_fn(data[i]); });
 }
@@ -134,7 +144,7 @@ static IndexMask apply_row_filter(const SpreadsheetRowFilter &row_filter,
     switch (row_filter.operation) {
       case SPREADSHEET_ROW_FILTER_EQUAL: {
         const float threshold_sq = pow2f(row_filter.threshold);
-        apply_filter_operation(
+        return apply_filter_operation(
             column_data.typed<int2>(),
             [&](const int2 cell) { return math::distance_squared(cell, value) <= threshold_sq; },
             prev_mask,
@@ -142,7 +152,7 @@ static IndexMask apply_row_filter(const SpreadsheetRowFilter &row_filter,
         break;
       }
       case SPREADSHEET_ROW_FILTER_GREATER: {
-        apply_filter_operation(
+        return apply_filter_operation(
             column_data.typed<int2>(),
             [&](const int2 cell) { return cell.x > value.x && cell.y > value.y; },
             prev_mask,
@@ -150,7 +160,7 @@ static IndexMask apply_row_filter(const SpreadsheetRowFilter &row_filter,
         break;
       }
       case SPREADSHEET_ROW_FILTER_LESS: {
-        apply_filter_operation(
+        return apply_filter_operation(
             column_data.typed<int2>(),
             [&](const int2 cell) { return cell.x < value.x && cell.y < value.y; },
             prev_mask,
@@ -164,7 +174,7 @@ static IndexMask apply_row_filter(const SpreadsheetRowFilter &row_filter,
     switch (row_filter.operation) {
       case SPREADSHEET_ROW_FILTER_EQUAL: {
         const float threshold_sq = pow2f(row_filter.threshold);
-        apply_filter_operation(
+        return apply_filter_operation(
             column_data.typed<short2>(),
             [&](const short2 cell) { return math::distance_squared(cell, value) <= threshold_sq; },
             prev_mask,
@@ -172,7 +182,7 @@ static IndexMask apply_row_filter(const SpreadsheetRowFilter &row_filter,
         break;
       }
       case SPREADSHEET_ROW_FILTER_GREATER: {
-        apply_filter_operation(
+        return apply_filter_operation(
             column_data.typed<short2>(),
             [&](const short2 cell) { return cell.x > value.x && cell.y > value.y; },
             prev_mask,
@@ -180,7 +190,7 @@ static IndexMask apply_row_filter(const SpreadsheetRowFilter &row_filter,
         break;
       }
       case SPREADSHEET_ROW_FILTER_LESS: {
-        apply_filter_operation(
+        return apply_filter_operation(
             column_data.typed<short2>(),
             [&](const short2 cell) { return cell.x < value.x && cell.y < value.y; },
             prev_mask,
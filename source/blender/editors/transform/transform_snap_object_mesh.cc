@@ -115,6 +115,12 @@ static bool raycastMesh(SnapObjectContext *sctx,
     {
       return retval;
     }
+    /* The bounding box is entered beyond the closest hit found so far, so no face of this object
+     * can be closer. This avoids building and traversing the BVH tree of objects that are hidden
+     * behind an earlier hit, which matters in scenes with many instances. */
+    if (sctx->ret.hit_list == nullptr && len_diff > local_depth) {
+      return retval;
+    }
   }
 
   /* We pass a temp ray_start, set from object's boundbox, to avoid precision issues with
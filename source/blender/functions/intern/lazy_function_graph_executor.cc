@@ -42,6 +42,7 @@
  */
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 
 #include "BLI_enumerable_thread_specific.hh"
@@ -288,6 +289,12 @@ struct CurrentTask {
 
 class Executor {
  private:
+  /**
+   * Nodes that take at least this long to run are considered expensive enough that running the
+   * nodes scheduled after them on other threads is worth the overhead of creating a task.
+   */
+  static constexpr std::chrono::microseconds expensive_node_duration{100};
+
   const GraphExecutor &self_;
   /**
    * Remembers which inputs have been loaded from the caller already, to avoid loading them twice.
@@ -811,11 +818,20 @@ class Executor {
       if (current_task.scheduled_nodes.is_empty()) {
         current_task.has_scheduled_nodes.store(false, std::memory_order_relaxed);
       }
+      const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
       this->run_node_task(*node, current_task, local_data);
+      const std::chrono::steady_clock::duration duration = std::chrono::steady_clock::now() -
+                                                           start_time;
 
       /* If there are many nodes scheduled at the same time, it's beneficial to let multiple
-       * threads work on those. */
-      if (current_task.scheduled_nodes.nodes_num() > 128) {
+       * threads work on those. The same is true when the node that just ran was expensive,
+       * because the remaining scheduled nodes are often similar to it (e.g. in wide trees where
+       * the same operation is done in many branches). Cheap nodes are kept on the current thread
+       * to avoid the threading overhead. */
+      const int64_t scheduled_nodes_num = current_task.scheduled_nodes.nodes_num();
+      if (scheduled_nodes_num > 128 ||
+          (scheduled_nodes_num >= 2 && duration >= expensive_node_duration))
+      {
         if (this->try_enable_multi_threading()) {
           std::unique_ptr<ScheduledNodes> split_nodes = std::make_unique<ScheduledNodes>();
           current_task.scheduled_nodes.split_into(*split_nodes);
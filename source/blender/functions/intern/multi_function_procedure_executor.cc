@@ -4,6 +4,8 @@
 
 #include "FN_multi_function_procedure_executor.hh"
 
+#include <algorithm>
+
 #include "BLI_stack.hh"
 
 namespace blender::fn::multi_function {
@@ -1243,9 +1245,18 @@ void ProcedureExecutor::call(const IndexMask &full_mask, Params params, Context
 
 MultiFunction::ExecutionHints ProcedureExecutor::get_execution_hints() const
 {
+  /* The procedure is executed on chunks of the mask, one instruction after the other. Choose the
+   * chunk size so that the intermediate buffers of all variables stay in the CPU caches while the
+   * chunk is processed, instead of streaming every intermediate result through main memory. */
+  static constexpr int64_t chunk_cache_budget = 512 * 1024;
+  /* Buffers of small types are allocated with a fixed size per element, see #ValueAllocator. */
+  static constexpr int64_t bytes_per_element = 16;
+  const int64_t variables_num = std::max<int64_t>(procedure_.variables().size(), 1);
+
   ExecutionHints hints;
   hints.allocates_array = true;
-  hints.min_grain_size = 10000;
+  hints.min_grain_size = std::clamp<int64_t>(
+      chunk_cache_budget / (variables_num * bytes_per_element), 1024, 10000);
   return hints;
 }
 
@@ -178,4 +178,44 @@ TEST(lazy_function, GraphWithCycle)
   EXPECT_EQ(result, 10 * 2 * 5);
 }
 
+TEST(lazy_function, WideGraph)
+{
+  BLI_task_scheduler_init();
+  const AddLazyFunction add_fn;
+
+  /* Many independent nodes which are scheduled at the same time, so that they are distributed
+   * over multiple threads. Their results are summed up in a chain. */
+  constexpr int branches_num = 1000;
+  Graph graph;
+  GraphInputSocket &input_socket = graph.add_input(CPPType::get<int>());
+  GraphOutputSocket &output_socket = graph.add_output(CPPType::get<int>());
+
+  const int value_0 = 0;
+  OutputSocket *sum_socket = nullptr;
+  for ([[maybe_unused]] const int i : IndexRange(branches_num)) {
+    FunctionNode &branch_node = graph.add_function(add_fn);
+    graph.add_link(input_socket, branch_node.input(0));
+    graph.add_link(input_socket, branch_node.input(1));
+    FunctionNode &sum_node = graph.add_function(add_fn);
+    graph.add_link(branch_node.output(0), sum_node.input(0));
+    if (sum_socket == nullptr) {
+      sum_node.input(1).set_default_value(&value_0);
+    }
+    else {
+      graph.add_link(*sum_socket, sum_node.input(1));
+    }
+    sum_socket = &sum_node.output(0);
+  }
+  graph.add_link(*sum_socket, output_socket);
+
+  graph.update_node_indices();
+
+  GraphExecutor executor_fn{graph, {&input_socket}, {&output_socket}, nullptr, nullptr, nullptr};
+  int result = 0;
+  execute_lazy_function_eagerly(
+      executor_fn, nullptr, nullptr, std::make_tuple(3), std::make_tuple(&result));
+
+  EXPECT_EQ(result, branches_num * 6);
+}
+
 }  // namespace blender::fn::lazy_function::tests
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include "BLI_bounds_types.hh"
+#include "BLI_function_ref.hh"
+#include "BLI_math_matrix_types.hh"
+
 #include "BKE_geometry_set.hh"
 
 namespace blender::geometry {
@@ -70,4 +74,23 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
                                    const RealizeInstancesOptions &options,
                                    const VariedDepthOptions &varied_depth_option);
 
+/**
+ * Call #fn for every geometry that would be joined by #realize_instances, together with the
+ * transform that is applied to it. The geometries passed to #fn don't contain instances. This
+ * allows processing all realized data in chunks without ever allocating the joined geometry.
+ * Unlike #realize_instances, instance attributes are not propagated and no ids are generated.
+ */
+void foreach_realized_geometry(
+    const bke::GeometrySet &geometry_set,
+    FunctionRef<void(const bke::GeometrySet &geometry, const float4x4 &transform)> fn);
+
+/**
+ * Compute the bounds of the geometry that #realize_instances would generate, without realizing
+ * it. The bounds of every referenced geometry are only computed once. For rotated instances the
+ * transformed bounds of the referenced geometry are used, so the result may be larger than the
+ * exact bounds.
+ */
+std::optional<Bounds<float3>> compute_bounds_with_instances(const bke::GeometrySet &geometry_set,
+                                                            bool use_radius = true);
+
 }  // namespace blender::geometry
@@ -204,33 +204,37 @@ static void sample_curve_attribute(const bke::CurvesGeometry &src_curves,
     Span<T> src = src_data.typed<T>();
     MutableSpan<T> dst = dst_data.typed<T>();
 
-    Vector<T> evaluated_data;
-    dst_curve_mask.foreach_index([&](const int i_dst_curve, const int pos) {
-      const int i_src_curve = src_curve_indices[pos];
-      if (i_src_curve < 0) {
-        return;
-      }
-
-      const IndexRange src_points = src_points_by_curve[i_src_curve];
-      const IndexRange dst_points = dst_points_by_curve[i_dst_curve];
-
-      if (curve_types[i_src_curve] == CURVE_TYPE_POLY) {
-        length_parameterize::interpolate(src.slice(src_points),
-                                         dst_sample_indices.slice(dst_points),
-                                         dst_sample_factors.slice(dst_points),
-                                         dst.slice(dst_points));
-      }
-      else {
-        const IndexRange src_evaluated_points = src_evaluated_points_by_curve[i_src_curve];
-        evaluated_data.reinitialize(src_evaluated_points.size());
-        src_curves.interpolate_to_evaluated(
-            i_src_curve, src.slice(src_points), evaluated_data.as_mutable_span());
-        length_parameterize::interpolate(evaluated_data.as_span(),
-                                         dst_sample_indices.slice(dst_points),
-                                         dst_sample_factors.slice(dst_points),
-                                         dst.slice(dst_points));
-      }
-    });
+    dst_curve_mask.foreach_segment(
+        GrainSize(512), [&](const IndexMaskSegment segment, const int64_t segment_pos) {
+          Vector<T> evaluated_data;
+          for (const int64_t i : segment.index_range()) {
+            const int i_dst_curve = int(segment[i]);
+            const int i_src_curve = src_curve_indices[segment_pos + i];
+            if (i_src_curve < 0) {
+              continue;
+            }
+
+            const IndexRange src_points = src_points_by_curve[i_src_curve];
+            const IndexRange dst_points = dst_points_by_curve[i_dst_curve];
+
+            if (curve_types[i_src_curve] == CURVE_TYPE_POLY) {
+              length_parameterize::interpolate(src.slice(src_points),
+                                               dst_sample_indices.slice(dst_points),
+                                               dst_sample_factors.slice(dst_points),
+                                               dst.slice(dst_points));
+            }
+            else {
+              const IndexRange src_evaluated_points = src_evaluated_points_by_curve[i_src_curve];
+              evaluated_data.reinitialize(src_evaluated_points.size());
+              src_curves.interpolate_to_evaluated(
+                  i_src_curve, src.slice(src_points), evaluated_data.as_mutable_span());
+              length_parameterize::interpolate(evaluated_data.as_span(),
+                                               dst_sample_indices.slice(dst_points),
+                                               dst_sample_factors.slice(dst_points),
+                                               dst.slice(dst_points));
+            }
+          }
+        });
   });
 }
 
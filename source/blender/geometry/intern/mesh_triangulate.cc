@@ -828,8 +828,12 @@ std::optional<Mesh *> mesh_triangulate(const Mesh &src_mesh,
   edges_with_duplicates.take_front(src_edges.size()).copy_from(src_edges);
 
   /* Vertex attributes are totally unaffected and can be shared with implicit sharing.
-   * Use the #CustomData API for simpler support for vertex groups. */
-  CustomData_merge(&src_mesh.vert_data, &mesh->vert_data, CD_MASK_MESH.vmask, mesh->verts_num);
+   * Use the #CustomData API for simpler support for vertex groups. Original indices are kept too,
+   * for use in the modifier stack. */
+  CustomData_merge(&src_mesh.vert_data,
+                   &mesh->vert_data,
+                   CD_MASK_MESH.vmask | CD_MASK_ORIGINDEX,
+                   mesh->verts_num);
 
   for (auto &attribute : bke::retrieve_attributes_for_transfer(
            src_attributes,
@@ -8,6 +8,7 @@
 #include "DNA_object_types.h"
 
 #include "BLI_array_utils.hh"
+#include "BLI_bounds.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_matrix.hh"
 #include "BLI_noise.hh"
@@ -2400,4 +2401,105 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Deferred Realization
+ * \{ */
+
+static void foreach_realized_geometry_recursive(
+    const bke::GeometrySet &geometry_set,
+    const float4x4 &base_transform,
+    const FunctionRef<void(const bke::GeometrySet &geometry, const float4x4 &transform)> fn)
+{
+  if (geometry_set.has_realized_data()) {
+    bke::GeometrySet realized_geometry = geometry_set;
+    realized_geometry.remove<bke::InstancesComponent>();
+    fn(realized_geometry, base_transform);
+  }
+  const Instances *instances = geometry_set.get_instances();
+  if (instances == nullptr) {
+    return;
+  }
+  /* Convert every reference only once, there are usually far fewer references than instances. */
+  const Span<InstanceReference> references = instances->references();
+  Array<bke::GeometrySet> reference_geometries(references.size());
+  for (const int i : references.index_range()) {
+    references[i].to_geometry_set(reference_geometries[i]);
+  }
+  const Span<int> handles = instances->reference_handles();
+  const Span<float4x4> transforms = instances->transforms();
+  for (const int i : transforms.index_range()) {
+    foreach_realized_geometry_recursive(
+        reference_geometries[handles[i]], base_transform * transforms[i], fn);
+  }
+}
+
+void foreach_realized_geometry(
+    const bke::GeometrySet &geometry_set,
+    const FunctionRef<void(const bke::GeometrySet &geometry, const float4x4 &transform)> fn)
+{
+  foreach_realized_geometry_recursive(geometry_set, float4x4::identity(), fn);
+}
+
+static std::optional<Bounds<float3>> transform_bounds(const Bounds<float3> &bounds,
+                                                      const float4x4 &transform)
+{
+  std::optional<Bounds<float3>> result;
+  for (const int i : IndexRange(8)) {
+    const float3 corner(i & 1 ? bounds.max.x : bounds.min.x,
+                        i & 2 ? bounds.max.y : bounds.min.y,
+                        i & 4 ? bounds.max.z : bounds.min.z);
+    result = bounds::min_max(result, math::transform_point(transform, corner));
+  }
+  return result;
+}
+
+static std::optional<Bounds<float3>> compute_bounds_with_instances_recursive(
+    const bke::GeometrySet &geometry_set, const bool use_radius)
+{
+  std::optional<Bounds<float3>> result = geometry_set.compute_boundbox_without_instances(
+      use_radius);
+  const Instances *instances = geometry_set.get_instances();
+  if (instances == nullptr) {
+    return result;
+  }
+  /* Instancing the same geometry many times is common, so the bounds of every reference are only
+   * computed once and then transformed for every instance. */
+  const Span<InstanceReference> references = instances->references();
+  Array<std::optional<Bounds<float3>>> reference_bounds(references.size());
+  threading::parallel_for(references.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      bke::GeometrySet reference_geometry;
+      references[i].to_geometry_set(reference_geometry);
+      reference_bounds[i] = compute_bounds_with_instances_recursive(reference_geometry,
+                                                                    use_radius);
+    }
+  });
+  const Span<int> handles = instances->reference_handles();
+  const Span<float4x4> transforms = instances->transforms();
+  const std::optional<Bounds<float3>> instances_bounds = threading::parallel_reduce(
+      transforms.index_range(),
+      1024,
+      std::optional<Bounds<float3>>(),
+      [&](const IndexRange range, std::optional<Bounds<float3>> bounds) {
+        for (const int i : range) {
+          if (const std::optional<Bounds<float3>> &sub_bounds = reference_bounds[handles[i]]) {
+            bounds = bounds::merge(bounds, transform_bounds(*sub_bounds, transforms[i]));
+          }
+        }
+        return bounds;
+      },
+      [](const std::optional<Bounds<float3>> &a, const std::optional<Bounds<float3>> &b) {
+        return bounds::merge(a, b);
+      });
+  return bounds::merge(result, instances_bounds);
+}
+
+std::optional<Bounds<float3>> compute_bounds_with_instances(const bke::GeometrySet &geometry_set,
+                                                            const bool use_radius)
+{
+  return compute_bounds_with_instances_recursive(geometry_set, use_radius);
+}
+
+/** \} */
+
 }  // namespace blender::geometry
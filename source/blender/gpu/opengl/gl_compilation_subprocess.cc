@@ -7,6 +7,7 @@
 #if BLI_SUBPROCESS_SUPPORT
 
 #  include "BKE_appdir.hh"
+#  include "BLI_array.hh"
 #  include "BLI_fileops.hh"
 #  include "BLI_hash.hh"
 #  include "BLI_path_utils.hh"
@@ -182,6 +183,10 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
   GPU_init();
 
   std::string cache_dir = cache_dir_get();
+  /* Cache files are written to a temporary file unique to this subprocess first, and then moved
+   * into place, so other subprocesses never read a partially written binary. */
+  const std::string temp_file_suffix = "_" +
+                                       std::to_string(DefaultHash<StringRefNull>{}(name)) + ".tmp";
 
   while (true) {
     /* Process events to avoid crashes on Wayland.
@@ -235,7 +240,7 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
 
     std::string cache_path = cache_dir + SEP_STR + hash_str;
 
-    /* TODO: This should lock the files? */
+    /* Cache files are only ever replaced atomically, see #temp_file_suffix. */
     if (BLI_exists(cache_path.c_str())) {
       /* Prevent old cache files from being deleted if they're still being used. */
       BLI_file_touch(cache_path.c_str());
@@ -243,19 +248,25 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
       fstream file(cache_path, std::ios::binary | std::ios::in | std::ios::ate);
       std::streamsize size = file.tellg();
       if (size <= compilation_subprocess_shared_memory_size) {
+        /* Read and validate the binary before writing it to the shared memory, so the shader can
+         * still be compiled from its source when the cached binary can't be used. */
+        Array<char> cached_binary(std::max<int64_t>(size, 0));
         file.seekg(0, std::ios::beg);
-        file.read(reinterpret_cast<char *>(shared_mem.get_data()), size);
-        /* Ensure it's valid. */
-        if (!validate_binary(shared_mem.get_data())) {
-          std::cout << "Compilation Subprocess: Failed to load cached shader binary " << hash_str
-                    << "\n";
-          /* We can't compile the shader anymore since we have written over the source code,
-           * but we delete the cache for the next time this shader is requested. */
-          file.close();
-          BLI_delete(cache_path.c_str(), false, false);
+        file.read(cached_binary.data(), cached_binary.size());
+        const ShaderBinaryHeader *header = reinterpret_cast<const ShaderBinaryHeader *>(
+            cached_binary.data());
+        if (file && size >= std::streamsize(offsetof(ShaderBinaryHeader, data)) &&
+            size == std::streamsize(header->size + offsetof(ShaderBinaryHeader, data)) &&
+            validate_binary(cached_binary.data()))
+        {
+          memcpy(shared_mem.get_data(), cached_binary.data(), cached_binary.size());
+          end_semaphore.increment();
+          continue;
         }
-        end_semaphore.increment();
-        continue;
+        std::cout << "Compilation Subprocess: Failed to load cached shader binary " << hash_str
+                  << "\n";
+        file.close();
+        BLI_delete(cache_path.c_str(), false, false);
       }
       else {
         /* This should never happen, since shaders larger than the pool size should be discarded
@@ -272,9 +283,17 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
     end_semaphore.increment();
 
     if (binary) {
-      fstream file(cache_path, std::ios::binary | std::ios::out);
-      file.write(reinterpret_cast<char *>(shared_mem.get_data()),
-                 binary->size + offsetof(ShaderBinaryHeader, data));
+      const std::string temp_path = cache_path + temp_file_suffix;
+      bool written = false;
+      {
+        fstream file(temp_path, std::ios::binary | std::ios::out);
+        file.write(reinterpret_cast<char *>(shared_mem.get_data()),
+                   binary->size + offsetof(ShaderBinaryHeader, data));
+        written = bool(file);
+      }
+      if (!written || BLI_rename_overwrite(temp_path.c_str(), cache_path.c_str()) != 0) {
+        BLI_delete(temp_path.c_str(), false, false);
+      }
     }
   }
 
@@ -11,17 +11,15 @@
 #include "vk_render_graph.hh"
 #include "vk_scheduler.hh"
 
+#include "BLI_array_utils.hh"
 #include "BLI_index_range.hh"
-#include "BLI_set.hh"
 
 namespace blender::gpu::render_graph {
 
 Span<NodeHandle> VKScheduler::select_nodes(const VKRenderGraph &render_graph)
 {
-  result_.clear();
-  for (NodeHandle node_handle : render_graph.nodes_.index_range()) {
-    result_.append(node_handle);
-  }
+  result_.resize(render_graph.nodes_.size());
+  array_utils::fill_index_range<NodeHandle>(result_);
   reorder_nodes(render_graph);
   return result_;
 }
@@ -64,9 +62,11 @@ std::optional<std::pair<int64_t, int64_t>> VKScheduler::find_rendering_scope(
 
 void VKScheduler::move_initial_transfer_to_start(const VKRenderGraph &render_graph)
 {
-  Vector<NodeHandle> data_transfers;
-  Vector<NodeHandle> other_nodes;
+  Vector<NodeHandle> &data_transfers = data_transfers_;
+  Vector<NodeHandle> &other_nodes = other_nodes_;
 
+  data_transfers.clear();
+  other_nodes.clear();
   data_transfers.reserve(result_.size());
   other_nodes.reserve(result_.size());
 
@@ -112,9 +112,9 @@ void VKScheduler::move_initial_transfer_to_start(const VKRenderGraph &render_gra
 void VKScheduler::move_transfer_and_dispatch_outside_rendering_scope(
     const VKRenderGraph &render_graph)
 {
-  Vector<NodeHandle> pre_rendering_scope;
-  Vector<NodeHandle> rendering_scope;
-  Set<ResourceHandle> used_buffers;
+  Vector<NodeHandle> &pre_rendering_scope = pre_rendering_scope_;
+  Vector<NodeHandle> &rendering_scope = rendering_scope_;
+  Set<ResourceHandle> &used_buffers = used_buffers_;
 
   foreach_rendering_scope(render_graph, [&](int64_t start_index, int64_t end_index) {
     /* Move end_rendering right after the last graphics node. */
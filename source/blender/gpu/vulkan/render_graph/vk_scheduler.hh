@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "BLI_set.hh"
 #include "BLI_vector.hh"
 
 #include "vk_common.hh"
@@ -51,6 +52,16 @@ class VKScheduler {
    */
   Vector<NodeHandle> result_;
 
+  /**
+   * Scratch buffers used while reordering nodes. Kept between submissions to reduce memory
+   * operations.
+   */
+  Vector<NodeHandle> data_transfers_;
+  Vector<NodeHandle> other_nodes_;
+  Vector<NodeHandle> pre_rendering_scope_;
+  Vector<NodeHandle> rendering_scope_;
+  Set<ResourceHandle> used_buffers_;
+
  public:
   /**
    * Determine which nodes of the render graph should be selected and in what order they should
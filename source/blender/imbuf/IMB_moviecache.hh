@@ -46,6 +46,9 @@ void IMB_moviecache_remove(MovieCache *cache, void *userkey);
 bool IMB_moviecache_has_frame(MovieCache *cache, void *userkey);
 void IMB_moviecache_free(MovieCache *cache);
 
+/** Memory used by all movie caches, which share one limit. */
+size_t IMB_moviecache_get_memory_in_use();
+
 void IMB_moviecache_cleanup(MovieCache *cache,
                             bool(cleanup_check_cb)(ImBuf *ibuf, void *userkey, void *userdata),
                             void *userdata);
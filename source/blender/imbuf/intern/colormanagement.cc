@@ -1700,7 +1700,9 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
     const char *from_colorspace = handle->float_colorspace;
     const char *to_colorspace = global_role_scene_linear;
 
-    memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
+    if (linear_buffer != handle->buffer) {
+      memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
+    }
 
     if (!is_data && !is_data_display) {
       IMB_colormanagement_transform_float(
@@ -1713,10 +1715,12 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
     /* some processors would want to modify float original buffer
      * before converting it into display byte buffer, so we need to
      * make sure original's ImBuf buffers wouldn't be modified by
-     * using duplicated buffer here
+     * using duplicated buffer here, unless the display buffer is the original buffer itself
      */
 
-    memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
+    if (linear_buffer != handle->buffer) {
+      memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
+    }
 
     *is_straight_alpha = false;
   }
@@ -1794,8 +1798,13 @@ static void do_display_buffer_apply_thread(DisplayBufferThread *handle)
   int channels = handle->channels;
   int width = handle->width;
   int height = handle->tot_line;
-  float *linear_buffer = MEM_malloc_arrayN<float>(
-      size_t(channels) * size_t(width) * size_t(height), "color conversion linear buffer");
+  /* Process directly in the float display buffer if one is requested, which has the same layout
+   * as the linear buffer, to avoid a temporary buffer and a copy of the result. */
+  float *linear_buffer = display_buffer ?
+                             display_buffer :
+                             MEM_malloc_arrayN<float>(
+                                 size_t(channels) * size_t(width) * size_t(height),
+                                 "color conversion linear buffer");
 
   bool is_straight_alpha;
   display_buffer_apply_get_linear_buffer(handle, height, linear_buffer, &is_straight_alpha);
@@ -1826,8 +1835,6 @@ static void do_display_buffer_apply_thread(DisplayBufferThread *handle)
   }
 
   if (display_buffer) {
-    memcpy(display_buffer, linear_buffer, size_t(width) * height * channels * sizeof(float));
-
     if (is_straight_alpha && channels == 4) {
       const size_t i_last = size_t(width) * height;
       size_t i;
@@ -1838,8 +1845,9 @@ static void do_display_buffer_apply_thread(DisplayBufferThread *handle)
       }
     }
   }
-
-  MEM_freeN(linear_buffer);
+  else {
+    MEM_freeN(linear_buffer);
+  }
 }
 
 static void display_buffer_apply_threaded(ImBuf *ibuf,
@@ -2315,6 +2323,8 @@ void IMB_colormanagement_imbuf_to_byte_texture(uchar *out_buffer,
                                                const ImBuf *ibuf,
                                                const bool store_premultiplied)
 {
+  using namespace blender;
+
   /* Byte buffer storage, only for sRGB, scene linear and data texture since other
    * color space conversions can't be done on the GPU. */
   BLI_assert(ibuf->byte_buffer.data);
@@ -2326,31 +2336,33 @@ void IMB_colormanagement_imbuf_to_byte_texture(uchar *out_buffer,
   const uchar *in_buffer = ibuf->byte_buffer.data;
   const bool use_premultiply = IMB_alpha_affects_rgb(ibuf) && store_premultiplied;
 
-  for (int y = 0; y < height; y++) {
-    const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
-    const size_t out_offset = y * width;
-    const uchar *in = in_buffer + in_offset * 4;
-    uchar *out = out_buffer + out_offset * 4;
-
-    if (use_premultiply) {
-      /* Premultiply only. */
-      for (int x = 0; x < width; x++, in += 4, out += 4) {
-        out[0] = (in[0] * in[3]) >> 8;
-        out[1] = (in[1] * in[3]) >> 8;
-        out[2] = (in[2] * in[3]) >> 8;
-        out[3] = in[3];
+  threading::parallel_for(IndexRange(height), 128, [&](const IndexRange y_range) {
+    for (const int y : y_range) {
+      const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
+      const size_t out_offset = y * width;
+      const uchar *in = in_buffer + in_offset * 4;
+      uchar *out = out_buffer + out_offset * 4;
+
+      if (use_premultiply) {
+        /* Premultiply only. */
+        for (int x = 0; x < width; x++, in += 4, out += 4) {
+          out[0] = (in[0] * in[3]) >> 8;
+          out[1] = (in[1] * in[3]) >> 8;
+          out[2] = (in[2] * in[3]) >> 8;
+          out[3] = in[3];
+        }
       }
-    }
-    else {
-      /* Copy only. */
-      for (int x = 0; x < width; x++, in += 4, out += 4) {
-        out[0] = in[0];
-        out[1] = in[1];
-        out[2] = in[2];
-        out[3] = in[3];
+      else {
+        /* Copy only. */
+        for (int x = 0; x < width; x++, in += 4, out += 4) {
+          out[0] = in[0];
+          out[1] = in[1];
+          out[2] = in[2];
+          out[3] = in[3];
+        }
       }
     }
-  }
+  });
 }
 
 void IMB_colormanagement_imbuf_to_float_texture(float *out_buffer,
@@ -2371,42 +2383,44 @@ void IMB_colormanagement_imbuf_to_float_texture(float *out_buffer,
     const int in_channels = ibuf->channels;
     const bool use_unpremultiply = IMB_alpha_affects_rgb(ibuf) && !store_premultiplied;
 
-    for (int y = 0; y < height; y++) {
-      const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
-      const size_t out_offset = y * width;
-      const float *in = in_buffer + in_offset * in_channels;
-      float *out = out_buffer + out_offset * 4;
+    threading::parallel_for(IndexRange(height), 128, [&](const IndexRange y_range) {
+      for (const int y : y_range) {
+        const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
+        const size_t out_offset = y * width;
+        const float *in = in_buffer + in_offset * in_channels;
+        float *out = out_buffer + out_offset * 4;
 
-      if (in_channels == 1) {
-        /* Copy single channel. */
-        for (int x = 0; x < width; x++, in += 1, out += 4) {
-          out[0] = in[0];
-          out[1] = in[0];
-          out[2] = in[0];
-          out[3] = in[0];
-        }
-      }
-      else if (in_channels == 3) {
-        /* Copy RGB. */
-        for (int x = 0; x < width; x++, in += 3, out += 4) {
-          out[0] = in[0];
-          out[1] = in[1];
-          out[2] = in[2];
-          out[3] = 1.0f;
+        if (in_channels == 1) {
+          /* Copy single channel. */
+          for (int x = 0; x < width; x++, in += 1, out += 4) {
+            out[0] = in[0];
+            out[1] = in[0];
+            out[2] = in[0];
+            out[3] = in[0];
+          }
         }
-      }
-      else if (in_channels == 4) {
-        /* Copy or convert RGBA. */
-        if (use_unpremultiply) {
-          for (int x = 0; x < width; x++, in += 4, out += 4) {
-            premul_to_straight_v4_v4(out, in);
+        else if (in_channels == 3) {
+          /* Copy RGB. */
+          for (int x = 0; x < width; x++, in += 3, out += 4) {
+            out[0] = in[0];
+            out[1] = in[1];
+            out[2] = in[2];
+            out[3] = 1.0f;
           }
         }
-        else {
-          memcpy(out, in, sizeof(float[4]) * width);
+        else if (in_channels == 4) {
+          /* Copy or convert RGBA. */
+          if (use_unpremultiply) {
+            for (int x = 0; x < width; x++, in += 4, out += 4) {
+              premul_to_straight_v4_v4(out, in);
+            }
+          }
+          else {
+            memcpy(out, in, sizeof(float[4]) * width);
+          }
         }
       }
-    }
+    });
   }
   else {
     /* Byte source buffer. */
@@ -368,6 +368,16 @@ void IMB_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf)
   do_moviecache_put(cache, userkey, ibuf, true);
 }
 
+size_t IMB_moviecache_get_memory_in_use()
+{
+  if (!limitor) {
+    return 0;
+  }
+
+  std::scoped_lock lock(limitor_lock);
+  return MEM_CacheLimiter_get_memory_in_use(limitor);
+}
+
 bool IMB_moviecache_put_if_possible(MovieCache *cache, void *userkey, ImBuf *ibuf)
 {
   size_t mem_in_use, mem_limit, elem_size;
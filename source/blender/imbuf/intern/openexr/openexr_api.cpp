@@ -84,6 +84,7 @@
 #include "BLI_mmap.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 
 #include "BKE_idprop.hh"
@@ -582,37 +583,44 @@ static bool imb_save_openexr_half(ImBuf *ibuf, const char *filepath, const int f
     if (is_alpha) {
       frameBuffer.insert("A", Slice(HALF, (char *)&to->a, xstride, ystride));
     }
+    /* Rows are stored flipped, the conversion of each row is independent. */
     if (ibuf->float_buffer.data) {
-      float *from;
-
-      for (int i = ibuf->y - 1; i >= 0; i--) {
-        from = ibuf->float_buffer.data + int64_t(channels) * i * width;
-
-        for (int j = ibuf->x; j > 0; j--) {
-          to->r = float_to_half_safe(from[0]);
-          to->g = float_to_half_safe((channels >= 2) ? from[1] : from[0]);
-          to->b = float_to_half_safe((channels >= 3) ? from[2] : from[0]);
-          to->a = float_to_half_safe((channels >= 4) ? from[3] : 1.0f);
-          to++;
-          from += channels;
-        }
-      }
+      blender::threading::parallel_for(
+          blender::IndexRange(ibuf->y), 64, [&](const blender::IndexRange rows) {
+            for (const int64_t row : rows) {
+              const int64_t i = ibuf->y - 1 - row;
+              const float *from = ibuf->float_buffer.data + int64_t(channels) * i * width;
+              RGBAZ *to_row = to + row * width;
+
+              for (int j = ibuf->x; j > 0; j--) {
+                to_row->r = float_to_half_safe(from[0]);
+                to_row->g = float_to_half_safe((channels >= 2) ? from[1] : from[0]);
+                to_row->b = float_to_half_safe((channels >= 3) ? from[2] : from[0]);
+                to_row->a = float_to_half_safe((channels >= 4) ? from[3] : 1.0f);
+                to_row++;
+                from += channels;
+              }
+            }
+          });
     }
     else {
-      uchar *from;
-
-      for (int i = ibuf->y - 1; i >= 0; i--) {
-        from = ibuf->byte_buffer.data + int64_t(4) * i * width;
-
-        for (int j = ibuf->x; j > 0; j--) {
-          to->r = srgb_to_linearrgb(float(from[0]) / 255.0f);
-          to->g = srgb_to_linearrgb(float(from[1]) / 255.0f);
-          to->b = srgb_to_linearrgb(float(from[2]) / 255.0f);
-          to->a = channels >= 4 ? float(from[3]) / 255.0f : 1.0f;
-          to++;
-          from += 4;
-        }
-      }
+      blender::threading::parallel_for(
+          blender::IndexRange(ibuf->y), 64, [&](const blender::IndexRange rows) {
+            for (const int64_t row : rows) {
+              const int64_t i = ibuf->y - 1 - row;
+              const uchar *from = ibuf->byte_buffer.data + int64_t(4) * i * width;
+              RGBAZ *to_row = to + row * width;
+
+              for (int j = ibuf->x; j > 0; j--) {
+                to_row->r = srgb_to_linearrgb(float(from[0]) / 255.0f);
+                to_row->g = srgb_to_linearrgb(float(from[1]) / 255.0f);
+                to_row->b = srgb_to_linearrgb(float(from[2]) / 255.0f);
+                to_row->a = channels >= 4 ? float(from[3]) / 255.0f : 1.0f;
+                to_row++;
+                from += 4;
+              }
+            }
+          });
     }
 
     exr_printf("OpenEXR-save: Writing OpenEXR file of height %d.\n", height);
@@ -1246,9 +1254,14 @@ void IMB_exr_write_channels(void *handle)
       if (echan->use_half_float) {
         const float *rect = echan->rect;
         half *cur = current_rect_half;
-        for (size_t i = 0; i < num_pixels; i++, cur++) {
-          *cur = float_to_half_safe(rect[i * echan->xstride]);
-        }
+        const int xstride = echan->xstride;
+        /* Converting is noticeable for large multi-layer files with many passes. */
+        blender::threading::parallel_for(
+            blender::IndexRange(int64_t(num_pixels)), 65536, [&](const blender::IndexRange range) {
+              for (const int64_t i : range) {
+                cur[i] = float_to_half_safe(rect[i * xstride]);
+              }
+            });
         half *rect_to_write = current_rect_half + (data->height - 1L) * data->width;
         frameBuffer.insert(
             echan->name,
@@ -1398,6 +1411,12 @@ void IMB_exr_read_channels(void *handle)
       }
     }
 
+    /* Skip decoding parts that have none of their channels requested, which is common for multi
+     * part files where only a few of the layers or passes are used. */
+    if (frameBuffer.begin() == frameBuffer.end()) {
+      continue;
+    }
+
     /* Read pixels. */
     try {
       in.setFrameBuffer(frameBuffer);
@@ -7,6 +7,8 @@
  * \ingroup imbuf
  */
 
+#include <algorithm>
+#include <cmath>
 #include <type_traits>
 
 #include "BLI_math_color.h"
@@ -317,6 +319,102 @@ static void process_scanlines(const TransformContext &ctx, IndexRange y_range)
   }
 }
 
+/* Returns true if the transform is a translation by whole pixels, in which case nearest filtering
+ * maps destination pixels to source pixels at a fixed offset. */
+static bool is_integer_translation(const TransformContext &ctx)
+{
+  /* Keep coordinates in the range where floats represent all integers and half integers. */
+  const float max_coordinate = float(1 << 22);
+  return ctx.add_x == float2(1.0f, 0.0f) && ctx.add_y == float2(0.0f, 1.0f) &&
+         math::floor(ctx.start_uv) == ctx.start_uv &&
+         math::reduce_max(math::abs(ctx.start_uv)) < max_coordinate;
+}
+
+/* Returns the source coordinate sampled by the nearest filter for the destination coordinate at
+ * the given integer offset, which samples at the pixel center and truncates towards zero. */
+static int nearest_translated_coordinate(const int offset_coordinate)
+{
+  return offset_coordinate == -1 ? 0 : offset_coordinate;
+}
+
+/* Process a block of destination image scanlines for a nearest filtered translation by whole
+ * pixels, see is_integer_translation. Equivalent to process_scanlines with a nearest filter, but
+ * copies spans of source pixels instead of sampling every pixel. */
+template<typename T, bool CropSource>
+static void process_scanlines_translation(const TransformContext &ctx, IndexRange y_range)
+{
+  const int2 offset = int2(ctx.start_uv);
+  const int src_width = ctx.src->x;
+  const int src_height = ctx.src->y;
+
+  /* Destination pixels whose sample location is inside the source crop, the sample location of
+   * pixel x being offset.x + x + 0.5, which is computed exactly. */
+  int x_first = ctx.dst_region_x_range.first();
+  int x_end = ctx.dst_region_x_range.one_after_last();
+  if constexpr (CropSource) {
+    x_first = std::max(x_first, int(ceil(double(ctx.src_crop.xmin) - offset.x - 0.5)));
+    x_end = std::min(x_end, int(ceil(double(ctx.src_crop.xmax) - offset.x - 0.5)));
+  }
+  if (x_first >= x_end) {
+    return;
+  }
+
+  /* Split the columns into the ones that map to source pixels, sampled directly or through
+   * truncation of the sample coordinate, and the ones outside of the source that are zero. */
+  const int x_copy_first = std::clamp(-offset.x, x_first, x_end);
+  const int x_copy_end = std::clamp(src_width - offset.x, x_first, x_end);
+  const int x_truncated = -offset.x - 1;
+
+  for (int yi : y_range) {
+    if constexpr (CropSource) {
+      const float v = float(offset.y + yi) + 0.5f;
+      if (v < ctx.src_crop.ymin || v >= ctx.src_crop.ymax) {
+        continue;
+      }
+    }
+
+    T *output = init_pixel_pointer<T>(ctx.dst, x_first, yi);
+    const int src_y = nearest_translated_coordinate(offset.y + yi);
+    if (src_y < 0 || src_y >= src_height || src_width <= 0) {
+      std::fill_n(output, size_t(x_end - x_first) * 4, T(0));
+      continue;
+    }
+
+    const T *src_row = init_pixel_pointer<T>(ctx.src, 0, src_y);
+    std::fill_n(output, size_t(x_copy_first - x_first) * 4, T(0));
+    std::copy_n(src_row + size_t(x_copy_first + offset.x) * 4,
+                size_t(x_copy_end - x_copy_first) * 4,
+                output + size_t(x_copy_first - x_first) * 4);
+    std::fill_n(output + size_t(x_copy_end - x_first) * 4, size_t(x_end - x_copy_end) * 4, T(0));
+
+    /* The column just before the source samples at -0.5, which truncates to the first column. */
+    if (x_truncated >= x_first && x_truncated < x_end) {
+      std::copy_n(src_row, 4, output + size_t(x_truncated - x_first) * 4);
+    }
+  }
+}
+
+template<typename T>
+static void transform_scanlines_translation(const TransformContext &ctx, IndexRange y_range)
+{
+  if (ctx.mode == IMB_TRANSFORM_MODE_CROP_SRC) {
+    process_scanlines_translation<T, true>(ctx, y_range);
+  }
+  else {
+    process_scanlines_translation<T, false>(ctx, y_range);
+  }
+}
+
+static void transform_scanlines_translation(const TransformContext &ctx, IndexRange y_range)
+{
+  if (ctx.dst->float_buffer.data && ctx.src->float_buffer.data) {
+    transform_scanlines_translation<float>(ctx, y_range);
+  }
+  if (ctx.dst->byte_buffer.data && ctx.src->byte_buffer.data) {
+    transform_scanlines_translation<uchar>(ctx, y_range);
+  }
+}
+
 template<eIMBInterpolationFilterMode Filter, typename T, int SrcChannels>
 static void transform_scanlines(const TransformContext &ctx, IndexRange y_range)
 {
@@ -486,8 +584,17 @@ void IMB_transform(const ImBuf *src,
   }
   ctx.init(transform_matrix, crop);
 
+  /* Common case of strips that are only moved by whole pixels, for which rows of source pixels can
+   * be copied directly. */
+  const bool use_translation = filter == IMB_FILTER_NEAREST && src->channels == 4 &&
+                               mode != IMB_TRANSFORM_MODE_WRAP_REPEAT &&
+                               is_integer_translation(ctx);
+
   threading::parallel_for(ctx.dst_region_y_range, 8, [&](IndexRange y_range) {
-    if (filter == IMB_FILTER_NEAREST) {
+    if (use_translation) {
+      transform_scanlines_translation(ctx, y_range);
+    }
+    else if (filter == IMB_FILTER_NEAREST) {
       transform_scanlines_filter<IMB_FILTER_NEAREST>(ctx, y_range);
     }
     else if (filter == IMB_FILTER_BILINEAR) {
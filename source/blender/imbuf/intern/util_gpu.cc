@@ -6,6 +6,7 @@
  * \ingroup imbuf
  */
 
+#include "BLI_math_half.hh"
 #include "BLI_utildefines.h"
 #include "MEM_guardedalloc.h"
 
@@ -250,6 +251,38 @@ static void *imb_gpu_get_data(const ImBuf *ibuf,
   return data_rect;
 }
 
+/**
+ * Half float textures are filled from float data by the GPU backend, which goes through a full
+ * precision staging copy. Pack the data as half floats on the CPU instead, halving the memory
+ * used for the upload and the amount of data transferred.
+ */
+static void imb_gpu_data_to_half_float(const eGPUTextureFormat tex_format,
+                                       const int size[2],
+                                       void **data,
+                                       bool *r_freedata,
+                                       eGPUDataFormat *r_data_format)
+{
+  if (*r_data_format != GPU_DATA_FLOAT || !ELEM(tex_format, GPU_RGBA16F, GPU_R16F)) {
+    return;
+  }
+
+  const size_t channels = (tex_format == GPU_R16F) ? 1 : 4;
+  const size_t length = channels * size_t(size[0]) * size_t(size[1]);
+  uint16_t *half_data = MEM_malloc_arrayN<uint16_t>(length, __func__);
+  if (half_data == nullptr) {
+    return;
+  }
+
+  blender::math::float_to_half_array(static_cast<const float *>(*data), half_data, length);
+
+  if (*r_freedata) {
+    MEM_freeN(*data);
+  }
+  *data = half_data;
+  *r_freedata = true;
+  *r_data_format = GPU_DATA_HALF_FLOAT;
+}
+
 GPUTexture *IMB_touch_gpu_texture(const char *name,
                                   ImBuf *ibuf,
                                   int w,
@@ -298,6 +331,9 @@ void IMB_update_gpu_texture_sub(GPUTexture *tex,
   eGPUDataFormat data_format;
   void *data = imb_gpu_get_data(
       ibuf, do_rescale, size, use_premult, use_grayscale, &freebuf, &data_format);
+  if (data != nullptr) {
+    imb_gpu_data_to_half_float(tex_format, size, &data, &freebuf, &data_format);
+  }
 
   /* Update Texture. */
   GPU_texture_update_sub(tex, data_format, data, x, y, z, w, h, 1);
@@ -378,6 +414,9 @@ GPUTexture *IMB_create_gpu_texture(const char *name,
   BLI_assert(tex != nullptr);
   eGPUDataFormat data_format;
   void *data = imb_gpu_get_data(ibuf, do_rescale, size, use_premult, true, &freebuf, &data_format);
+  if (data != nullptr) {
+    imb_gpu_data_to_half_float(tex_format, size, &data, &freebuf, &data_format);
+  }
   GPU_texture_update(tex, data_format, data);
 
   GPU_texture_swizzle_set(tex, imb_gpu_get_swizzle(ibuf));
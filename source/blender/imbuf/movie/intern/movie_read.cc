@@ -17,6 +17,7 @@
 
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -574,6 +575,36 @@ static AVFrame *ffmpeg_double_buffer_frame_fallback_get(MovieReader *anim)
   return nullptr;
 }
 
+/* Keep a reference to the most recently decoded frame in the scrub frames ring. */
+static void ffmpeg_scrub_frame_store(MovieReader *anim)
+{
+  if (!anim->pFrame_complete) {
+    return;
+  }
+
+  AVFrame *&frame = anim->scrub_frames[anim->scrub_frame_next];
+  if (frame == nullptr) {
+    frame = av_frame_alloc();
+  }
+  else {
+    av_frame_unref(frame);
+  }
+
+  if (av_frame_ref(frame, anim->pFrame) < 0) {
+    av_frame_free(&frame);
+    return;
+  }
+  anim->scrub_frame_next = (anim->scrub_frame_next + 1) % MovieReader::scrub_frames_num;
+}
+
+static void ffmpeg_scrub_frames_free(MovieReader *anim)
+{
+  for (AVFrame *&frame : anim->scrub_frames) {
+    av_frame_free(&frame);
+  }
+  anim->scrub_frame_next = 0;
+}
+
 /**
  * Postprocess the image in anim->pFrame and do color conversion and de-interlacing stuff.
  *
@@ -628,20 +659,28 @@ static void ffmpeg_postprocess(MovieReader *anim, AVFrame *input, ImBuf *ibuf)
                        anim->pFrameRGB->linesize[2] == src_linesize &&
                        anim->pFrameRGB->linesize[3] == src_linesize,
                    "ffmpeg frame should be 4 same size planes for a floating point image case");
-    for (int y = 0; y < ibuf->y; y++) {
-      size_t src_offset = src_linesize * (ibuf->y - y - 1);
-      const float *src_g = reinterpret_cast<const float *>(anim->pFrameRGB->data[0] + src_offset);
-      const float *src_b = reinterpret_cast<const float *>(anim->pFrameRGB->data[1] + src_offset);
-      const float *src_r = reinterpret_cast<const float *>(anim->pFrameRGB->data[2] + src_offset);
-      const float *src_a = reinterpret_cast<const float *>(anim->pFrameRGB->data[3] + src_offset);
-      float *dst = ibuf->float_buffer.data + ibuf->x * y * 4;
-      for (int x = 0; x < ibuf->x; x++) {
-        *dst++ = *src_r++;
-        *dst++ = *src_g++;
-        *dst++ = *src_b++;
-        *dst++ = *src_a++;
-      }
-    }
+    /* Interleaving is memory bound and costly for high resolution footage, split it over rows. */
+    blender::threading::parallel_for(
+        blender::IndexRange(ibuf->y), 64, [&](const blender::IndexRange y_range) {
+          for (const int64_t y : y_range) {
+            size_t src_offset = src_linesize * (ibuf->y - y - 1);
+            const float *src_g = reinterpret_cast<const float *>(anim->pFrameRGB->data[0] +
+                                                                 src_offset);
+            const float *src_b = reinterpret_cast<const float *>(anim->pFrameRGB->data[1] +
+                                                                 src_offset);
+            const float *src_r = reinterpret_cast<const float *>(anim->pFrameRGB->data[2] +
+                                                                 src_offset);
+            const float *src_a = reinterpret_cast<const float *>(anim->pFrameRGB->data[3] +
+                                                                 src_offset);
+            float *dst = ibuf->float_buffer.data + size_t(ibuf->x) * y * 4;
+            for (int x = 0; x < ibuf->x; x++) {
+              *dst++ = *src_r++;
+              *dst++ = *src_g++;
+              *dst++ = *src_b++;
+              *dst++ = *src_a++;
+            }
+          }
+        });
   }
   else {
     /* If final destination image layout matches that of decoded RGB frame (including
@@ -754,6 +793,24 @@ static AVFrame *ffmpeg_frame_by_pts_get(MovieReader *anim, int64_t pts_to_search
   return best_frame;
 }
 
+/* Return frame from the scrub frames ring that matches `pts_to_search`, nullptr if there is none.
+ * Frames without a known duration are never matched. */
+static AVFrame *ffmpeg_scrub_frame_get(MovieReader *anim, int64_t pts_to_search)
+{
+  for (AVFrame *frame : anim->scrub_frames) {
+    if (frame == nullptr) {
+      continue;
+    }
+    const int64_t frame_start = av_get_pts_from_frame(frame);
+    const int64_t frame_end = frame_start + av_get_frame_duration_in_pts_units(frame);
+    if (ffmpeg_pts_isect(frame_start, frame_end, pts_to_search)) {
+      final_frame_log(anim, frame_start, frame_end, "Scrub");
+      return frame;
+    }
+  }
+  return nullptr;
+}
+
 static void ffmpeg_decode_store_frame_pts(MovieReader *anim)
 {
   anim->cur_pts = av_get_pts_from_frame(anim->pFrame);
@@ -928,6 +985,9 @@ static void ffmpeg_decode_video_frame_scan(MovieReader *anim, int64_t pts_to_sea
     ffmpeg_scan_log(anim, pts_to_search);
     ffmpeg_double_buffer_backup_frame_store(anim, pts_to_search);
     decode_error = ffmpeg_decode_video_frame(anim) < 1;
+    if (!decode_error) {
+      ffmpeg_scrub_frame_store(anim);
+    }
 
     /* We should not get a new GOP keyframe while scanning if seeking is working as intended.
      * If this condition triggers, there may be and error in our seeking code.
@@ -1153,6 +1213,7 @@ static ImBuf *ffmpeg_fetchibuf(MovieReader *anim, int position, IMB_Timecode_Typ
   double frame_rate = av_q2d(v_st->r_frame_rate);
   double pts_time_base = av_q2d(v_st->time_base);
   int64_t start_pts = v_st->start_time;
+  AVFrame *scrub_frame = nullptr;
 
   if (anim->never_seek_decode_one_frame) {
     /* If we must only ever decode one frame, and never seek, do so here. */
@@ -1173,10 +1234,17 @@ static ImBuf *ffmpeg_fetchibuf(MovieReader *anim, int position, IMB_Timecode_Typ
 
     if (ffmpeg_must_decode(anim, position)) {
       if (ffmpeg_must_seek(anim, position)) {
-        ffmpeg_seek_to_key_frame(anim, position, tc_index, pts_to_search);
+        /* Scrubbing backwards is likely to request a recently decoded frame, use it instead of
+         * seeking and decoding from the key frame. The decoder state is left untouched. */
+        scrub_frame = ffmpeg_scrub_frame_get(anim, pts_to_search);
+        if (scrub_frame == nullptr) {
+          ffmpeg_seek_to_key_frame(anim, position, tc_index, pts_to_search);
+        }
       }
 
-      ffmpeg_decode_video_frame_scan(anim, pts_to_search);
+      if (scrub_frame == nullptr) {
+        ffmpeg_decode_video_frame_scan(anim, pts_to_search);
+      }
     }
   }
 
@@ -1207,7 +1275,7 @@ static ImBuf *ffmpeg_fetchibuf(MovieReader *anim, int position, IMB_Timecode_Typ
     cur_frame_final->byte_buffer.colorspace = colormanage_colorspace_get_named(anim->colorspace);
   }
 
-  AVFrame *final_frame = ffmpeg_frame_by_pts_get(anim, pts_to_search);
+  AVFrame *final_frame = scrub_frame ? scrub_frame : ffmpeg_frame_by_pts_get(anim, pts_to_search);
   if (final_frame == nullptr) {
     /* No valid frame was decoded for requested PTS, fall back on most recent decoded frame, even
      * if it is incorrect. */
@@ -1220,7 +1288,10 @@ static ImBuf *ffmpeg_fetchibuf(MovieReader *anim, int position, IMB_Timecode_Typ
     ffmpeg_postprocess(anim, final_frame, cur_frame_final);
   }
 
-  anim->cur_position = position;
+  /* The current position tracks the decoder state, which is not changed by using a scrub frame. */
+  if (scrub_frame == nullptr) {
+    anim->cur_position = position;
+  }
 
   return cur_frame_final;
 }
@@ -1238,6 +1309,7 @@ static void free_anim_ffmpeg(MovieReader *anim)
 
     av_frame_free(&anim->pFrame);
     av_frame_free(&anim->pFrame_backup);
+    ffmpeg_scrub_frames_free(anim);
     av_frame_free(&anim->pFrameRGB);
     if (anim->pFrameDeinterlaced->data[0] != nullptr) {
       MEM_freeN(anim->pFrameDeinterlaced->data[0]);
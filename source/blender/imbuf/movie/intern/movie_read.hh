@@ -62,6 +62,12 @@ struct MovieReader {
   AVFrame *pFrame_backup = nullptr;
   bool pFrame_backup_complete = false;
 
+  /* Most recently decoded frames, used to serve backward scrubbing without seeking to the
+   * previous key frame and decoding the whole GOP again. */
+  static constexpr int scrub_frames_num = 4;
+  AVFrame *scrub_frames[scrub_frames_num] = {};
+  int scrub_frame_next = 0;
+
   int64_t cur_pts = 0;
   int64_t cur_key_frame_pts = 0;
   AVPacket *cur_packet = nullptr;
@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <algorithm>
+
 #include "testing/testing.h"
 
 #include "BLI_color.hh"
@@ -153,4 +155,56 @@ TEST(imbuf_transform, nearest_very_large_scale)
   IMB_freeImBuf(res);
 }
 
+TEST(imbuf_transform, nearest_integer_translation)
+{
+  ImBuf *src = create_6x2_test_image();
+  ImBuf *res = IMB_allocImBuf(8, 3, 32, IB_byte_data);
+  float3x3 matrix = math::from_location<float3x3>(float2(-2.0f, -1.0f));
+  IMB_transform(src, res, IMB_TRANSFORM_MODE_REGULAR, IMB_FILTER_NEAREST, matrix, nullptr);
+
+  /* Pixels sampling at -0.5 get the first column/row due to truncation in the sampler, pixels
+   * further out are transparent. */
+  const ColorTheme4b *src_col = reinterpret_cast<ColorTheme4b *>(src->byte_buffer.data);
+  const ColorTheme4b *got = reinterpret_cast<ColorTheme4b *>(res->byte_buffer.data);
+  const ColorTheme4b col_0 = ColorTheme4b(0, 0, 0, 0);
+  EXPECT_EQ(got[0], col_0);
+  EXPECT_EQ(got[1], src_col[0]);
+  EXPECT_EQ(got[2], src_col[0]);
+  EXPECT_EQ(got[3], src_col[1]);
+  EXPECT_EQ(got[7], src_col[5]);
+  EXPECT_EQ(got[8 + 1], src_col[0]);
+  EXPECT_EQ(got[8 + 7], src_col[5]);
+  EXPECT_EQ(got[16], col_0);
+  EXPECT_EQ(got[16 + 1], src_col[6]);
+  EXPECT_EQ(got[16 + 4], src_col[8]);
+  EXPECT_EQ(got[16 + 7], src_col[11]);
+  IMB_freeImBuf(src);
+  IMB_freeImBuf(res);
+}
+
+TEST(imbuf_transform, nearest_integer_translation_crop)
+{
+  ImBuf *src = create_6x2_test_image();
+  ImBuf *res = IMB_allocImBuf(8, 3, 32, IB_byte_data);
+  const ColorTheme4b col_fill = ColorTheme4b(1, 2, 3, 4);
+  ColorTheme4b *got = reinterpret_cast<ColorTheme4b *>(res->byte_buffer.data);
+  std::fill_n(got, res->x * res->y, col_fill);
+
+  float3x3 matrix = math::from_location<float3x3>(float2(-2.0f, -1.0f));
+  rctf crop = {1.0f, 5.0f, 0.0f, 2.0f};
+  IMB_transform(src, res, IMB_TRANSFORM_MODE_CROP_SRC, IMB_FILTER_NEAREST, matrix, &crop);
+
+  /* Pixels sampling outside of the crop are left untouched. */
+  const ColorTheme4b *src_col = reinterpret_cast<ColorTheme4b *>(src->byte_buffer.data);
+  EXPECT_EQ(got[3], col_fill);
+  EXPECT_EQ(got[8 + 2], col_fill);
+  EXPECT_EQ(got[8 + 3], src_col[1]);
+  EXPECT_EQ(got[8 + 6], src_col[4]);
+  EXPECT_EQ(got[8 + 7], col_fill);
+  EXPECT_EQ(got[16 + 3], src_col[7]);
+  EXPECT_EQ(got[16 + 6], src_col[10]);
+  IMB_freeImBuf(src);
+  IMB_freeImBuf(res);
+}
+
 }  // namespace blender::imbuf::tests
@@ -171,8 +171,10 @@ void ABCGenericMeshWriter::do_write(HierarchyContext &context)
 
   m_custom_data_config.pack_uvs = args_.export_params->packuv;
   m_custom_data_config.mesh = mesh;
-  m_custom_data_config.face_offsets = mesh->face_offsets_for_write().data();
-  m_custom_data_config.corner_verts = mesh->corner_verts_for_write().data();
+  /* The topology is only read during export, requesting it for writing would copy it when it is
+   * shared with the original mesh. */
+  m_custom_data_config.face_offsets = const_cast<int *>(mesh->face_offsets().data());
+  m_custom_data_config.corner_verts = const_cast<int *>(mesh->corner_verts().data());
   m_custom_data_config.faces_num = mesh->faces_num;
   m_custom_data_config.totloop = mesh->corners_num;
   m_custom_data_config.totvert = mesh->verts_num;
@@ -210,14 +212,20 @@ void ABCGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
   std::vector<Imath::V3f> velocities;
 
   get_vertices(mesh, points);
-  get_topology(mesh, face_verts, loop_counts);
+  /* Alembic reuses the topology of the previous sample when it is left empty. */
+  const bool write_topology = !topology_is_shared_with_last_sample(mesh);
+  if (write_topology) {
+    get_topology(mesh, face_verts, loop_counts);
+  }
 
   if (!frame_has_been_written_ && args_.export_params->face_sets) {
     write_face_sets(context.object, mesh, abc_poly_mesh_schema_);
   }
 
   OPolyMeshSchema::Sample mesh_sample = OPolyMeshSchema::Sample(
-      V3fArraySample(points), Int32ArraySample(face_verts), Int32ArraySample(loop_counts));
+      V3fArraySample(points),
+      write_topology ? Int32ArraySample(face_verts) : Int32ArraySample(),
+      write_topology ? Int32ArraySample(loop_counts) : Int32ArraySample());
 
   UVSample uvs_and_indices;
 
@@ -276,7 +284,10 @@ void ABCGenericMeshWriter::write_subd(HierarchyContext &context, Mesh *mesh)
   std::vector<int32_t> edge_crease_indices, edge_crease_lengths, vert_crease_indices;
 
   get_vertices(mesh, points);
-  get_topology(mesh, face_verts, loop_counts);
+  const bool write_topology = !topology_is_shared_with_last_sample(mesh);
+  if (write_topology) {
+    get_topology(mesh, face_verts, loop_counts);
+  }
   get_edge_creases(mesh, edge_crease_indices, edge_crease_lengths, edge_crease_sharpness);
   get_vert_creases(mesh, vert_crease_indices, vert_crease_sharpness);
 
@@ -285,7 +296,9 @@ void ABCGenericMeshWriter::write_subd(HierarchyContext &context, Mesh *mesh)
   }
 
   OSubDSchema::Sample subdiv_sample = OSubDSchema::Sample(
-      V3fArraySample(points), Int32ArraySample(face_verts), Int32ArraySample(loop_counts));
+      V3fArraySample(points),
+      write_topology ? Int32ArraySample(face_verts) : Int32ArraySample(),
+      write_topology ? Int32ArraySample(loop_counts) : Int32ArraySample());
 
   UVSample sample;
   if (args_.export_params->uvs) {
@@ -360,6 +373,31 @@ void ABCGenericMeshWriter::write_arb_geo_params(Mesh *mesh)
   write_custom_data(arb_geom_params, m_custom_data_config, &mesh->corner_data, CD_PROP_BYTE_COLOR);
 }
 
+bool ABCGenericMeshWriter::topology_is_shared_with_last_sample(const Mesh *mesh)
+{
+  const ImplicitSharingInfo *face_offsets = mesh->runtime->face_offsets_sharing_info;
+  const ImplicitSharingInfo *corner_verts =
+      mesh->attributes().lookup<int>(".corner_vert").sharing_info;
+
+  if (frame_has_been_written_ && face_offsets && corner_verts &&
+      face_offsets == last_face_offsets_.get() && corner_verts == last_corner_verts_.get())
+  {
+    return true;
+  }
+
+  /* Keep the arrays alive, so that they can't be freed and reallocated at the same address. While
+   * they are shared, they can't be modified either. */
+  if (face_offsets) {
+    face_offsets->add_user();
+  }
+  if (corner_verts) {
+    corner_verts->add_user();
+  }
+  last_face_offsets_ = ImplicitSharingPtr<>(face_offsets);
+  last_corner_verts_ = ImplicitSharingPtr<>(corner_verts);
+  return false;
+}
+
 bool ABCGenericMeshWriter::get_velocities(Mesh *mesh, std::vector<Imath::V3f> &vels)
 {
   /* Export velocity attribute output by fluid sim, sequence cache modifier
@@ -10,6 +10,8 @@
 #include "abc_writer_abstract.h"
 #include "intern/abc_customdata.h"
 
+#include "BLI_implicit_sharing_ptr.hh"
+
 #include <Alembic/AbcGeom/OPolyMesh.h>
 #include <Alembic/AbcGeom/OSubD.h>
 
@@ -36,6 +38,11 @@ class ABCGenericMeshWriter : public ABCAbstractWriter {
 
   CDStreamConfig m_custom_data_config;
 
+  /* Topology arrays of the last written sample. While the exported mesh still shares them, the
+   * topology is unchanged and doesn't have to be extracted and written again. */
+  ImplicitSharingPtr<> last_face_offsets_;
+  ImplicitSharingPtr<> last_corner_verts_;
+
  public:
   explicit ABCGenericMeshWriter(const ABCWriterConstructorArgs &args);
 
@@ -58,6 +65,7 @@ class ABCGenericMeshWriter : public ABCAbstractWriter {
   template<typename Schema> void write_face_sets(Object *object, Mesh *mesh, Schema &schema);
 
   void write_arb_geo_params(Mesh *mesh);
+  bool topology_is_shared_with_last_sample(const Mesh *mesh);
   bool get_velocities(Mesh *mesh, std::vector<Imath::V3f> &vels);
   void get_geo_groups(Object *object,
                       Mesh *mesh,
@@ -25,6 +25,7 @@
 #include "BLI_math_base.h"
 #include "BLI_math_vector.h"
 #include "BLI_math_vector_types.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_attribute.hh"
@@ -327,26 +328,27 @@ static void read_uvs(const CDStreamConfig &config,
   const int *corner_verts = config.corner_verts;
   float2 *mloopuvs = static_cast<float2 *>(data);
 
-  uint uv_index, loop_index, rev_loop_index;
-
   BLI_assert(uv_scope != ABC_UV_SCOPE_NONE);
   const bool do_uvs_per_loop = (uv_scope == ABC_UV_SCOPE_LOOP);
 
-  for (const int i : faces.index_range()) {
-    const IndexRange face = faces[i];
-    uint rev_loop_offset = face.start() + face.size() - 1;
-
-    for (int f = 0; f < face.size(); f++) {
-      rev_loop_index = rev_loop_offset - f;
-      loop_index = do_uvs_per_loop ? face.start() + f : corner_verts[rev_loop_index];
-      uv_index = (*indices)[loop_index];
-      const Imath::V2f &uv = (*uvs)[uv_index];
-
-      float2 &loopuv = mloopuvs[rev_loop_index];
-      loopuv[0] = uv[0];
-      loopuv[1] = uv[1];
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const IndexRange face = faces[i];
+      const uint rev_loop_offset = face.start() + face.size() - 1;
+
+      for (int f = 0; f < face.size(); f++) {
+        const uint rev_loop_index = rev_loop_offset - f;
+        const uint loop_index = do_uvs_per_loop ? face.start() + f :
+                                                  corner_verts[rev_loop_index];
+        const uint uv_index = (*indices)[loop_index];
+        const Imath::V2f &uv = (*uvs)[uv_index];
+
+        float2 &loopuv = mloopuvs[rev_loop_index];
+        loopuv[0] = uv[0];
+        loopuv[1] = uv[1];
+      }
     }
-  }
+  });
 }
 
 static size_t mcols_out_of_bounds_check(const size_t color_index,
@@ -17,11 +17,13 @@
 
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_threads.h"
 
 #ifdef WIN32
 #  include "utfconv.hh"
 #endif
 
+#include <algorithm>
 #include <fstream>
 #include <vector>
 
@@ -114,16 +116,28 @@ ArchiveReader::ArchiveReader(const Main *bmain, const char *filename)
   STRNCPY(abs_filepath, filename);
   BLI_path_abs(abs_filepath, BKE_main_blendfile_path(bmain));
 
+  const int streams_num = std::clamp(BLI_system_thread_count(), 1, 8);
+
 #ifdef WIN32
   UTF16_ENCODE(abs_filepath);
   std::wstring wstr(abs_filepath_16);
-  m_infile.open(wstr.c_str(), std::ios::in | std::ios::binary);
   UTF16_UN_ENCODE(abs_filepath);
-#else
-  m_infile.open(abs_filepath, std::ios::in | std::ios::binary);
 #endif
 
-  m_streams.push_back(&m_infile);
+  for (int i = 0; i < streams_num; i++) {
+    std::unique_ptr<std::ifstream> infile = std::make_unique<std::ifstream>();
+#ifdef WIN32
+    infile->open(wstr.c_str(), std::ios::in | std::ios::binary);
+#else
+    infile->open(abs_filepath, std::ios::in | std::ios::binary);
+#endif
+    /* Always keep the first stream, so that opening the archive reports the error. */
+    if (i > 0 && !infile->is_open()) {
+      break;
+    }
+    m_streams.push_back(infile.get());
+    m_infiles.push_back(std::move(infile));
+  }
 
   m_archive = open_archive(abs_filepath, m_streams);
 }
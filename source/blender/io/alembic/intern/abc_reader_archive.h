@@ -11,6 +11,7 @@
 #include <Alembic/Abc/IObject.h>
 
 #include <fstream>
+#include <memory>
 #include <vector>
 
 struct Main;
@@ -24,7 +25,9 @@ namespace blender::io::alembic {
  */
 class ArchiveReader {
   Alembic::Abc::IArchive m_archive;
-  std::ifstream m_infile;
+  /* Several streams of the same file allow Ogawa to read from multiple threads at once, for
+   * example when the depsgraph evaluates many cache modifiers in parallel. */
+  std::vector<std::unique_ptr<std::ifstream>> m_infiles;
   std::vector<std::istream *> m_streams;
 
   std::vector<ArchiveReader *> m_readers;
@@ -14,6 +14,10 @@
 
 namespace blender::io::ply {
 
+/* Number of elements after which formatted data is written to the file, so that the whole
+ * output doesn't have to be kept in memory. */
+static constexpr int flush_elements_num = 64 * 1024;
+
 void write_vertices(FileBuffer &buffer, const PlyData &ply_data)
 {
   for (int i = 0; i < ply_data.vertices.size(); i++) {
@@ -40,6 +44,9 @@ void write_vertices(FileBuffer &buffer, const PlyData &ply_data)
     }
 
     buffer.write_vertex_end();
+    if ((i + 1) % flush_elements_num == 0) {
+      buffer.write_to_file();
+    }
   }
   buffer.write_to_file();
 }
@@ -47,16 +54,23 @@ void write_vertices(FileBuffer &buffer, const PlyData &ply_data)
 void write_faces(FileBuffer &buffer, const PlyData &ply_data)
 {
   const uint32_t *indices = ply_data.face_vertices.data();
-  for (uint32_t face_size : ply_data.face_sizes) {
+  for (const int i : ply_data.face_sizes.index_range()) {
+    const uint32_t face_size = ply_data.face_sizes[i];
     buffer.write_face(char(face_size), Span<uint32_t>(indices, face_size));
     indices += face_size;
+    if ((i + 1) % flush_elements_num == 0) {
+      buffer.write_to_file();
+    }
   }
   buffer.write_to_file();
 }
 void write_edges(FileBuffer &buffer, const PlyData &ply_data)
 {
-  for (const std::pair<int, int> &edge : ply_data.edges) {
-    buffer.write_edge(edge.first, edge.second);
+  for (const int i : ply_data.edges.index_range()) {
+    buffer.write_edge(ply_data.edges[i].first, ply_data.edges[i].second);
+    if ((i + 1) % flush_elements_num == 0) {
+      buffer.write_to_file();
+    }
   }
   buffer.write_to_file();
 }
@@ -12,6 +12,7 @@
 
 #include "BLI_endian_switch.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 
 #include "fast_float.h"
 
@@ -193,22 +194,13 @@ template<typename T> static T get_binary_value(PlyDataTypes type, const uint8_t
   return val;
 }
 
-static const char *parse_row_binary(PlyReadBuffer &file,
-                                    const PlyHeader &header,
-                                    const PlyElement &element,
-                                    Vector<uint8_t> &r_scratch,
-                                    Vector<float> &r_values)
+/* Convert the values of a binary row. Big endian values are switched in place. */
+static void decode_row_binary(const PlyHeader &header,
+                              const PlyElement &element,
+                              uint8_t *row,
+                              MutableSpan<float> r_values)
 {
-  if (element.stride == 0) {
-    return "Vertex/Edge element contains list properties, this is not supported";
-  }
-  BLI_assert(r_scratch.size() == element.stride);
-  BLI_assert(r_values.size() == element.properties.size());
-  if (!file.read_bytes(r_scratch.data(), r_scratch.size())) {
-    return "Could not read row of binary property";
-  }
-
-  const uint8_t *ptr = r_scratch.data();
+  const uint8_t *ptr = row;
   if (header.type == PlyFormatType::BINARY_LE) {
     /* Little endian: just read/convert the values. */
     for (int i = 0, n = int(element.properties.size()); i != n; i++) {
@@ -217,7 +209,7 @@ static const char *parse_row_binary(PlyReadBuffer &file,
       r_values[i] = val;
     }
   }
-  else if (header.type == PlyFormatType::BINARY_BE) {
+  else {
     /* Big endian: read, switch endian, convert the values. */
     for (int i = 0, n = int(element.properties.size()); i != n; i++) {
       const PlyProperty &prop = element.properties[i];
@@ -226,9 +218,27 @@ static const char *parse_row_binary(PlyReadBuffer &file,
       r_values[i] = val;
     }
   }
-  else {
+}
+
+static const char *parse_row_binary(PlyReadBuffer &file,
+                                    const PlyHeader &header,
+                                    const PlyElement &element,
+                                    Vector<uint8_t> &r_scratch,
+                                    Vector<float> &r_values)
+{
+  if (element.stride == 0) {
+    return "Vertex/Edge element contains list properties, this is not supported";
+  }
+  BLI_assert(r_scratch.size() == element.stride);
+  BLI_assert(r_values.size() == element.properties.size());
+  if (!ELEM(header.type, PlyFormatType::BINARY_LE, PlyFormatType::BINARY_BE)) {
     return "Unknown binary ply format for vertex element";
   }
+  if (!file.read_bytes(r_scratch.data(), r_scratch.size())) {
+    return "Could not read row of binary property";
+  }
+
+  decode_row_binary(header, element, r_scratch.data(), r_values);
   return nullptr;
 }
 
@@ -270,15 +280,15 @@ static const char *load_vertex_element(PlyReadBuffer &file,
     data->vertex_custom_attr.append(attr);
   }
 
-  data->vertices.reserve(element.count);
+  data->vertices.resize(element.count);
   if (has_color) {
-    data->vertex_colors.reserve(element.count);
+    data->vertex_colors.resize(element.count);
   }
   if (has_normal) {
-    data->vertex_normals.reserve(element.count);
+    data->vertex_normals.resize(element.count);
   }
   if (has_uv) {
-    data->uv_coordinates.reserve(element.count);
+    data->uv_coordinates.resize(element.count);
   }
 
   float4 color_norm = {1, 1, 1, 1};
@@ -291,31 +301,13 @@ static const char *load_vertex_element(PlyReadBuffer &file,
     color_norm.w = data_type_normalizer[element.properties[alpha_index].type];
   }
 
-  Vector<float> value_vec(element.properties.size());
-  Vector<uint8_t> scratch;
-  if (header.type != PlyFormatType::ASCII) {
-    scratch.resize(element.stride);
-  }
-
-  for (int i = 0; i < element.count; i++) {
-
-    const char *error = nullptr;
-    if (header.type == PlyFormatType::ASCII) {
-      error = parse_row_ascii(file, value_vec);
-    }
-    else {
-      error = parse_row_binary(file, header, element, scratch, value_vec);
-    }
-    if (error != nullptr) {
-      return error;
-    }
-
+  auto store_vertex = [&](const int i, const Span<float> value_vec) {
     /* Vertex coord */
     float3 vertex3;
     vertex3.x = value_vec[vertex_index.x];
     vertex3.y = value_vec[vertex_index.y];
     vertex3.z = value_vec[vertex_index.z];
-    data->vertices.append(vertex3);
+    data->vertices[i] = vertex3;
 
     /* Vertex color */
     if (has_color) {
@@ -329,7 +321,7 @@ static const char *load_vertex_element(PlyReadBuffer &file,
       else {
         colors4.w = 1.0f;
       }
-      data->vertex_colors.append(colors4);
+      data->vertex_colors[i] = colors4;
     }
 
     /* If normals */
@@ -338,7 +330,7 @@ static const char *load_vertex_element(PlyReadBuffer &file,
       normals3.x = value_vec[normal_index.x];
       normals3.y = value_vec[normal_index.y];
       normals3.z = value_vec[normal_index.z];
-      data->vertex_normals.append(normals3);
+      data->vertex_normals[i] = normals3;
     }
 
     /* If uv */
@@ -346,7 +338,7 @@ static const char *load_vertex_element(PlyReadBuffer &file,
       float2 uvmap;
       uvmap.x = value_vec[uv_index.x];
       uvmap.y = value_vec[uv_index.y];
-      data->uv_coordinates.append(uvmap);
+      data->uv_coordinates[i] = uvmap;
     }
 
     /* Custom attributes */
@@ -354,6 +346,42 @@ static const char *load_vertex_element(PlyReadBuffer &file,
       float value = value_vec[custom_attr_indices[ci]];
       data->vertex_custom_attr[ci].data[i] = value;
     }
+  };
+
+  if (header.type == PlyFormatType::ASCII) {
+    Vector<float> value_vec(element.properties.size());
+    for (int i = 0; i < element.count; i++) {
+      const char *error = parse_row_ascii(file, value_vec);
+      if (error != nullptr) {
+        return error;
+      }
+      store_vertex(i, value_vec);
+    }
+    return nullptr;
+  }
+
+  if (element.stride == 0) {
+    return "Vertex/Edge element contains list properties, this is not supported";
+  }
+  if (!ELEM(header.type, PlyFormatType::BINARY_LE, PlyFormatType::BINARY_BE)) {
+    return "Unknown binary ply format for vertex element";
+  }
+
+  /* Read binary rows in blocks, and convert the rows of each block in parallel. */
+  const int block_rows_num = 64 * 1024;
+  Array<uint8_t> block(int64_t(std::min(block_rows_num, element.count)) * element.stride);
+  for (int block_start = 0; block_start < element.count; block_start += block_rows_num) {
+    const int rows_num = std::min(block_rows_num, element.count - block_start);
+    if (!file.read_bytes(block.data(), size_t(rows_num) * element.stride)) {
+      return "Could not read row of binary property";
+    }
+    threading::parallel_for(IndexRange(rows_num), 1024, [&](const IndexRange range) {
+      Array<float> value_vec(element.properties.size());
+      for (const int64_t row : range) {
+        decode_row_binary(header, element, block.data() + row * element.stride, value_vec);
+        store_vertex(block_start + int(row), value_vec);
+      }
+    });
   }
   return nullptr;
 }
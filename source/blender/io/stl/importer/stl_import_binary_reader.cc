@@ -12,6 +12,7 @@
 #include "BKE_mesh.hh"
 
 #include "BLI_array.hh"
+#include "BLI_vector.hh"
 
 #include "DNA_mesh_types.h"
 
@@ -36,15 +37,19 @@ Mesh *read_stl_binary(FILE *file, const bool use_custom_normals)
     return BKE_mesh_new_nomain(0, 0, 0, 0);
   }
 
+  /* Read all triangles first, so that their vertices can be merged in parallel. The triangle count
+   * is not used to allocate memory up-front, in case it is wrong. */
+  Vector<PackedTriangle> tris;
   Array<PackedTriangle> tris_buf(chunk_size);
-  STLMeshHelper stl_mesh(num_tris, use_custom_normals);
   size_t num_read_tris;
   while ((num_read_tris = fread(tris_buf.data(), sizeof(PackedTriangle), chunk_size, file))) {
-    for (size_t i = 0; i < num_read_tris; i++) {
-      stl_mesh.add_triangle(tris_buf[i]);
-    }
+    tris.extend(tris_buf.as_span().take_front(num_read_tris));
   }
 
+  /* No reservation, #STLMeshHelper::add_triangles allocates what it needs. */
+  STLMeshHelper stl_mesh(0, use_custom_normals);
+  stl_mesh.add_triangles(tris);
+
   return stl_mesh.to_mesh();
 }
 
@@ -8,8 +8,12 @@
 
 #include "BKE_mesh.hh"
 
+#include "BLI_array.hh"
 #include "BLI_array_utils.hh"
+#include "BLI_map.hh"
+#include "BLI_offset_indices.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "DNA_mesh_types.h"
 
@@ -39,6 +43,14 @@ bool STLMeshHelper::add_triangle(const PackedTriangle &data)
   int v1_id = verts_.index_of_or_add(data.vertices[0]);
   int v2_id = verts_.index_of_or_add(data.vertices[1]);
   int v3_id = verts_.index_of_or_add(data.vertices[2]);
+  return add_triangle_verts(v1_id, v2_id, v3_id, data.normal);
+}
+
+bool STLMeshHelper::add_triangle_verts(const int v1_id,
+                                       const int v2_id,
+                                       const int v3_id,
+                                       const float3 &normal)
+{
   if ((v1_id == v2_id) || (v1_id == v3_id) || (v2_id == v3_id)) {
     degenerate_tris_num_++;
     return false;
@@ -49,11 +61,89 @@ bool STLMeshHelper::add_triangle(const PackedTriangle &data)
   }
 
   if (use_custom_normals_) {
-    loop_normals_.append_n_times(data.normal, 3);
+    loop_normals_.append_n_times(normal, 3);
   }
   return true;
 }
 
+void STLMeshHelper::add_triangles(const Span<PackedTriangle> tris)
+{
+  BLI_assert(verts_.is_empty() && bulk_verts_.is_empty());
+  const int corners_num = tris.size() * 3;
+  tris_.reserve(tris.size());
+  if (use_custom_normals_) {
+    loop_normals_.reserve(corners_num);
+  }
+  auto corner_position = [&](const int corner) -> const float3 & {
+    return tris[corner / 3].vertices[corner % 3];
+  };
+
+  /* Partition corners by the hash of their position. Equal positions always end up in the same
+   * partition, so partitions can be merged independently of each other. */
+  constexpr int partitions_num = 64;
+  Array<uint8_t> corner_partition(corners_num);
+  threading::parallel_for(IndexRange(corners_num), 4096, [&](const IndexRange range) {
+    for (const int corner : range) {
+      const uint64_t hash = get_default_hash(corner_position(corner)) * 0x9E3779B97F4A7C15ull;
+      corner_partition[corner] = uint8_t(hash >> 58);
+    }
+  });
+
+  Array<int> partition_offsets_data(partitions_num + 1, 0);
+  for (const int corner : IndexRange(corners_num)) {
+    partition_offsets_data[corner_partition[corner]]++;
+  }
+  const OffsetIndices partition_offsets = offset_indices::accumulate_counts_to_offsets(
+      partition_offsets_data);
+
+  /* Corners of each partition, in file order. */
+  Array<int> partition_corners(corners_num);
+  {
+    Array<int> fill_indices(partition_offsets_data.as_span().drop_back(1));
+    for (const int corner : IndexRange(corners_num)) {
+      partition_corners[fill_indices[corner_partition[corner]]++] = corner;
+    }
+  }
+
+  /* Find the first corner with the same position for every corner. */
+  Array<int> corner_first(corners_num);
+  threading::parallel_for(IndexRange(partitions_num), 1, [&](const IndexRange range) {
+    for (const int partition : range) {
+      const Span<int> corners = partition_corners.as_span().slice(partition_offsets[partition]);
+      Map<float3, int> first_corners;
+      first_corners.reserve(corners.size());
+      for (const int corner : corners) {
+        corner_first[corner] = first_corners.lookup_or_add(corner_position(corner), corner);
+      }
+    }
+  });
+
+  /* Number vertices in order of their first corner, which gives the same order as merging them
+   * one triangle at a time. */
+  Array<int> corner_verts(corners_num);
+  int verts_num = 0;
+  for (const int corner : IndexRange(corners_num)) {
+    const int first = corner_first[corner];
+    corner_verts[corner] = (first == corner) ? verts_num++ : corner_verts[first];
+  }
+
+  bulk_verts_.resize(verts_num);
+  threading::parallel_for(IndexRange(corners_num), 4096, [&](const IndexRange range) {
+    for (const int corner : range) {
+      if (corner_first[corner] == corner) {
+        bulk_verts_[corner_verts[corner]] = corner_position(corner);
+      }
+    }
+  });
+
+  for (const int tri : tris.index_range()) {
+    add_triangle_verts(corner_verts[tri * 3],
+                       corner_verts[tri * 3 + 1],
+                       corner_verts[tri * 3 + 2],
+                       tris[tri].normal);
+  }
+}
+
 Mesh *STLMeshHelper::to_mesh()
 {
   if (degenerate_tris_num_ > 0) {
@@ -63,8 +153,9 @@ Mesh *STLMeshHelper::to_mesh()
     CLOG_WARN(&LOG, "Removed %d duplicate triangles during import", duplicate_tris_num_);
   }
 
-  Mesh *mesh = BKE_mesh_new_nomain(verts_.size(), 0, tris_.size(), tris_.size() * 3);
-  mesh->vert_positions_for_write().copy_from(verts_);
+  const Span<float3> verts = bulk_verts_.is_empty() ? verts_.as_span() : bulk_verts_.as_span();
+  Mesh *mesh = BKE_mesh_new_nomain(verts.size(), 0, tris_.size(), tris_.size() * 3);
+  mesh->vert_positions_for_write().copy_from(verts);
   offset_indices::fill_constant_group_size(3, 0, mesh->face_offsets_for_write());
   array_utils::copy(tris_.as_span().cast<int>(), mesh->corner_verts_for_write());
 
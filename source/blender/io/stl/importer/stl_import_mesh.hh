@@ -50,6 +50,8 @@ class Triangle {
 class STLMeshHelper {
  private:
   VectorSet<float3> verts_;
+  /** Vertex positions deduplicated by #add_triangles, used instead of #verts_. */
+  Vector<float3> bulk_verts_;
   VectorSet<Triangle> tris_;
   Vector<float3> loop_normals_;
   int degenerate_tris_num_;
@@ -64,7 +66,16 @@ class STLMeshHelper {
    */
   bool add_triangle(const PackedTriangle &data);
 
+  /* Creates new triangles with the same result as calling #add_triangle for each of them,
+   * vertex positions are merged in parallel. Can only be used once, on a helper created
+   * without reserved triangles, instead of #add_triangle.
+   */
+  void add_triangles(Span<PackedTriangle> tris);
+
   Mesh *to_mesh();
+
+ private:
+  bool add_triangle_verts(int v1_id, int v2_id, int v3_id, const float3 &normal);
 };
 
 }  // namespace blender::io::stl
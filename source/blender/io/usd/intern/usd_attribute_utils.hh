@@ -8,6 +8,7 @@
 #include "BLI_math_quaternion_types.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_virtual_array.hh"
 
 #include "BKE_attribute.hh"
@@ -178,9 +179,14 @@ void copy_blender_buffer_to_primvar(const VArray<BlenderT> &buffer,
     }
     else {
       usd_data.resize(data.size());
-      for (const int i : data.index_range()) {
-        usd_data[i] = detail::convert_value<BlenderT, USDT>(data[i]);
-      }
+      /* Write through a span, non-const element access of #VtArray checks for sharing every
+       * time. */
+      MutableSpan<USDT> dst(usd_data.data(), usd_data.size());
+      threading::parallel_for(data.index_range(), 4096, [&](const IndexRange range) {
+        for (const int64_t i : range) {
+          dst[i] = detail::convert_value<BlenderT, USDT>(data[i]);
+        }
+      });
     }
   }
 
@@ -231,13 +237,16 @@ void copy_primvar_to_blender_buffer(const pxr::UsdGeomPrimvar &primvar,
   else if (pv_interp == pxr::UsdGeomTokens->faceVarying) {
     if (!faces.is_empty()) {
       /* Reverse the index order. */
-      for (const int i : faces.index_range()) {
-        const IndexRange face = faces[i];
-        for (int j : face.index_range()) {
-          const int rev_index = face.last(j);
-          attribute[face.start() + j] = detail::convert_value<USDT, BlenderT>(usd_data[rev_index]);
+      threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+        for (const int i : range) {
+          const IndexRange face = faces[i];
+          for (int j : face.index_range()) {
+            const int rev_index = face.last(j);
+            attribute[face.start() + j] = detail::convert_value<USDT, BlenderT>(
+                usd_data[rev_index]);
+          }
         }
-      }
+      });
     }
     else {
       if constexpr (is_same || is_compatible) {
@@ -245,9 +254,11 @@ void copy_primvar_to_blender_buffer(const pxr::UsdGeomPrimvar &primvar,
         attribute.copy_from(src.template cast<BlenderT>());
       }
       else {
-        for (const int64_t i : attribute.index_range()) {
-          attribute[i] = detail::convert_value<USDT, BlenderT>(usd_data[i]);
-        }
+        threading::parallel_for(attribute.index_range(), 4096, [&](const IndexRange range) {
+          for (const int64_t i : range) {
+            attribute[i] = detail::convert_value<USDT, BlenderT>(usd_data[i]);
+          }
+        });
       }
     }
   }
@@ -259,9 +270,11 @@ void copy_primvar_to_blender_buffer(const pxr::UsdGeomPrimvar &primvar,
         attribute.copy_from(src.template cast<BlenderT>());
       }
       else {
-        for (const int64_t i : attribute.index_range()) {
-          attribute[i] = detail::convert_value<USDT, BlenderT>(usd_data[i]);
-        }
+        threading::parallel_for(attribute.index_range(), 4096, [&](const IndexRange range) {
+          for (const int64_t i : range) {
+            attribute[i] = detail::convert_value<USDT, BlenderT>(usd_data[i]);
+          }
+        });
       }
     }
   }
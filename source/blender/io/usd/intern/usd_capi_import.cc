@@ -24,6 +24,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_timeit.hh"
 
 #include "BLT_translation.hh"
@@ -270,6 +271,15 @@ static void import_startjob(void *customdata, wmJobWorkerStatus *worker_status)
     }
   }
 
+  /* Read prim data that doesn't need Main in parallel, object data is then read serially. */
+  threading::parallel_for(archive->readers().index_range(), 16, [&](const IndexRange range) {
+    for (const int64_t index : range) {
+      if (USDPrimReader *reader = archive->readers()[index]) {
+        reader->prefetch_object_data(0.0);
+      }
+    }
+  });
+
   /* Setup parenthood and read actual object data. */
   i = 0;
   for (USDPrimReader *reader : archive->readers()) {
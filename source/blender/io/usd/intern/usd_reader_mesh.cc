@@ -25,10 +25,12 @@
 #include "BKE_subdiv.hh"
 
 #include "BLI_array.hh"
+#include "BLI_array_utils.hh"
 #include "BLI_map.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_ordered_edge.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_vector_set.hh"
 
 #include "DNA_customdata_types.h"
@@ -223,11 +225,14 @@ void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
   USDXformReader::read_object_data(bmain, motionSampleTime);
 }
 
-bool USDMeshReader::topology_changed(const Mesh *existing_mesh, const double motionSampleTime)
+void USDMeshReader::prefetch_object_data(const double motionSampleTime)
 {
-  /* TODO(makowalski): Is it the best strategy to cache the mesh
-   * geometry in this function?  This needs to be revisited. */
+  read_topology_sample(motionSampleTime);
+  prefetched_sample_time_ = motionSampleTime;
+}
 
+void USDMeshReader::read_topology_sample(const double motionSampleTime)
+{
   mesh_prim_.GetFaceVertexIndicesAttr().Get(&face_indices_, motionSampleTime);
   mesh_prim_.GetFaceVertexCountsAttr().Get(&face_counts_, motionSampleTime);
   mesh_prim_.GetPointsAttr().Get(&positions_, motionSampleTime);
@@ -247,6 +252,19 @@ bool USDMeshReader::topology_changed(const Mesh *existing_mesh, const double mot
     mesh_prim_.GetNormalsAttr().Get(&normals_, motionSampleTime);
     normal_interpolation_ = mesh_prim_.GetNormalsInterpolation();
   }
+}
+
+bool USDMeshReader::topology_changed(const Mesh *existing_mesh, const double motionSampleTime)
+{
+  /* TODO(makowalski): Is it the best strategy to cache the mesh
+   * geometry in this function?  This needs to be revisited. */
+
+  if (prefetched_sample_time_ == motionSampleTime) {
+    prefetched_sample_time_.reset();
+  }
+  else {
+    read_topology_sample(motionSampleTime);
+  }
 
   return positions_.size() != existing_mesh->verts_num ||
          face_counts_.size() != existing_mesh->faces_num ||
@@ -329,29 +347,27 @@ void USDMeshReader::read_uv_data_primvar(Mesh *mesh,
     if (is_left_handed_) {
       /* Reverse the index order. */
       const OffsetIndices faces = mesh->faces();
-      for (const int i : faces.index_range()) {
-        const IndexRange face = faces[i];
-        for (int j : face.index_range()) {
-          const int rev_index = face.last(j);
-          uv_data.span[face.start() + j] = float2(usd_uvs[rev_index][0], usd_uvs[rev_index][1]);
+      threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+        for (const int i : range) {
+          const IndexRange face = faces[i];
+          for (int j : face.index_range()) {
+            const int rev_index = face.last(j);
+            uv_data.span[face.start() + j] = float2(usd_uvs[rev_index][0],
+                                                    usd_uvs[rev_index][1]);
+          }
         }
-      }
+      });
     }
     else {
-      for (int i = 0; i < uv_data.span.size(); ++i) {
-        uv_data.span[i] = float2(usd_uvs[i][0], usd_uvs[i][1]);
-      }
+      uv_data.span.copy_from(Span(usd_uvs.cdata(), usd_uvs.size()).cast<float2>());
     }
   }
   else {
     /* Handle vertex interpolation. */
     const Span<int> corner_verts = mesh->corner_verts();
     BLI_assert(mesh->verts_num == usd_uvs.size());
-    for (int i = 0; i < uv_data.span.size(); ++i) {
-      /* Get the vertex index for this corner. */
-      int vi = corner_verts[i];
-      uv_data.span[i] = float2(usd_uvs[vi][0], usd_uvs[vi][1]);
-    }
+    array_utils::gather(
+        Span(usd_uvs.cdata(), usd_uvs.size()).cast<float2>(), corner_verts, uv_data.span);
   }
 
   uv_data.finish();
@@ -579,22 +595,25 @@ void USDMeshReader::process_normals_face_varying(Mesh *mesh) const
   Array<float3> corner_normals(mesh->corners_num);
 
   const OffsetIndices faces = mesh->faces();
-  for (const int i : faces.index_range()) {
-    const IndexRange face = faces[i];
-    for (int j : face.index_range()) {
-      const int corner = face.start() + j;
-
-      int usd_index = face.start();
-      if (is_left_handed_) {
-        usd_index += face.size() - 1 - j;
-      }
-      else {
-        usd_index += j;
-      }
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const IndexRange face = faces[i];
+      for (int j : face.index_range()) {
+        const int corner = face.start() + j;
+
+        int usd_index = face.start();
+        if (is_left_handed_) {
+          usd_index += face.size() - 1 - j;
+        }
+        else {
+          usd_index += j;
+        }
 
-      corner_normals[corner] = detail::convert_value<pxr::GfVec3f, float3>(normals_[usd_index]);
+        corner_normals[corner] = detail::convert_value<pxr::GfVec3f, float3>(
+            normals_[usd_index]);
+      }
     }
-  }
+  });
 
   bke::mesh_set_custom_normals(*mesh, corner_normals);
 }
@@ -615,11 +634,12 @@ void USDMeshReader::process_normals_uniform(Mesh *mesh) const
   Array<float3> corner_normals(mesh->corners_num);
 
   const OffsetIndices faces = mesh->faces();
-  for (const int i : faces.index_range()) {
-    for (const int corner : faces[i]) {
-      corner_normals[corner] = detail::convert_value<pxr::GfVec3f, float3>(normals_[i]);
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      corner_normals.as_mutable_span().slice(faces[i]).fill(
+          detail::convert_value<pxr::GfVec3f, float3>(normals_[i]));
     }
-  }
+  });
 
   bke::mesh_set_custom_normals(*mesh, corner_normals);
 }
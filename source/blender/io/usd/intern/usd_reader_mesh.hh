@@ -13,6 +13,8 @@
 
 #include <pxr/usd/usdGeom/mesh.h>
 
+#include <optional>
+
 namespace blender::io::usd {
 
 class USDMeshReader : public USDGeomReader {
@@ -39,6 +41,9 @@ class USDMeshReader : public USDGeomReader {
    * implemented.  Note this will break if faces or positions vary. */
   bool is_initial_load_ = false;
 
+  /* Time of the topology sample read by #prefetch_object_data, that has not been used yet. */
+  std::optional<double> prefetched_sample_time_;
+
  public:
   USDMeshReader(const pxr::UsdPrim &prim,
                 const USDImportParams &import_params,
@@ -54,6 +59,7 @@ class USDMeshReader : public USDGeomReader {
 
   void create_object(Main *bmain) override;
   void read_object_data(Main *bmain, double motionSampleTime) override;
+  void prefetch_object_data(double motionSampleTime) override;
 
   void read_geometry(bke::GeometrySet &geometry_set,
                      USDMeshReadParams params,
@@ -81,6 +87,7 @@ class USDMeshReader : public USDGeomReader {
                                            MutableSpan<int> material_indices,
                                            blender::Map<pxr::SdfPath, int> *r_mat_map);
 
+  void read_topology_sample(double motionSampleTime);
   void read_mpolys(Mesh *mesh) const;
   void read_subdiv();
   void read_vertex_creases(Mesh *mesh, double motionSampleTime);
@@ -97,6 +97,12 @@ class USDPrimReader {
   virtual void create_object(Main *bmain) = 0;
   virtual void read_object_data(Main * /*bmain*/, double /*motionSampleTime*/){};
 
+  /**
+   * Read data from the stage ahead of #read_object_data, without touching Main.
+   * Called for many readers in parallel, since USD supports concurrent reads of the stage.
+   */
+  virtual void prefetch_object_data(double /*motionSampleTime*/) {}
+
   Object *object() const;
   void object(Object *ob);
 
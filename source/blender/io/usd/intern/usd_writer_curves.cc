@@ -23,6 +23,7 @@
 #include "BLI_generic_virtual_array.hh"
 #include "BLI_set.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_virtual_array.hh"
 
 #include "BKE_anonymous_attribute_id.hh"
@@ -80,9 +81,12 @@ static void populate_curve_widths(const bke::CurvesGeometry &curves, pxr::VtArra
   const VArray<float> radii = curves.radius();
 
   widths.resize(radii.size());
-  for (const int i : radii.index_range()) {
-    widths[i] = radii[i] * 2.0f;
-  }
+  MutableSpan<float> dst(widths.data(), widths.size());
+  threading::parallel_for(radii.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      dst[i] = radii[i] * 2.0f;
+    }
+  });
 }
 
 static pxr::TfToken get_curve_width_interpolation(const pxr::VtArray<float> &widths,
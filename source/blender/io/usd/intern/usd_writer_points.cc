@@ -10,6 +10,8 @@
 #include "BKE_attribute.hh"
 #include "BKE_report.hh"
 
+#include "BLI_task.hh"
+
 #include "DNA_pointcloud_types.h"
 
 #include <pxr/base/vt/array.h>
@@ -42,9 +44,12 @@ void USDPointsWriter::do_write(HierarchyContext &context)
   if (!radii.is_empty()) {
     pxr::VtArray<float> usd_widths;
     usd_widths.resize(radii.size());
-    for (const int i : radii.index_range()) {
-      usd_widths[i] = radii[i] * 2.0f;
-    }
+    MutableSpan<float> dst(usd_widths.data(), usd_widths.size());
+    threading::parallel_for(radii.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        dst[i] = radii[i] * 2.0f;
+      }
+    });
 
     pxr::UsdAttribute attr_widths = usd_points.CreateWidthsAttr(pxr::VtValue(), true);
     if (!attr_widths.HasValue()) {
@@ -14,6 +14,7 @@
 #include "BLI_math_vector_types.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "IO_string_utils.hh"
@@ -22,6 +23,7 @@
 #include "obj_import_file_reader.hh"
 
 #include <algorithm>
+#include <atomic>
 #include <charconv>
 
 #include "CLG_log.h"
@@ -74,29 +76,51 @@ static Geometry *create_geometry(Geometry *const prev_geometry,
   return new_geometry();
 }
 
-static void geom_add_vertex(const char *p, const char *end, GlobalVertices &r_global_vertices)
+/**
+ * Add the vertices of a run of consecutive `v` lines, given without their keyword.
+ * Lines are independent of each other, so positions are parsed in parallel.
+ */
+static void geom_add_vertices(Span<StringRef> lines, GlobalVertices &r_global_vertices)
 {
   r_global_vertices.flush_mrgb_block();
-  float3 vert;
-  p = parse_floats(p, end, 0.0f, vert, 3);
-  r_global_vertices.vertices.append(vert);
+  const int64_t start = r_global_vertices.vertices.size();
+  r_global_vertices.vertices.resize(start + lines.size());
+  MutableSpan<float3> verts = r_global_vertices.vertices.as_mutable_span().drop_front(start);
   /* OBJ extension: `xyzrgb` vertex colors, when the vertex position
    * is followed by 3 more RGB color components. See
    * http://paulbourke.net/dataformats/obj/colour.html */
-  if (p < end) {
-    float3 srgb;
-    p = parse_floats(p, end, -1.0f, srgb, 3);
+  Array<float3> srgb_colors(lines.size());
+  std::atomic<bool> has_colors = false;
+  threading::parallel_for(lines.index_range(), 4096, [&](const IndexRange range) {
+    bool range_has_colors = false;
+    for (const int64_t i : range) {
+      const char *p = lines[i].begin(), *end = lines[i].end();
+      p = parse_floats(p, end, 0.0f, verts[i], 3);
+      srgb_colors[i] = float3(-1.0f);
+      if (p < end) {
+        parse_floats(p, end, -1.0f, srgb_colors[i], 3);
+        range_has_colors = true;
+      }
+    }
+    if (range_has_colors) {
+      has_colors.store(true, std::memory_order_relaxed);
+    }
+  });
+  if (!has_colors) {
+    return;
+  }
+  for (const int64_t i : lines.index_range()) {
+    const float3 &srgb = srgb_colors[i];
     if (srgb.x >= 0 && srgb.y >= 0 && srgb.z >= 0) {
       float3 linear;
       srgb_to_linearrgb_v3_v3(linear, srgb);
-      r_global_vertices.set_vertex_color(r_global_vertices.vertices.size() - 1, linear);
+      r_global_vertices.set_vertex_color(start + i, linear);
     }
     else if (srgb.x > 0) {
       /* Treats value in srgb.x as weight. */
-      r_global_vertices.set_vertex_weight(r_global_vertices.vertices.size() - 1, srgb.x);
+      r_global_vertices.set_vertex_weight(start + i, srgb.x);
     }
   }
-  UNUSED_VARS(p);
 }
 
 static void geom_add_mrgb_colors(const char *p, const char *end, GlobalVertices &r_global_vertices)
@@ -126,24 +150,34 @@ static void geom_add_mrgb_colors(const char *p, const char *end, GlobalVertices
   }
 }
 
-static void geom_add_vertex_normal(const char *p,
-                                   const char *end,
-                                   GlobalVertices &r_global_vertices)
+static void geom_add_vertex_normals(Span<StringRef> lines, GlobalVertices &r_global_vertices)
 {
-  float3 normal;
-  parse_floats(p, end, 0.0f, normal, 3);
-  /* Normals can be printed with only several digits in the file,
-   * making them ever-so-slightly non unit length. Make sure they are
-   * normalized. */
-  normalize_v3(normal);
-  r_global_vertices.vert_normals.append(normal);
+  const int64_t start = r_global_vertices.vert_normals.size();
+  r_global_vertices.vert_normals.resize(start + lines.size());
+  MutableSpan<float3> normals = r_global_vertices.vert_normals.as_mutable_span().drop_front(start);
+  threading::parallel_for(lines.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      float3 normal;
+      parse_floats(lines[i].begin(), lines[i].end(), 0.0f, normal, 3);
+      /* Normals can be printed with only several digits in the file,
+       * making them ever-so-slightly non unit length. Make sure they are
+       * normalized. */
+      normalize_v3(normal);
+      normals[i] = normal;
+    }
+  });
 }
 
-static void geom_add_uv_vertex(const char *p, const char *end, GlobalVertices &r_global_vertices)
+static void geom_add_uv_vertices(Span<StringRef> lines, GlobalVertices &r_global_vertices)
 {
-  float2 uv;
-  parse_floats(p, end, 0.0f, uv, 2);
-  r_global_vertices.uv_vertices.append(uv);
+  const int64_t start = r_global_vertices.uv_vertices.size();
+  r_global_vertices.uv_vertices.resize(start + lines.size());
+  MutableSpan<float2> uvs = r_global_vertices.uv_vertices.as_mutable_span().drop_front(start);
+  threading::parallel_for(lines.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      parse_floats(lines[i].begin(), lines[i].end(), 0.0f, uvs[i], 2);
+    }
+  });
 }
 
 /**
@@ -468,6 +502,31 @@ static bool parse_keyword(const char *&p, const char *end, StringRef keyword)
   return true;
 }
 
+/**
+ * Gather a run of consecutive lines starting with the same keyword, the first one of which has
+ * already been read. The lines are stored without their keyword and consumed from the buffer.
+ */
+static void gather_keyword_lines(StringRef &buffer_str,
+                                 StringRef keyword,
+                                 StringRef first_line,
+                                 Vector<StringRef> &r_lines,
+                                 size_t &r_line_number)
+{
+  r_lines.clear();
+  r_lines.append(first_line);
+  while (!buffer_str.is_empty()) {
+    StringRef remaining = buffer_str;
+    const StringRef line = read_next_line(remaining);
+    const char *p = drop_whitespace(line.begin(), line.end());
+    if (!parse_keyword(p, line.end(), keyword)) {
+      break;
+    }
+    r_lines.append(StringRef(p, line.end()));
+    buffer_str = remaining;
+    ++r_line_number;
+  }
+}
+
 /* Special case: if there were no faces/edges in any geometries,
  * treat all the vertices as a point cloud. */
 static void use_all_vertices_if_no_faces(Geometry *geom,
@@ -512,6 +571,7 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
 
   size_t buffer_offset = 0;
   size_t line_number = 0;
+  Vector<StringRef> vertex_lines;
   while (true) {
     /* Read a chunk of input from the file. */
     size_t bytes_read = fread(buffer.data() + buffer_offset, 1, read_buffer_size_, obj_file_);
@@ -569,13 +629,16 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
       /* Most common things that start with 'v': vertices, normals, UVs. */
       if (*p == 'v') {
         if (parse_keyword(p, end, "v")) {
-          geom_add_vertex(p, end, r_global_vertices);
+          gather_keyword_lines(buffer_str, "v", StringRef(p, end), vertex_lines, line_number);
+          geom_add_vertices(vertex_lines, r_global_vertices);
         }
         else if (parse_keyword(p, end, "vn")) {
-          geom_add_vertex_normal(p, end, r_global_vertices);
+          gather_keyword_lines(buffer_str, "vn", StringRef(p, end), vertex_lines, line_number);
+          geom_add_vertex_normals(vertex_lines, r_global_vertices);
         }
         else if (parse_keyword(p, end, "vt")) {
-          geom_add_uv_vertex(p, end, r_global_vertices);
+          gather_keyword_lines(buffer_str, "vt", StringRef(p, end), vertex_lines, line_number);
+          geom_add_uv_vertices(vertex_lines, r_global_vertices);
         }
       }
       /* Faces. */
@@ -21,6 +21,11 @@
 
 #include <fmt/format.h>
 
+#ifdef WITH_TBB
+#  include <tbb/blocked_range.h>
+#  include <tbb/parallel_for.h>
+#endif
+
 #include "MEM_guardedalloc.h" /* for MEM_freeN MEM_mallocN MEM_callocN */
 
 #include "BLI_endian_switch.h"
@@ -1219,6 +1224,9 @@ struct DNA_ReconstructInfo {
   ReconstructStep **steps;
 };
 
+/** Approximate amount of converted bytes per task when reconstructing arrays of structs. */
+#define DNA_RECONSTRUCT_PARALLEL_GRAIN_BYTES (1 << 18)
+
 static void reconstruct_structs(const DNA_ReconstructInfo *reconstruct_info,
                                 const int blocks,
                                 const int old_struct_index,
@@ -1301,6 +1309,17 @@ static void reconstruct_structs(const DNA_ReconstructInfo *reconstruct_info,
   const int old_block_size = reconstruct_info->oldsdna->types_size[old_struct->type_index];
   const int new_block_size = reconstruct_info->newsdna->types_size[new_struct->type_index];
 
+  /* When the layout did not change, the whole array can be copied at once. */
+  const ReconstructStep *steps = reconstruct_info->steps[new_struct_index];
+  if (reconstruct_info->step_counts[new_struct_index] == 1 &&
+      steps[0].type == RECONSTRUCT_STEP_MEMCPY && old_block_size == new_block_size &&
+      steps[0].data.memcpy.old_offset == 0 && steps[0].data.memcpy.new_offset == 0 &&
+      steps[0].data.memcpy.size == new_block_size)
+  {
+    memcpy(new_blocks, old_blocks, size_t(blocks) * size_t(new_block_size));
+    return;
+  }
+
   for (int a = 0; a < blocks; a++) {
     const char *old_block = old_blocks + a * old_block_size;
     char *new_block = new_blocks + a * new_block_size;
@@ -1331,6 +1350,27 @@ void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
   const int alignment = DNA_struct_alignment(newsdna, new_struct_index);
   char *new_blocks = static_cast<char *>(
       MEM_calloc_arrayN_aligned(new_block_size, blocks, alignment, alloc_name));
+
+#ifdef WITH_TBB
+  /* Large arrays of structs (e.g. legacy mesh data) are converted in parallel. This file is also
+   * used by `makesrna` which does not link the full blenlib, so TBB is used directly. */
+  const int old_block_size = oldsdna->types_size[old_struct->type_index];
+  const int grain_size = std::max(1, DNA_RECONSTRUCT_PARALLEL_GRAIN_BYTES / new_block_size);
+  if (blocks > grain_size) {
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, blocks, grain_size), [&](const tbb::blocked_range<int> &range) {
+          reconstruct_structs(reconstruct_info,
+                              range.size(),
+                              old_struct_index,
+                              new_struct_index,
+                              static_cast<const char *>(old_blocks) +
+                                  int64_t(range.begin()) * old_block_size,
+                              new_blocks + int64_t(range.begin()) * new_block_size);
+        });
+    return new_blocks;
+  }
+#endif
+
   reconstruct_structs(reconstruct_info,
                       blocks,
                       old_struct_index,
@@ -403,6 +403,13 @@ void RNA_def_property_collection_sdna(PropertyRNA *prop,
                                       const char *structname,
                                       const char *propname,
                                       const char *lengthpropname);
+/**
+ * Let `foreach_get` / `foreach_set` copy the DNA member of an int or float property directly,
+ * even though it defines custom accessors. Only valid when the accessors just copy the value
+ * (plus side effects that the owning collection's update function takes care of), because raw
+ * access bypasses them.
+ */
+void RNA_def_property_raw_access(PropertyRNA *prop);
 
 void RNA_def_property_flag(PropertyRNA *prop, PropertyFlag flag);
 void RNA_def_property_clear_flag(PropertyRNA *prop, PropertyFlag flag);
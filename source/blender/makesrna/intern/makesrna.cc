@@ -2111,7 +2111,7 @@ static void rna_def_property_funcs(FILE *f, StructRNA *srna, PropertyDefRNA *dp)
       }
 
       if (!prop->arraydimension) {
-        if (!iprop->get && !iprop->set) {
+        if ((!iprop->get && !iprop->set) || dp->raw_access) {
           rna_set_raw_property(dp, prop);
         }
 
@@ -2121,7 +2121,7 @@ static void rna_def_property_funcs(FILE *f, StructRNA *srna, PropertyDefRNA *dp)
             rna_def_property_set_func(f, srna, prop, dp, (const char *)iprop->set));
       }
       else {
-        if (!iprop->getarray && !iprop->setarray) {
+        if ((!iprop->getarray && !iprop->setarray) || dp->raw_access) {
           rna_set_raw_property(dp, prop);
         }
 
@@ -2156,7 +2156,7 @@ static void rna_def_property_funcs(FILE *f, StructRNA *srna, PropertyDefRNA *dp)
       }
 
       if (!prop->arraydimension) {
-        if (!fprop->get && !fprop->set) {
+        if ((!fprop->get && !fprop->set) || dp->raw_access) {
           rna_set_raw_property(dp, prop);
         }
 
@@ -2166,7 +2166,7 @@ static void rna_def_property_funcs(FILE *f, StructRNA *srna, PropertyDefRNA *dp)
             rna_def_property_set_func(f, srna, prop, dp, (const char *)fprop->set));
       }
       else {
-        if (!fprop->getarray && !fprop->setarray) {
+        if ((!fprop->getarray && !fprop->setarray) || dp->raw_access) {
           rna_set_raw_property(dp, prop);
         }
 
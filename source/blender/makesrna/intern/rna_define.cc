@@ -3032,6 +3032,35 @@ void RNA_def_property_collection_sdna(PropertyRNA *prop,
   }
 }
 
+void RNA_def_property_raw_access(PropertyRNA *prop)
+{
+  StructRNA *srna = DefRNA.laststruct;
+
+  if (!DefRNA.preprocess) {
+    CLOG_ERROR(&LOG, "only during preprocessing.");
+    return;
+  }
+
+  if (!ELEM(prop->type, PROP_INT, PROP_FLOAT)) {
+    CLOG_ERROR(
+        &LOG, "\"%s.%s\", type is not int or float.", srna->identifier, prop->identifier);
+    DefRNA.error = true;
+    return;
+  }
+
+  PropertyDefRNA *dp = rna_find_struct_property_def(srna, prop);
+  if (!dp || !dp->dnaname) {
+    CLOG_ERROR(&LOG,
+               "\"%s.%s\", raw access needs a DNA member to be defined first.",
+               srna->identifier,
+               prop->identifier);
+    DefRNA.error = true;
+    return;
+  }
+
+  dp->raw_access = true;
+}
+
 void RNA_def_property_translation_context(PropertyRNA *prop, const char *context)
 {
   prop->translation_context = context ? context : BLT_I18NCONTEXT_DEFAULT_BPYRNA;
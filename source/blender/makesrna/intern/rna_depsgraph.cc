@@ -280,6 +280,16 @@ static void rna_Depsgraph_debug_stats_gnuplot(Depsgraph *depsgraph,
   fclose(f);
 }
 
+static void rna_Depsgraph_debug_eval_trace_json(Depsgraph *depsgraph, const char *filepath)
+{
+  FILE *f = fopen(filepath, "w");
+  if (f == nullptr) {
+    return;
+  }
+  DEG_debug_eval_trace_json(depsgraph, f);
+  fclose(f);
+}
+
 static void rna_Depsgraph_debug_tag_update(Depsgraph *depsgraph)
 {
   DEG_graph_tag_relations_update(depsgraph);
@@ -730,6 +740,15 @@ static void rna_def_depsgraph(BlenderRNA *brna)
                                   "File name where gnuplot script will save the result");
   RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
 
+  func = RNA_def_function(srna, "debug_eval_trace_json", "rna_Depsgraph_debug_eval_trace_json");
+  RNA_def_function_ui_description(
+      func,
+      "Write the timeline of the last evaluation in the Chrome trace event format "
+      "(only available when depsgraph time debugging is enabled)");
+  parm = RNA_def_string_file_path(
+      func, "filepath", nullptr, FILE_MAX, "File Name", "Output path for the trace file");
+  RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
+
   func = RNA_def_function(srna, "debug_tag_update", "rna_Depsgraph_debug_tag_update");
 
   func = RNA_def_function(srna, "debug_stats", "rna_Depsgraph_debug_stats");
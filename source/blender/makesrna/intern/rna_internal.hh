@@ -81,6 +81,10 @@ struct PropertyDefRNA {
   /* not to be confused with PROP_ENUM_FLAG
    * this only allows one of the flags to be set at a time, clearing all others */
   int enumbitflags;
+
+  /** Allow raw access to the DNA member even though the property has custom accessors,
+   * see #RNA_def_property_raw_access. */
+  bool raw_access;
 };
 
 struct StructDefRNA {
@@ -269,6 +269,17 @@ static void rna_Mesh_update_positions_tag(Main *bmain, Scene *scene, PointerRNA
   rna_Mesh_update_data_legacy_deg_tag_all(bmain, scene, ptr);
 }
 
+/**
+ * Bulk writes with `foreach_set` copy vertex positions directly (see #MeshVertex.co), without
+ * calling #rna_MeshVertex_co_set for every vertex. Tag the change once for the whole array.
+ */
+static void rna_Mesh_update_vertices_tag(Main *bmain, Scene *scene, PointerRNA *ptr)
+{
+  Mesh *mesh = rna_mesh(ptr);
+  mesh->tag_positions_changed();
+  rna_Mesh_update_data_legacy_deg_tag_all(bmain, scene, ptr);
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -2027,13 +2038,18 @@ static void rna_def_mvert(BlenderRNA *brna)
   PropertyRNA *prop;
 
   srna = RNA_def_struct(brna, "MeshVertex", nullptr);
+  RNA_def_struct_sdna(srna, "vec3f");
   RNA_def_struct_ui_text(srna, "Mesh Vertex", "Vertex in a Mesh data-block");
   RNA_def_struct_path_func(srna, "rna_MeshVertex_path");
   RNA_def_struct_ui_icon(srna, ICON_VERTEXSEL);
 
   prop = RNA_def_property(srna, "co", PROP_FLOAT, PROP_TRANSLATION);
+  RNA_def_property_float_sdna(prop, nullptr, "x");
   RNA_def_property_array(prop, 3);
   RNA_def_property_float_funcs(prop, "rna_MeshVertex_co_get", "rna_MeshVertex_co_set", nullptr);
+  /* Vertices point directly into the position array, so `foreach_get` / `foreach_set` can copy
+   * all positions at once. The vertices collection update tags the change afterwards. */
+  RNA_def_property_raw_access(prop);
   RNA_def_property_ui_text(prop, "Position", "");
   RNA_def_property_update(prop, 0, "rna_Mesh_update_positions_tag");
 
@@ -2933,6 +2949,7 @@ static void rna_def_mesh(BlenderRNA *brna)
   RNA_def_property_struct_type(prop, "MeshVertex");
   RNA_def_property_override_flag(prop, PROPOVERRIDE_IGNORE);
   RNA_def_property_ui_text(prop, "Vertices", "Vertices of the mesh");
+  RNA_def_property_update(prop, 0, "rna_Mesh_update_vertices_tag");
   rna_def_mesh_vertices(brna, prop);
 
   prop = RNA_def_property(srna, "edges", PROP_COLLECTION, PROP_NONE);
@@ -327,6 +327,11 @@ VArray<float> get_influence_vertex_weights(const bke::CurvesGeometry &curves,
       influence_data.vertex_group_name, bke::AttrDomain::Point, 0.0f);
 
   if (influence_data.flag & GREASE_PENCIL_INFLUENCE_INVERT_VERTEX_GROUP) {
+    if (influence_weights.is_single()) {
+      /* Common for drawings that don't have the vertex group, avoid allocating an array. */
+      return VArray<float>::ForSingle(1.0f - influence_weights.get_internal_single(),
+                                      curves.point_num);
+    }
     Array<float> influence_weights_inverted(influence_weights.size());
     threading::parallel_for(
         influence_weights_inverted.index_range(), 8192, [&](const IndexRange range) {
@@ -8,6 +8,8 @@
 
 #include <cstring>
 
+#include "BLI_array.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.hh"
@@ -15,6 +17,7 @@
 #include "DNA_defaults.h"
 #include "DNA_screen_types.h"
 
+#include "BKE_attribute.hh"
 #include "BKE_mesh.hh"
 #include "BKE_modifier.hh"
 
@@ -23,11 +26,13 @@
 
 #include "RNA_prototypes.hh"
 
-#include "bmesh.hh"
-#include "bmesh_tools.hh"
+#include "GEO_mesh_triangulate.hh"
 
 #include "MOD_ui_common.hh"
 
+/** Temporary attribute used to keep custom normals through triangulation. */
+static constexpr blender::StringRef keep_normals_attribute_name = ".triangulate_corner_normals";
+
 static Mesh *triangulate_mesh(Mesh *mesh,
                               const int quad_method,
                               const int ngon_method,
@@ -35,46 +40,48 @@ static Mesh *triangulate_mesh(Mesh *mesh,
                               const int flag)
 {
   using namespace blender;
-  Mesh *result;
-  BMesh *bm;
-  CustomData_MeshMasks cd_mask_extra{};
-  cd_mask_extra.vmask = CD_MASK_ORIGINDEX;
-  cd_mask_extra.emask = CD_MASK_ORIGINDEX;
-  cd_mask_extra.pmask = CD_MASK_ORIGINDEX;
+  const OffsetIndices faces = mesh->faces();
+  IndexMaskMemory memory;
+  const IndexMask selection = IndexMask::from_predicate(
+      faces.index_range(), GrainSize(4096), memory, [&](const int i) {
+        const int face_size = faces[i].size();
+        return face_size > 3 && face_size >= min_vertices;
+      });
+  if (selection.is_empty()) {
+    return nullptr;
+  }
 
-  bool keep_clnors = (flag & MOD_TRIANGULATE_KEEP_CUSTOMLOOP_NORMALS) != 0;
+  const bool keep_clnors = (flag & MOD_TRIANGULATE_KEEP_CUSTOMLOOP_NORMALS) != 0;
 
   if (keep_clnors) {
-    void *data = CustomData_add_layer(
-        &mesh->corner_data, CD_NORMAL, CD_CONSTRUCT, mesh->corners_num);
-    memcpy(data, mesh->corner_normals().data(), mesh->corner_normals().size_in_bytes());
-    cd_mask_extra.lmask |= CD_MASK_NORMAL;
+    /* Custom normals are stored relative to the face corner spaces, which change with the new
+     * topology. Store the final normals and set them again afterwards instead. */
+    bke::MutableAttributeAccessor attributes = mesh->attributes_for_write();
+    attributes.add<float3>(keep_normals_attribute_name,
+                           bke::AttrDomain::Corner,
+                           bke::AttributeInitVArray(VArray<float3>::ForSpan(
+                               mesh->corner_normals())));
   }
 
-  BMeshCreateParams bmesh_create_params{};
-  BMeshFromMeshParams bmesh_from_mesh_params{};
-  bmesh_from_mesh_params.calc_face_normal = true;
-  bmesh_from_mesh_params.calc_vert_normal = false;
-  bmesh_from_mesh_params.cd_mask_extra = cd_mask_extra;
-
-  bm = BKE_mesh_to_bmesh_ex(mesh, &bmesh_create_params, &bmesh_from_mesh_params);
-
-  BM_mesh_triangulate(
-      bm, quad_method, ngon_method, min_vertices, false, nullptr, nullptr, nullptr);
-
-  result = BKE_mesh_from_bmesh_for_eval_nomain(bm, &cd_mask_extra, mesh);
-  BM_mesh_free(bm);
+  std::optional<Mesh *> result = geometry::mesh_triangulate(
+      *mesh,
+      selection,
+      geometry::TriangulateNGonMode(ngon_method),
+      geometry::TriangulateQuadMode(quad_method),
+      {});
 
   if (keep_clnors) {
-    bke::mesh_set_custom_normals_normalized(
-        *result,
-        {static_cast<float3 *>(
-             CustomData_get_layer_for_write(&result->corner_data, CD_NORMAL, result->corners_num)),
-         result->corners_num});
-    CustomData_free_layers(&result->corner_data, CD_NORMAL);
+    mesh->attributes_for_write().remove(keep_normals_attribute_name);
+    if (result) {
+      bke::MutableAttributeAccessor attributes = (*result)->attributes_for_write();
+      Array<float3> corner_normals((*result)->corners_num);
+      attributes.lookup<float3>(keep_normals_attribute_name).varray.materialize(corner_normals);
+      attributes.remove(keep_normals_attribute_name);
+      bke::mesh_set_custom_normals_normalized(**result, corner_normals);
+    }
   }
 
-  return result;
+  return result.value_or(nullptr);
 }
 
 static void init_data(ModifierData *md)
@@ -180,6 +180,13 @@ class GeometryInfoLog : public ValueLog {
   std::optional<VolumeInfo> volume_info;
   std::optional<GridInfo> grid_info;
 
+  /**
+   * Estimated memory used by the geometry. Data that is shared with other geometries is counted
+   * as well, so this is the memory that is kept alive by the geometry rather than memory that
+   * would be freed when the geometry is freed.
+   */
+  int64_t memory_bytes = 0;
+
   GeometryInfoLog(const bke::GeometrySet &geometry_set);
   GeometryInfoLog(const bke::GVolumeGrid &grid);
 };
@@ -16,6 +16,7 @@
 
 #include "BLI_assert.h"
 #include "BLI_listbase.h"
+#include "BLI_map.hh"
 #include "BLI_math_vector.h"
 #include "BLI_math_vector_types.hh"
 #include "BLI_string.h"
@@ -456,6 +457,14 @@ class BaseCryptoMatteOperation : public NodeOperation {
       return matte;
     }
 
+    /* Count how often each identifier is selected, such that the identifiers of the ranks of each
+     * pixel can be looked up directly instead of being compared to every selected identifier,
+     * which is slow when many entities are selected. */
+    Map<float, int> identifier_selection_counts;
+    for (const float identifier : identifiers) {
+      identifier_selection_counts.lookup_or_add(identifier, 0)++;
+    }
+
     const int2 lower_bound = this->get_layers_lower_bound();
     for (const Result &layer_result : layers) {
       /* Loops over all identifiers selected by the user, and accumulate the coverage of ranks
@@ -481,16 +490,14 @@ class BaseCryptoMatteOperation : public NodeOperation {
         float identifier_of_second_rank = second_rank.x;
         float coverage_of_second_rank = second_rank.y;
 
-        /* Loop over all identifiers selected by the user, if the identifier of either of the ranks
-         * match it, accumulate its coverage. */
+        /* If the identifier of either of the ranks was selected by the user, accumulate its
+         * coverage once for every time it was selected. */
         float total_coverage = 0.0f;
-        for (const float &identifier : identifiers) {
-          if (identifier_of_first_rank == identifier) {
-            total_coverage += coverage_of_first_rank;
-          }
-          if (identifier_of_second_rank == identifier) {
-            total_coverage += coverage_of_second_rank;
-          }
+        if (const int *count = identifier_selection_counts.lookup_ptr(identifier_of_first_rank)) {
+          total_coverage += coverage_of_first_rank * *count;
+        }
+        if (const int *count = identifier_selection_counts.lookup_ptr(identifier_of_second_rank)) {
+          total_coverage += coverage_of_second_rank * *count;
         }
 
         /* Add the total coverage to the coverage accumulated by previous layers. */
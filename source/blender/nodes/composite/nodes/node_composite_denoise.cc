@@ -126,9 +126,7 @@ class DenoiseOperation : public NodeOperation {
     output_image.allocate_texture(input_image.domain());
 
 #ifdef WITH_OPENIMAGEDENOISE
-    oidn::DeviceRef device = oidn::newDevice(oidn::DeviceType::CPU);
-    device.set("setAffinity", false);
-    device.commit();
+    oidn::DeviceRef &device = this->context().cache_manager().oidn_device.get();
 
     const int width = input_image.domain().size.x;
     const int height = input_image.domain().size.y;
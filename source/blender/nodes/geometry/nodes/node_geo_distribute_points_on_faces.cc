@@ -114,40 +114,69 @@ static void sample_mesh_surface(const Mesh &mesh,
   const Span<int> corner_verts = mesh.corner_verts();
   const Span<int3> corner_tris = mesh.corner_tris();
 
-  for (const int tri_i : corner_tris.index_range()) {
+  /* Every triangle has its own random number generator, so the triangles can be processed in
+   * parallel. The number of points per triangle is computed first to find where the points of
+   * each triangle are stored, which keeps the output order independent of the threading. */
+  auto triangle_rng_and_points_num = [&](const int tri_i, RandomNumberGenerator &r_rng) {
     const int3 &tri = corner_tris[tri_i];
-    const int v0_loop = tri[0];
-    const int v1_loop = tri[1];
-    const int v2_loop = tri[2];
-    const float3 &v0_pos = positions[corner_verts[v0_loop]];
-    const float3 &v1_pos = positions[corner_verts[v1_loop]];
-    const float3 &v2_pos = positions[corner_verts[v2_loop]];
+    const float3 &v0_pos = positions[corner_verts[tri[0]]];
+    const float3 &v1_pos = positions[corner_verts[tri[1]]];
+    const float3 &v2_pos = positions[corner_verts[tri[2]]];
 
     float corner_tri_density_factor = 1.0f;
     if (!density_factors.is_empty()) {
-      const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
-      const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
-      const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
+      const float v0_density_factor = std::max(0.0f, density_factors[tri[0]]);
+      const float v1_density_factor = std::max(0.0f, density_factors[tri[1]]);
+      const float v2_density_factor = std::max(0.0f, density_factors[tri[2]]);
       corner_tri_density_factor = (v0_density_factor + v1_density_factor + v2_density_factor) /
                                   3.0f;
     }
     const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
 
     const int corner_tri_seed = noise::hash(tri_i, seed);
-    RandomNumberGenerator corner_tri_rng(corner_tri_seed);
-
-    const int point_amount = corner_tri_rng.round_probabilistic(area * base_density *
-                                                                corner_tri_density_factor);
-
-    for (int i = 0; i < point_amount; i++) {
-      const float3 bary_coord = corner_tri_rng.get_barycentric_coordinates();
-      float3 point_pos;
-      interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
-      r_positions.append(point_pos);
-      r_bary_coords.append(bary_coord);
-      r_tri_indices.append(tri_i);
+    r_rng = RandomNumberGenerator(corner_tri_seed);
+
+    return r_rng.round_probabilistic(area * base_density * corner_tri_density_factor);
+  };
+
+  Array<int> point_offsets_data(corner_tris.size() + 1);
+  threading::parallel_for(corner_tris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int tri_i : range) {
+      RandomNumberGenerator corner_tri_rng;
+      point_offsets_data[tri_i] = triangle_rng_and_points_num(tri_i, corner_tri_rng);
     }
-  }
+  });
+  const OffsetIndices<int> point_offsets = offset_indices::accumulate_counts_to_offsets(
+      point_offsets_data);
+
+  const int start = r_positions.size();
+  r_positions.resize(start + point_offsets.total_size());
+  r_bary_coords.resize(start + point_offsets.total_size());
+  r_tri_indices.resize(start + point_offsets.total_size());
+
+  threading::parallel_for(corner_tris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int tri_i : range) {
+      const IndexRange points = point_offsets[tri_i].shift(start);
+      if (points.is_empty()) {
+        continue;
+      }
+      RandomNumberGenerator corner_tri_rng;
+      triangle_rng_and_points_num(tri_i, corner_tri_rng);
+
+      const int3 &tri = corner_tris[tri_i];
+      const float3 &v0_pos = positions[corner_verts[tri[0]]];
+      const float3 &v1_pos = positions[corner_verts[tri[1]]];
+      const float3 &v2_pos = positions[corner_verts[tri[2]]];
+      for (const int i : points) {
+        const float3 bary_coord = corner_tri_rng.get_barycentric_coordinates();
+        float3 point_pos;
+        interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
+        r_positions[i] = point_pos;
+        r_bary_coords[i] = bary_coord;
+        r_tri_indices[i] = tri_i;
+      }
+    }
+  });
 }
 
 BLI_NOINLINE static KDTree_3d *build_kdtree(Span<float3> positions)
@@ -207,26 +236,29 @@ BLI_NOINLINE static void update_elimination_mask_based_on_density_factors(
     const MutableSpan<bool> elimination_mask)
 {
   const Span<int3> corner_tris = mesh.corner_tris();
-  for (const int i : bary_coords.index_range()) {
-    if (elimination_mask[i]) {
-      continue;
-    }
+  threading::parallel_for(bary_coords.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (elimination_mask[i]) {
+        continue;
+      }
 
-    const int3 &tri = corner_tris[tri_indices[i]];
-    const float3 bary_coord = bary_coords[i];
+      const int3 &tri = corner_tris[tri_indices[i]];
+      const float3 bary_coord = bary_coords[i];
 
-    const float v0_density_factor = std::max(0.0f, density_factors[tri[0]]);
-    const float v1_density_factor = std::max(0.0f, density_factors[tri[1]]);
-    const float v2_density_factor = std::max(0.0f, density_factors[tri[2]]);
+      const float v0_density_factor = std::max(0.0f, density_factors[tri[0]]);
+      const float v1_density_factor = std::max(0.0f, density_factors[tri[1]]);
+      const float v2_density_factor = std::max(0.0f, density_factors[tri[2]]);
 
-    const float probability = v0_density_factor * bary_coord.x + v1_density_factor * bary_coord.y +
-                              v2_density_factor * bary_coord.z;
+      const float probability = v0_density_factor * bary_coord.x +
+                                v1_density_factor * bary_coord.y +
+                                v2_density_factor * bary_coord.z;
 
-    const float hash = noise::hash_float_to_float(bary_coord);
-    if (hash > probability) {
-      elimination_mask[i] = true;
+      const float hash = noise::hash_float_to_float(bary_coord);
+      if (hash > probability) {
+        elimination_mask[i] = true;
+      }
     }
-  }
+  });
 }
 
 BLI_NOINLINE static void eliminate_points_based_on_mask(const Span<bool> elimination_mask,
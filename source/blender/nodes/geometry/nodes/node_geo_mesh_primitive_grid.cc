@@ -2,7 +2,14 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "BLI_hash.hh"
+#include "BLI_memory_cache.hh"
+#include "BLI_memory_counter.hh"
+#include "BLI_struct_equality_utils.hh"
+
+#include "BKE_lib_id.hh"
 #include "BKE_material.hh"
+#include "BKE_mesh.h"
 
 #include "GEO_mesh_primitive_grid.hh"
 
@@ -36,6 +43,97 @@ static void node_declare(NodeDeclarationBuilder &b)
   b.add_output<decl::Vector>("UV Map").field_on_all();
 }
 
+/**
+ * Identifies a generated grid in the global memory cache, so that large grids are not generated
+ * again on every evaluation of the node tree when their inputs did not change.
+ */
+class GridMeshKey : public GenericKey {
+ public:
+  int verts_x;
+  int verts_y;
+  float size_x;
+  float size_y;
+  std::string uv_map_id;
+
+  uint64_t hash() const override
+  {
+    return get_default_hash(get_default_hash(verts_x, verts_y), size_x, size_y, uv_map_id);
+  }
+
+  BLI_STRUCT_EQUALITY_OPERATORS_5(GridMeshKey, verts_x, verts_y, size_x, size_y, uv_map_id)
+
+  bool equal_to(const GenericKey &other) const override
+  {
+    if (const auto *other_typed = dynamic_cast<const GridMeshKey *>(&other)) {
+      return *this == *other_typed;
+    }
+    return false;
+  }
+
+  std::unique_ptr<GenericKey> to_storable() const override
+  {
+    return std::make_unique<GridMeshKey>(*this);
+  }
+};
+
+class GridMeshValue : public memory_cache::CachedValue {
+ public:
+  Mesh *mesh = nullptr;
+
+  ~GridMeshValue() override
+  {
+    BKE_id_free(nullptr, mesh);
+  }
+
+  void count_memory(MemoryCounter &memory) const override
+  {
+    mesh->count_memory(memory);
+  }
+};
+
+/* Smaller grids are cheaper to generate than to look up and keep in the cache. */
+static constexpr int64_t CACHE_GRID_MIN_VERTS = 64 * 1024;
+
+static Mesh *create_grid_mesh(const int verts_x,
+                              const int verts_y,
+                              const float size_x,
+                              const float size_y,
+                              const std::optional<std::string> &uv_map_id)
+{
+  Mesh *mesh = geometry::create_grid_mesh(verts_x, verts_y, size_x, size_y, uv_map_id);
+  BKE_id_material_eval_ensure_default_slot(reinterpret_cast<ID *>(mesh));
+  return mesh;
+}
+
+static Mesh *create_grid_mesh_cached(const int verts_x,
+                                     const int verts_y,
+                                     const float size_x,
+                                     const float size_y,
+                                     const std::optional<std::string> &uv_map_id)
+{
+  if (int64_t(verts_x) * int64_t(verts_y) < CACHE_GRID_MIN_VERTS) {
+    return create_grid_mesh(verts_x, verts_y, size_x, size_y, uv_map_id);
+  }
+
+  GridMeshKey key;
+  key.verts_x = verts_x;
+  key.verts_y = verts_y;
+  key.size_x = size_x;
+  key.size_y = size_y;
+  /* Anonymous attribute names are never empty, so the empty string means that no UV map is
+   * needed. */
+  key.uv_map_id = uv_map_id.value_or("");
+
+  std::shared_ptr<const GridMeshValue> value = memory_cache::get<GridMeshValue>(key, [&]() {
+    auto value = std::make_unique<GridMeshValue>();
+    value->mesh = create_grid_mesh(verts_x, verts_y, size_x, size_y, uv_map_id);
+    return value;
+  });
+
+  /* The copy shares the attribute arrays with the cached mesh. */
+  return BKE_mesh_copy_for_eval(*value->mesh);
+}
+
 static void node_geo_exec(GeoNodeExecParams params)
 {
   const float size_x = params.extract_input<float>("Size X");
@@ -50,8 +148,7 @@ static void node_geo_exec(GeoNodeExecParams params)
   std::optional<std::string> uv_map_id = params.get_output_anonymous_attribute_id_if_needed(
       "UV Map");
 
-  Mesh *mesh = geometry::create_grid_mesh(verts_x, verts_y, size_x, size_y, uv_map_id);
-  BKE_id_material_eval_ensure_default_slot(reinterpret_cast<ID *>(mesh));
+  Mesh *mesh = create_grid_mesh_cached(verts_x, verts_y, size_x, size_y, uv_map_id);
 
   params.set_output("Mesh", GeometrySet::from_mesh(mesh));
 }
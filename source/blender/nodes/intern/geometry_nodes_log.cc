@@ -5,6 +5,7 @@
 #include "NOD_geometry_nodes_log.hh"
 
 #include "BLI_listbase.h"
+#include "BLI_memory_counter.hh"
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
 
@@ -87,6 +88,13 @@ GeometryInfoLog::GeometryInfoLog(const bke::GeometrySet &geometry_set)
 {
   this->name = geometry_set.name;
 
+  {
+    MemoryCount memory_count;
+    MemoryCounter memory{memory_count};
+    geometry_set.count_memory(memory);
+    this->memory_bytes = memory_count.total_bytes;
+  }
+
   static std::array all_component_types = {bke::GeometryComponent::Type::Curve,
                                            bke::GeometryComponent::Type::Instance,
                                            bke::GeometryComponent::Type::Mesh,
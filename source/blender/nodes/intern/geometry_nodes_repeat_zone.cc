@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <mutex>
+
 #include "NOD_geometry_nodes_lazy_function.hh"
 
 #include "BKE_compute_contexts.hh"
@@ -91,8 +93,13 @@ class RepeatZoneSideEffectProvider : public lf::GraphExecutorSideEffectProvider
   }
 };
 
-struct RepeatEvalStorage {
-  LinearAllocator<> allocator;
+/**
+ * The lazy-function graph that evaluates the repeat zone with a specific number of iterations. It
+ * does not depend on a specific evaluation, so it can be reused when the zone is evaluated again
+ * with the same number of iterations (e.g. on the next frame).
+ */
+struct RepeatZoneGraph {
+  int iterations = 0;
   VectorSet<lf::FunctionNode *> lf_body_nodes;
   lf::Graph graph;
   std::optional<LazyFunctionForLogicalOr> or_function;
@@ -100,12 +107,17 @@ struct RepeatEvalStorage {
   std::optional<RepeatBodyNodeExecuteWrapper> body_execute_wrapper;
   std::optional<lf::GraphExecutor> graph_executor;
   Array<SocketValueVariant> index_values;
-  void *graph_executor_storage = nullptr;
-  bool multi_threading_enabled = false;
   Vector<int> input_index_map;
   Vector<int> output_index_map;
 };
 
+struct RepeatEvalStorage {
+  LinearAllocator<> allocator;
+  std::shared_ptr<const RepeatZoneGraph> zone_graph;
+  void *graph_executor_storage = nullptr;
+  bool multi_threading_enabled = false;
+};
+
 class LazyFunctionForRepeatZone : public LazyFunction {
  private:
   const bNodeTree &btree_;
@@ -114,6 +126,13 @@ class LazyFunctionForRepeatZone : public LazyFunction {
   const ZoneBuildInfo &zone_info_;
   const ZoneBodyFunction &body_fn_;
 
+  /**
+   * The graph that was built most recently. Building the graph for many iterations is not free,
+   * and the number of iterations usually stays the same between evaluations.
+   */
+  mutable std::mutex cached_zone_graph_mutex_;
+  mutable std::shared_ptr<const RepeatZoneGraph> cached_zone_graph_;
+
  public:
   LazyFunctionForRepeatZone(const bNodeTree &btree,
                             const bke::bNodeTreeZone &zone,
@@ -141,7 +160,7 @@ class LazyFunctionForRepeatZone : public LazyFunction {
   {
     RepeatEvalStorage *s = static_cast<RepeatEvalStorage *>(storage);
     if (s->graph_executor_storage) {
-      s->graph_executor->destruct_storage(s->graph_executor_storage);
+      s->zone_graph->graph_executor->destruct_storage(s->graph_executor_storage);
     }
     std::destroy_at(s);
   }
@@ -163,40 +182,29 @@ class LazyFunctionForRepeatZone : public LazyFunction {
       params.set_output(iterations_usage_index, true);
     }
 
-    if (!eval_storage.graph_executor) {
-      /* Create the execution graph in the first evaluation. */
-      this->initialize_execution_graph(
-          params, eval_storage, node_storage, user_data, local_user_data);
+    if (!eval_storage.zone_graph) {
+      /* Get the execution graph in the first evaluation. */
+      this->initialize_evaluation(params, eval_storage, node_storage, user_data, local_user_data);
     }
+    const RepeatZoneGraph &zone_graph = *eval_storage.zone_graph;
 
     /* Execute the graph for the repeat zone. */
-    lf::RemappedParams eval_graph_params{*eval_storage.graph_executor,
+    lf::RemappedParams eval_graph_params{*zone_graph.graph_executor,
                                          params,
-                                         eval_storage.input_index_map,
-                                         eval_storage.output_index_map,
+                                         zone_graph.input_index_map,
+                                         zone_graph.output_index_map,
                                          eval_storage.multi_threading_enabled};
     lf::Context eval_graph_context{
         eval_storage.graph_executor_storage, context.user_data, context.local_user_data};
-    eval_storage.graph_executor->execute(eval_graph_params, eval_graph_context);
+    zone_graph.graph_executor->execute(eval_graph_params, eval_graph_context);
   }
 
-  /**
-   * Generate a lazy-function graph that contains the loop body (`body_fn_`) as many times
-   * as there are iterations. Since this graph depends on the number of iterations, it can't be
-   * reused in general. We could consider caching a version of this graph per number of iterations,
-   * but right now that doesn't seem worth it. In practice, it takes much less time to create the
-   * graph than to execute it (for intended use cases of this generic implementation, more special
-   * case repeat loop evaluations could be implemented separately).
-   */
-  void initialize_execution_graph(lf::Params &params,
-                                  RepeatEvalStorage &eval_storage,
-                                  const NodeGeometryRepeatOutput &node_storage,
-                                  GeoNodesLFUserData &user_data,
-                                  GeoNodesLFLocalUserData &local_user_data) const
+  void initialize_evaluation(lf::Params &params,
+                             RepeatEvalStorage &eval_storage,
+                             const NodeGeometryRepeatOutput &node_storage,
+                             GeoNodesLFUserData &user_data,
+                             GeoNodesLFLocalUserData &local_user_data) const
   {
-    const int num_repeat_items = node_storage.items_num;
-    const int num_border_links = body_fn_.indices.inputs.border_links.size();
-
     /* Number of iterations to evaluate. */
     const int iterations = std::max<int>(
         0, params.get_input<SocketValueVariant>(zone_info_.indices.inputs.main[0]).get<int>());
@@ -221,11 +229,52 @@ class LazyFunctionForRepeatZone : public LazyFunction {
       }
     }
 
+    {
+      std::lock_guard lock{cached_zone_graph_mutex_};
+      if (!cached_zone_graph_ || cached_zone_graph_->iterations != iterations) {
+        cached_zone_graph_ = this->build_zone_graph(iterations, node_storage);
+      }
+      eval_storage.zone_graph = cached_zone_graph_;
+    }
+
+    eval_storage.graph_executor_storage = eval_storage.zone_graph->graph_executor->init_storage(
+        eval_storage.allocator);
+
+    /* Log graph for debugging purposes. */
+    bNodeTree &btree_orig = *reinterpret_cast<bNodeTree *>(
+        DEG_get_original_id(const_cast<ID *>(&btree_.id)));
+    if (btree_orig.runtime->logged_zone_graphs) {
+      std::lock_guard lock{btree_orig.runtime->logged_zone_graphs->mutex};
+      btree_orig.runtime->logged_zone_graphs->graph_by_zone_id.lookup_or_add_cb(
+          repeat_output_bnode_.identifier,
+          [&]() { return eval_storage.zone_graph->graph.to_dot(); });
+    }
+  }
+
+  /**
+   * Generate a lazy-function graph that contains the loop body (`body_fn_`) as many times
+   * as there are iterations. Since this graph depends on the number of iterations, it can't be
+   * reused in general. Only the most recently built graph is cached, because the number of
+   * iterations usually does not change between evaluations. In practice, it takes much less time
+   * to create the graph than to execute it (for intended use cases of this generic
+   * implementation, more special case repeat loop evaluations could be implemented separately).
+   */
+  std::shared_ptr<const RepeatZoneGraph> build_zone_graph(
+      const int iterations, const NodeGeometryRepeatOutput &node_storage) const
+  {
+    const int num_repeat_items = node_storage.items_num;
+    const int num_border_links = body_fn_.indices.inputs.border_links.size();
+
+    /* The graph is built in place, because the executor and other nodes reference it. */
+    std::shared_ptr<RepeatZoneGraph> zone_graph_ptr = std::make_shared<RepeatZoneGraph>();
+    RepeatZoneGraph &zone_graph = *zone_graph_ptr;
+    zone_graph.iterations = iterations;
+
     /* Take iterations input into account. */
     const int main_inputs_offset = 1;
     const int body_inputs_offset = 1;
 
-    lf::Graph &lf_graph = eval_storage.graph;
+    lf::Graph &lf_graph = zone_graph.graph;
 
     Vector<lf::GraphInputSocket *> lf_inputs;
     Vector<lf::GraphOutputSocket *> lf_outputs;
@@ -240,7 +289,7 @@ class LazyFunctionForRepeatZone : public LazyFunction {
     }
 
     /* Create body nodes. */
-    VectorSet<lf::FunctionNode *> &lf_body_nodes = eval_storage.lf_body_nodes;
+    VectorSet<lf::FunctionNode *> &lf_body_nodes = zone_graph.lf_body_nodes;
     for ([[maybe_unused]] const int i : IndexRange(iterations)) {
       lf::FunctionNode &lf_node = lf_graph.add_function(*body_fn_.function);
       lf_body_nodes.add_new(&lf_node);
@@ -249,19 +298,19 @@ class LazyFunctionForRepeatZone : public LazyFunction {
     /* Create nodes for combining border link usages. A border link is used when any of the loop
      * bodies uses the border link, so an "or" node is necessary. */
     Array<lf::FunctionNode *> lf_border_link_usage_or_nodes(num_border_links);
-    eval_storage.or_function.emplace(iterations);
+    zone_graph.or_function.emplace(iterations);
     for (const int i : IndexRange(num_border_links)) {
-      lf::FunctionNode &lf_node = lf_graph.add_function(*eval_storage.or_function);
+      lf::FunctionNode &lf_node = lf_graph.add_function(*zone_graph.or_function);
       lf_border_link_usage_or_nodes[i] = &lf_node;
     }
 
     const bool use_index_values = zone_.input_node->output_socket(0).is_directly_linked();
 
     if (use_index_values) {
-      eval_storage.index_values.reinitialize(iterations);
+      zone_graph.index_values.reinitialize(iterations);
       threading::parallel_for(IndexRange(iterations), 1024, [&](const IndexRange range) {
         for (const int i : range) {
-          eval_storage.index_values[i].set(i);
+          zone_graph.index_values[i].set(i);
         }
       });
     }
@@ -271,7 +320,7 @@ class LazyFunctionForRepeatZone : public LazyFunction {
     for (const int iter_i : lf_body_nodes.index_range()) {
       lf::FunctionNode &lf_node = *lf_body_nodes[iter_i];
       const SocketValueVariant *index_value = use_index_values ?
-                                                  &eval_storage.index_values[iter_i] :
+                                                  &zone_graph.index_values[iter_i] :
                                                   &static_unused_index;
       lf_node.input(body_fn_.indices.inputs.main[0]).set_default_value(index_value);
       for (const int i : IndexRange(num_border_links)) {
@@ -362,47 +411,37 @@ class LazyFunctionForRepeatZone : public LazyFunction {
     /* Create a mapping from parameter indices inside of this graph to parameters of the repeat
      * zone. The main complexity below stems from the fact that the iterations input is handled
      * outside of this graph. */
-    eval_storage.output_index_map.reinitialize(outputs_.size() - 1);
-    eval_storage.input_index_map.resize(inputs_.size() - 1);
-    array_utils::fill_index_range<int>(eval_storage.input_index_map, 1);
+    zone_graph.output_index_map.reinitialize(outputs_.size() - 1);
+    zone_graph.input_index_map.resize(inputs_.size() - 1);
+    array_utils::fill_index_range<int>(zone_graph.input_index_map, 1);
 
     Vector<const lf::GraphInputSocket *> lf_graph_inputs = lf_inputs.as_span().drop_front(1);
 
     const int iteration_usage_index = zone_info_.indices.outputs.input_usages[0];
     array_utils::fill_index_range<int>(
-        eval_storage.output_index_map.as_mutable_span().take_front(iteration_usage_index));
+        zone_graph.output_index_map.as_mutable_span().take_front(iteration_usage_index));
     array_utils::fill_index_range<int>(
-        eval_storage.output_index_map.as_mutable_span().drop_front(iteration_usage_index),
+        zone_graph.output_index_map.as_mutable_span().drop_front(iteration_usage_index),
         iteration_usage_index + 1);
 
     Vector<const lf::GraphOutputSocket *> lf_graph_outputs = lf_outputs.as_span().take_front(
         iteration_usage_index);
     lf_graph_outputs.extend(lf_outputs.as_span().drop_front(iteration_usage_index + 1));
 
-    eval_storage.body_execute_wrapper.emplace();
-    eval_storage.body_execute_wrapper->repeat_output_bnode_ = &repeat_output_bnode_;
-    eval_storage.body_execute_wrapper->lf_body_nodes_ = &lf_body_nodes;
-    eval_storage.side_effect_provider.emplace();
-    eval_storage.side_effect_provider->repeat_output_bnode_ = &repeat_output_bnode_;
-    eval_storage.side_effect_provider->lf_body_nodes_ = lf_body_nodes;
+    zone_graph.body_execute_wrapper.emplace();
+    zone_graph.body_execute_wrapper->repeat_output_bnode_ = &repeat_output_bnode_;
+    zone_graph.body_execute_wrapper->lf_body_nodes_ = &lf_body_nodes;
+    zone_graph.side_effect_provider.emplace();
+    zone_graph.side_effect_provider->repeat_output_bnode_ = &repeat_output_bnode_;
+    zone_graph.side_effect_provider->lf_body_nodes_ = lf_body_nodes;
 
-    eval_storage.graph_executor.emplace(lf_graph,
+    zone_graph.graph_executor.emplace(lf_graph,
                                         std::move(lf_graph_inputs),
                                         std::move(lf_graph_outputs),
                                         nullptr,
-                                        &*eval_storage.side_effect_provider,
-                                        &*eval_storage.body_execute_wrapper);
-    eval_storage.graph_executor_storage = eval_storage.graph_executor->init_storage(
-        eval_storage.allocator);
-
-    /* Log graph for debugging purposes. */
-    bNodeTree &btree_orig = *reinterpret_cast<bNodeTree *>(
-        DEG_get_original_id(const_cast<ID *>(&btree_.id)));
-    if (btree_orig.runtime->logged_zone_graphs) {
-      std::lock_guard lock{btree_orig.runtime->logged_zone_graphs->mutex};
-      btree_orig.runtime->logged_zone_graphs->graph_by_zone_id.lookup_or_add_cb(
-          repeat_output_bnode_.identifier, [&]() { return lf_graph.to_dot(); });
-    }
+                                        &*zone_graph.side_effect_provider,
+                                        &*zone_graph.body_execute_wrapper);
+    return zone_graph_ptr;
   }
 
   std::string input_name(const int i) const override
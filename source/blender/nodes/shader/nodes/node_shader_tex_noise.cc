@@ -268,11 +268,13 @@ class NoiseFunction : public mf::MultiFunction {
 
     const bool compute_factor = !r_factor.is_empty();
     const bool compute_color = !r_color.is_empty();
+    /* The first channel of the color is computed exactly like the factor, so the factor is taken
+     * from the color when both are needed instead of computing the noise again. */
 
     switch (dimensions_) {
       case 1: {
         const VArray<float> &w = params.readonly_single_input<float>(0, "W");
-        if (compute_factor) {
+        if (compute_factor && !compute_color) {
           mask.foreach_index([&](const int64_t i) {
             const float position = w[i] * scale[i];
             r_factor[i] = noise::perlin_fractal_distorted(position,
@@ -300,13 +302,16 @@ class NoiseFunction : public mf::MultiFunction {
                 type_,
                 normalize_);
             r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+            if (compute_factor) {
+              r_factor[i] = c[0];
+            }
           });
         }
         break;
       }
       case 2: {
         const VArray<float3> &vector = params.readonly_single_input<float3>(0, "Vector");
-        if (compute_factor) {
+        if (compute_factor && !compute_color) {
           mask.foreach_index([&](const int64_t i) {
             const float2 position = float2(vector[i] * scale[i]);
             r_factor[i] = noise::perlin_fractal_distorted(position,
@@ -334,13 +339,16 @@ class NoiseFunction : public mf::MultiFunction {
                 type_,
                 normalize_);
             r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+            if (compute_factor) {
+              r_factor[i] = c[0];
+            }
           });
         }
         break;
       }
       case 3: {
         const VArray<float3> &vector = params.readonly_single_input<float3>(0, "Vector");
-        if (compute_factor) {
+        if (compute_factor && !compute_color) {
           mask.foreach_index([&](const int64_t i) {
             const float3 position = vector[i] * scale[i];
             r_factor[i] = noise::perlin_fractal_distorted(position,
@@ -368,6 +376,9 @@ class NoiseFunction : public mf::MultiFunction {
                 type_,
                 normalize_);
             r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+            if (compute_factor) {
+              r_factor[i] = c[0];
+            }
           });
         }
         break;
@@ -375,7 +386,7 @@ class NoiseFunction : public mf::MultiFunction {
       case 4: {
         const VArray<float3> &vector = params.readonly_single_input<float3>(0, "Vector");
         const VArray<float> &w = params.readonly_single_input<float>(1, "W");
-        if (compute_factor) {
+        if (compute_factor && !compute_color) {
           mask.foreach_index([&](const int64_t i) {
             const float3 position_vector = vector[i] * scale[i];
             const float position_w = w[i] * scale[i];
@@ -409,6 +420,9 @@ class NoiseFunction : public mf::MultiFunction {
                 type_,
                 normalize_);
             r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+            if (compute_factor) {
+              r_factor[i] = c[0];
+            }
           });
         }
         break;
@@ -97,6 +97,9 @@ void BPY_driver_reset();
 /**
  * This evaluates Python driver expressions, `driver_orig->expression`
  * is a Python expression that should evaluate to a float number, which is returned.
+ *
+ * \note Variables of `driver` other than single properties must already be evaluated,
+ * their value is taken from `DriverVar.curval`.
  */
 float BPY_driver_exec(PathResolvedRNA *anim_rna,
                       ChannelDriver *driver,
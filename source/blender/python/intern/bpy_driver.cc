@@ -679,8 +679,11 @@ float BPY_driver_exec(PathResolvedRNA *anim_rna,
     else
 #endif
     {
-      /* Try to get variable value. */
-      const float tval = driver_get_variable_value(anim_eval_context, driver, dvar);
+      /* Other variable types have already been evaluated by the caller, without holding the
+       * GIL, see #evaluate_driver_python. */
+      const float tval = (dvar->type == DVAR_TYPE_SINGLE_PROP) ?
+                             driver_get_variable_value(anim_eval_context, driver, dvar) :
+                             dvar->curval;
       driver_arg = PyFloat_FromDouble(double(tval));
     }
 
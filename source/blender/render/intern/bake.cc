@@ -54,11 +54,13 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_index_range.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
 #include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_bvhutils.hh"
@@ -84,6 +86,8 @@ struct BakeDataZSpan {
   int primitive_id;
   BakeImage *bk_image;
   ZSpan *zspan;
+  /** Only pixels in this range of rows are written, see #RE_bake_pixels_populate. */
+  int row_start, row_end;
   float du_dx, du_dy;
   float dv_dx, dv_dy;
 };
@@ -110,6 +114,10 @@ static void store_bake_pixel(void *handle, int x, int y, float u, float v)
   BakeDataZSpan *bd = (BakeDataZSpan *)handle;
   BakePixel *pixel;
 
+  if (y < bd->row_start || y >= bd->row_end) {
+    return;
+  }
+
   const int width = bd->bk_image->width;
   const size_t offset = bd->bk_image->offset;
   const int i = offset + y * width + x;
@@ -729,19 +737,13 @@ void RE_bake_pixels_populate(Mesh *mesh,
     return;
   }
 
-  BakeDataZSpan bd;
-  bd.pixel_array = pixel_array;
-  bd.zspan = MEM_calloc_arrayN<ZSpan>(targets->images_num, "bake zspan");
-
   /* initialize all pixel arrays so we know which ones are 'blank' */
-  for (int i = 0; i < pixels_num; i++) {
-    pixel_array[i].primitive_id = -1;
-    pixel_array[i].object_id = 0;
-  }
-
-  for (int i = 0; i < targets->images_num; i++) {
-    zbuf_alloc_span(&bd.zspan[i], targets->images[i].width, targets->images[i].height);
-  }
+  threading::parallel_for(IndexRange(pixels_num), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      pixel_array[i].primitive_id = -1;
+      pixel_array[i].object_id = 0;
+    }
+  });
 
   const int tottri = poly_to_tri_count(mesh->faces_num, mesh->corners_num);
   blender::int3 *corner_tris = MEM_malloc_arrayN<blender::int3>(size_t(tottri), __func__);
@@ -756,50 +758,82 @@ void RE_bake_pixels_populate(Mesh *mesh,
 
   const int materials_num = targets->materials_num;
 
-  for (int i = 0; i < tottri; i++) {
-    const int3 &tri = corner_tris[i];
-    const int face_i = tri_faces[i];
+  /* Find the image matching the material of every triangle. */
+  Array<const Image *> tri_images(tottri);
+  threading::parallel_for(IndexRange(tottri), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const int face_i = tri_faces[i];
+      const int material_index = (!material_indices.is_empty() && materials_num) ?
+                                     clamp_i(material_indices[face_i], 0, materials_num - 1) :
+                                     0;
+      tri_images[i] = targets->material_to_image[material_index];
+    }
+  });
 
-    bd.primitive_id = i;
+  /* Rasterize every image in bands of rows, in parallel. Every band goes over all triangles in
+   * order and only writes its own rows, so where triangles overlap the last one still wins, like
+   * when rasterizing on a single thread. */
+  const int band_rows = 256;
+  Vector<int2> bands;
+  for (int image_id = 0; image_id < targets->images_num; image_id++) {
+    for (int row = 0; row < targets->images[image_id].height; row += band_rows) {
+      bands.append({image_id, row});
+    }
+  }
 
-    /* Find images matching this material. */
-    const int material_index = (!material_indices.is_empty() && materials_num) ?
-                                   clamp_i(material_indices[face_i], 0, materials_num - 1) :
-                                   0;
-    Image *image = targets->material_to_image[material_index];
-    for (int image_id = 0; image_id < targets->images_num; image_id++) {
+  threading::parallel_for(bands.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t band_i : range) {
+      const int image_id = bands[band_i][0];
       BakeImage *bk_image = &targets->images[image_id];
-      if (bk_image->image != image) {
-        continue;
-      }
 
-      /* Compute triangle vertex UV coordinates. */
-      float vec[3][2];
-      for (int a = 0; a < 3; a++) {
-        const float *uv = mloopuv[tri[a]];
-
-        /* NOTE(@ideasman42): workaround for pixel aligned UVs which are common and can screw
-         * up our intersection tests where a pixel gets in between 2 faces or the middle of a quad,
-         * camera aligned quads also have this problem but they are less common.
-         * Add a small offset to the UVs, fixes bug #18685. */
-        vec[a][0] = (uv[0] - bk_image->uv_offset[0]) * float(bk_image->width) - (0.5f + 0.001f);
-        vec[a][1] = (uv[1] - bk_image->uv_offset[1]) * float(bk_image->height) - (0.5f + 0.002f);
-      }
+      ZSpan zspan;
+      zbuf_alloc_span(&zspan, bk_image->width, bk_image->height);
 
-      /* Rasterize triangle. */
+      BakeDataZSpan bd;
+      bd.pixel_array = pixel_array;
       bd.bk_image = bk_image;
-      bake_differentials(&bd, vec[0], vec[1], vec[2]);
-      zspan_scanconvert(
-          &bd.zspan[image_id], (void *)&bd, vec[0], vec[1], vec[2], store_bake_pixel);
-    }
-  }
+      bd.zspan = &zspan;
+      bd.row_start = bands[band_i][1];
+      bd.row_end = bd.row_start + band_rows;
 
-  for (int i = 0; i < targets->images_num; i++) {
-    zbuf_free_span(&bd.zspan[i]);
-  }
+      for (int i = 0; i < tottri; i++) {
+        if (tri_images[i] != bk_image->image) {
+          continue;
+        }
+        const int3 &tri = corner_tris[i];
+
+        /* Compute triangle vertex UV coordinates. */
+        float vec[3][2];
+        for (int a = 0; a < 3; a++) {
+          const float *uv = mloopuv[tri[a]];
+
+          /* NOTE(@ideasman42): workaround for pixel aligned UVs which are common and can screw
+           * up our intersection tests where a pixel gets in between 2 faces or the middle of a
+           * quad, camera aligned quads also have this problem but they are less common.
+           * Add a small offset to the UVs, fixes bug #18685. */
+          vec[a][0] = (uv[0] - bk_image->uv_offset[0]) * float(bk_image->width) - (0.5f + 0.001f);
+          vec[a][1] = (uv[1] - bk_image->uv_offset[1]) * float(bk_image->height) -
+                      (0.5f + 0.002f);
+        }
+
+        /* Skip triangles that don't cover any row of this band. */
+        const float y_min = min_fff(vec[0][1], vec[1][1], vec[2][1]);
+        const float y_max = max_fff(vec[0][1], vec[1][1], vec[2][1]);
+        if (y_max < float(bd.row_start - 1) || y_min > float(bd.row_end)) {
+          continue;
+        }
+
+        /* Rasterize triangle. */
+        bd.primitive_id = i;
+        bake_differentials(&bd, vec[0], vec[1], vec[2]);
+        zspan_scanconvert(&zspan, (void *)&bd, vec[0], vec[1], vec[2], store_bake_pixel);
+      }
+
+      zbuf_free_span(&zspan);
+    }
+  });
 
   MEM_freeN(corner_tris);
-  MEM_freeN(bd.zspan);
 }
 
 /* ******************** NORMALS ************************ */
@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <ctime>
 #include <memory.h>
+#include <string>
 
 #include "MEM_guardedalloc.h"
 
@@ -25,6 +26,7 @@
 #include "BLI_fileops.h"
 #include "BLI_fileops_types.h"
 #include "BLI_listbase.h"
+#include "BLI_map.hh"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
 #include "BLI_threads.h"
@@ -76,14 +78,6 @@ struct DiskCacheHeader {
   DiskCacheHeaderEntry entry[DCACHE_IMAGES_PER_FILE];
 };
 
-struct SeqDiskCache {
-  Main *bmain;
-  int64_t timestamp;
-  ListBase files;
-  ThreadMutex read_write_mutex;
-  size_t size_total;
-};
-
 struct DiskCacheFile {
   DiskCacheFile *next, *prev;
   char filepath[FILE_MAX];
@@ -98,8 +92,32 @@ struct DiskCacheFile {
   int start_frame;
 };
 
+struct SeqDiskCache {
+  Main *bmain = nullptr;
+  int64_t timestamp = 0;
+  ListBase files = {};
+  /* Entries of `files` by their lower case path, so they are found without scanning the list,
+   * which can hold thousands of files. */
+  Map<std::string, DiskCacheFile *> files_by_path;
+  ThreadMutex read_write_mutex = {};
+  size_t size_total = 0;
+};
+
 static ThreadMutex cache_create_lock = BLI_MUTEX_INITIALIZER;
 
+static std::string seq_disk_cache_file_key(const char *filepath)
+{
+  std::string key = filepath;
+  BLI_str_tolower_ascii(key.data(), key.size());
+  return key;
+}
+
+static void seq_disk_cache_free_files(SeqDiskCache *disk_cache)
+{
+  BLI_freelistN(&disk_cache->files);
+  disk_cache->files_by_path.clear();
+}
+
 static const char *seq_disk_cache_base_dir()
 {
   return U.sequencer_disk_cache_dir;
@@ -151,6 +169,7 @@ static DiskCacheFile *seq_disk_cache_add_file_to_list(SeqDiskCache *disk_cache,
          &cache_file->start_frame);
   cache_file->start_frame *= DCACHE_IMAGES_PER_FILE;
   BLI_addtail(&disk_cache->files, cache_file);
+  disk_cache->files_by_path.add_overwrite(seq_disk_cache_file_key(filepath), cache_file);
   return cache_file;
 }
 
@@ -214,6 +233,7 @@ static void seq_disk_cache_delete_file(SeqDiskCache *disk_cache, DiskCacheFile *
 {
   disk_cache->size_total -= file->fstat.st_size;
   BLI_delete(file->filepath, false, false);
+  disk_cache->files_by_path.remove(seq_disk_cache_file_key(file->filepath));
   BLI_remlink(&disk_cache->files, file);
   MEM_freeN(file);
 }
@@ -232,7 +252,7 @@ bool seq_disk_cache_enforce_limits(SeqDiskCache *disk_cache)
 
     if (BLI_exists(oldest_file->filepath) == 0) {
       /* File may have been manually deleted during runtime, do re-scan. */
-      BLI_freelistN(&disk_cache->files);
+      seq_disk_cache_free_files(disk_cache);
       seq_disk_cache_get_files(disk_cache, seq_disk_cache_base_dir());
       continue;
     }
@@ -247,15 +267,7 @@ bool seq_disk_cache_enforce_limits(SeqDiskCache *disk_cache)
 static DiskCacheFile *seq_disk_cache_get_file_entry_by_path(SeqDiskCache *disk_cache,
                                                             const char *filepath)
 {
-  DiskCacheFile *cache_file = static_cast<DiskCacheFile *>(disk_cache->files.first);
-
-  for (; cache_file; cache_file = cache_file->next) {
-    if (BLI_strcasecmp(cache_file->filepath, filepath) == 0) {
-      return cache_file;
-    }
-  }
-
-  return nullptr;
+  return disk_cache->files_by_path.lookup_default(seq_disk_cache_file_key(filepath), nullptr);
 }
 
 /* Update file size and timestamp. */
@@ -668,7 +680,7 @@ ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
 
 SeqDiskCache *seq_disk_cache_create(Main *bmain, Scene *scene)
 {
-  SeqDiskCache *disk_cache = MEM_callocN<SeqDiskCache>("SeqDiskCache");
+  SeqDiskCache *disk_cache = MEM_new<SeqDiskCache>("SeqDiskCache");
   disk_cache->bmain = bmain;
   BLI_mutex_init(&disk_cache->read_write_mutex);
   seq_disk_cache_handle_versioning(disk_cache);
@@ -680,9 +692,9 @@ SeqDiskCache *seq_disk_cache_create(Main *bmain, Scene *scene)
 
 void seq_disk_cache_free(SeqDiskCache *disk_cache)
 {
-  BLI_freelistN(&disk_cache->files);
+  seq_disk_cache_free_files(disk_cache);
   BLI_mutex_end(&disk_cache->read_write_mutex);
-  MEM_freeN(disk_cache);
+  MEM_delete(disk_cache);
 }
 
 }  // namespace blender::seq
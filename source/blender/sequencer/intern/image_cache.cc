@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include <atomic>
 #include <cstddef>
 #include <ctime>
 #include <memory.h>
@@ -18,6 +19,7 @@
 
 #include "IMB_imbuf.hh"
 #include "IMB_imbuf_types.hh"
+#include "IMB_moviecache.hh"
 
 #include "BLI_ghash.h"
 #include "BLI_math_base.h"
@@ -76,10 +78,15 @@ struct SeqCache {
 struct SeqCacheItem {
   SeqCache *cache_owner;
   ImBuf *ibuf;
+  /* Size of the image buffer when it was stored, see #seq_cache_mem_in_use. */
+  size_t ibuf_size;
 };
 
 static ThreadMutex cache_create_lock = BLI_MUTEX_INITIALIZER;
 
+/* Memory used by the images stored in the caches of all scenes. */
+static std::atomic<size_t> seq_cache_mem_in_use = 0;
+
 static bool seq_cmp_render_data(const RenderData *a, const RenderData *b)
 {
   return ((a->preview_render_size != b->preview_render_size) || (a->rectx != b->rectx) ||
@@ -188,6 +195,7 @@ static void seq_cache_valfree(void *val)
   SeqCacheItem *item = (SeqCacheItem *)val;
 
   if (item->ibuf) {
+    seq_cache_mem_in_use -= item->ibuf_size;
     IMB_freeImBuf(item->ibuf);
   }
 
@@ -217,6 +225,8 @@ static void seq_cache_put_ex(Scene *scene, SeqCacheKey *key, ImBuf *ibuf)
   item = static_cast<SeqCacheItem *>(BLI_mempool_alloc(cache->items_pool));
   item->cache_owner = cache;
   item->ibuf = ibuf;
+  item->ibuf_size = ibuf ? IMB_get_size_in_memory(ibuf) : 0;
+  seq_cache_mem_in_use += item->ibuf_size;
 
   const int stored_types_flag = get_stored_types_flag(scene, key);
 
@@ -819,7 +829,7 @@ void seq_cache_put(
   if (!key->is_temp_cache) {
     if (seq_disk_cache_is_enabled(context->bmain)) {
       if (cache->disk_cache == nullptr) {
-        seq_disk_cache_create(context->bmain, context->scene);
+        cache->disk_cache = seq_disk_cache_create(context->bmain, context->scene);
       }
 
       seq_disk_cache_write_file(cache->disk_cache, key, i);
@@ -875,7 +885,11 @@ void cache_iterate(
 
 bool seq_cache_is_full()
 {
-  return seq_cache_get_mem_total() < MEM_get_memory_in_use();
+  /* Movie clip and image caches share the memory cache limit with the sequencer cache, so account
+   * for the images stored in all of them instead of the total memory used by Blender, which
+   * would make the sequencer cache evict all of its images when other data uses a lot of memory,
+   * while the other caches are still allowed to grow to the full limit. */
+  return seq_cache_get_mem_total() < seq_cache_mem_in_use + IMB_moviecache_get_memory_in_use();
 }
 
 }  // namespace blender::seq
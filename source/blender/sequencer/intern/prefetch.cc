@@ -440,6 +440,35 @@ static bool seq_prefetch_must_skip_frame(PrefetchJob *pfjob, ListBase *channels,
   return false;
 }
 
+/* Check whether the final image of the next frame is already cached, in which case the frame can
+ * be skipped without evaluating the depsgraph and animation for it. Strip timing is not affected
+ * by the evaluation, so the strips shown by the previously evaluated scene are used. */
+static bool seq_prefetch_frame_is_cached(PrefetchJob *pfjob)
+{
+  Editing *ed = editing_get(pfjob->scene_eval);
+  ListBase *seqbase = active_seqbase_get(ed);
+  ListBase *channels = channels_displayed_get(ed);
+  const float timeline_frame = seq_prefetch_cfra(pfjob);
+
+  Vector<Strip *> strips = seq_get_shown_sequences(
+      pfjob->scene_eval, channels, seqbase, timeline_frame, 0);
+  if (strips.is_empty()) {
+    return false;
+  }
+
+  /* Needed to look up the original strips and context in the cache, see #seq_prefetch_frames. */
+  pfjob->scene_eval->ed->prefetch_job = pfjob;
+  ImBuf *ibuf = seq_cache_get(
+      &pfjob->context_cpy, strips.last(), timeline_frame, SEQ_CACHE_STORE_FINAL_OUT);
+  pfjob->scene_eval->ed->prefetch_job = nullptr;
+
+  if (ibuf == nullptr) {
+    return false;
+  }
+  IMB_freeImBuf(ibuf);
+  return true;
+}
+
 static bool seq_prefetch_need_suspend(PrefetchJob *pfjob)
 {
   return seq_prefetch_is_cache_full(pfjob->scene) || pfjob->is_scrubbing ||
@@ -465,6 +494,15 @@ static void *seq_prefetch_frames(void *job)
   PrefetchJob *pfjob = (PrefetchJob *)job;
 
   while (seq_prefetch_cfra(pfjob) <= pfjob->scene->r.efra) {
+    if (seq_prefetch_frame_is_cached(pfjob)) {
+      pfjob->num_frames_prefetched++;
+      seq_prefetch_do_suspend(pfjob);
+      if (!(pfjob->scene->ed->cache_flag & SEQ_CACHE_PREFETCH_ENABLE) || pfjob->stop) {
+        break;
+      }
+      continue;
+    }
+
     pfjob->scene_eval->ed->prefetch_job = nullptr;
 
     seq_prefetch_update_depsgraph(pfjob);
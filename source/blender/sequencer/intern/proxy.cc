@@ -18,6 +18,8 @@
 #include "BLI_listbase.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #ifdef WIN32
 #  include "BLI_winstuff.h"
@@ -256,45 +258,8 @@ ImBuf *seq_proxy_fetch(const RenderData *context, Strip *strip, int timeline_fra
   return nullptr;
 }
 
-static void seq_proxy_build_frame(const RenderData *context,
-                                  SeqRenderState *state,
-                                  Strip *strip,
-                                  int timeline_frame,
-                                  int proxy_render_size,
-                                  const bool overwrite)
+static void seq_proxy_save_frame(ImBuf *ibuf, const char *filepath, const int quality)
 {
-  char filepath[PROXY_MAXFILE];
-  ImBuf *ibuf_tmp, *ibuf;
-  Scene *scene = context->scene;
-
-  if (!seq_proxy_get_filepath(scene,
-                              strip,
-                              timeline_frame,
-                              eSpaceSeq_Proxy_RenderSize(proxy_render_size),
-                              filepath,
-                              context->view_id))
-  {
-    return;
-  }
-
-  if (!overwrite && BLI_exists(filepath)) {
-    return;
-  }
-
-  ibuf_tmp = seq_render_strip(context, state, strip, timeline_frame);
-
-  int rectx = (proxy_render_size * ibuf_tmp->x) / 100;
-  int recty = (proxy_render_size * ibuf_tmp->y) / 100;
-
-  if (ibuf_tmp->x != rectx || ibuf_tmp->y != recty) {
-    ibuf = IMB_scale_into_new(ibuf_tmp, rectx, recty, IMBScaleFilter::Nearest, true);
-    IMB_freeImBuf(ibuf_tmp);
-  }
-  else {
-    ibuf = ibuf_tmp;
-  }
-
-  const int quality = strip->data->proxy->quality;
   const bool save_float = ibuf->float_buffer.data != nullptr;
   ibuf->foptions.quality = quality;
   if (save_float) {
@@ -315,8 +280,83 @@ static void seq_proxy_build_frame(const RenderData *context,
   if (ok == false) {
     perror(filepath);
   }
+}
+
+struct ProxyFrameOutput {
+  int render_size;
+  char filepath[PROXY_MAXFILE];
+};
+
+/* Build the proxies of all sizes in `size_flags` for the given frame. The strip is rendered only
+ * once, and the downscaled proxies are encoded in parallel. */
+static void seq_proxy_build_frame(const RenderData *context,
+                                  SeqRenderState *state,
+                                  Strip *strip,
+                                  int timeline_frame,
+                                  const int size_flags,
+                                  const bool overwrite)
+{
+  Scene *scene = context->scene;
+
+  const int render_sizes[4][2] = {
+      {IMB_PROXY_25, 25}, {IMB_PROXY_50, 50}, {IMB_PROXY_75, 75}, {IMB_PROXY_100, 100}};
+  Vector<ProxyFrameOutput, 4> outputs;
+  for (const auto &[flag, render_size] : render_sizes) {
+    if ((size_flags & flag) == 0) {
+      continue;
+    }
+    ProxyFrameOutput output;
+    output.render_size = render_size;
+    if (!seq_proxy_get_filepath(scene,
+                                strip,
+                                timeline_frame,
+                                eSpaceSeq_Proxy_RenderSize(render_size),
+                                output.filepath,
+                                context->view_id))
+    {
+      continue;
+    }
+    if (!overwrite && BLI_exists(output.filepath)) {
+      continue;
+    }
+    outputs.append(output);
+  }
+
+  if (outputs.is_empty()) {
+    return;
+  }
 
-  IMB_freeImBuf(ibuf);
+  ImBuf *ibuf_src = seq_render_strip(context, state, strip, timeline_frame);
+  if (ibuf_src == nullptr) {
+    return;
+  }
+
+  const int quality = strip->data->proxy->quality;
+
+  /* Proxies that need scaling only read the source, so they can be built concurrently. The full
+   * size proxy is saved from the source itself afterwards, since saving modifies it. */
+  threading::parallel_for(outputs.index_range(), 1, [&](const IndexRange range) {
+    for (const ProxyFrameOutput &output : outputs.as_span().slice(range)) {
+      const int rectx = (output.render_size * ibuf_src->x) / 100;
+      const int recty = (output.render_size * ibuf_src->y) / 100;
+      if (ibuf_src->x == rectx && ibuf_src->y == recty) {
+        continue;
+      }
+      ImBuf *ibuf = IMB_scale_into_new(ibuf_src, rectx, recty, IMBScaleFilter::Nearest, true);
+      seq_proxy_save_frame(ibuf, output.filepath, quality);
+      IMB_freeImBuf(ibuf);
+    }
+  });
+
+  for (const ProxyFrameOutput &output : outputs) {
+    const int rectx = (output.render_size * ibuf_src->x) / 100;
+    const int recty = (output.render_size * ibuf_src->y) / 100;
+    if (ibuf_src->x == rectx && ibuf_src->y == recty) {
+      seq_proxy_save_frame(ibuf_src, output.filepath, quality);
+    }
+  }
+
+  IMB_freeImBuf(ibuf_src);
 }
 
 /**
@@ -552,18 +592,8 @@ void proxy_rebuild(IndexBuildContext *context, wmJobWorkerStatus *worker_status)
        timeline_frame < time_right_handle_frame_get(scene, strip);
        timeline_frame++)
   {
-    if (context->size_flags & IMB_PROXY_25) {
-      seq_proxy_build_frame(&render_context, &state, strip, timeline_frame, 25, overwrite);
-    }
-    if (context->size_flags & IMB_PROXY_50) {
-      seq_proxy_build_frame(&render_context, &state, strip, timeline_frame, 50, overwrite);
-    }
-    if (context->size_flags & IMB_PROXY_75) {
-      seq_proxy_build_frame(&render_context, &state, strip, timeline_frame, 75, overwrite);
-    }
-    if (context->size_flags & IMB_PROXY_100) {
-      seq_proxy_build_frame(&render_context, &state, strip, timeline_frame, 100, overwrite);
-    }
+    seq_proxy_build_frame(
+        &render_context, &state, strip, timeline_frame, context->size_flags, overwrite);
 
     worker_status->progress = float(timeline_frame - time_left_handle_frame_get(scene, strip)) /
                               (time_right_handle_frame_get(scene, strip) -
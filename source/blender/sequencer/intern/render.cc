@@ -25,6 +25,7 @@
 #include "BLI_path_utils.hh"
 #include "BLI_rect.h"
 #include "BLI_task.hh"
+#include "BLI_time.h"
 
 #include "BKE_anim_data.hh"
 #include "BKE_animsys.h"
@@ -39,6 +40,8 @@
 #include "BKE_movieclip.h"
 #include "BKE_scene.hh"
 
+#include "CLG_log.h"
+
 #include "DEG_depsgraph.hh"
 #include "DEG_depsgraph_query.hh"
 
@@ -79,6 +82,8 @@
 
 namespace blender::seq {
 
+static CLG_LogRef LOG = {"seq.render"};
+
 static ImBuf *seq_render_strip_stack(const RenderData *context,
                                      SeqRenderState *state,
                                      ListBase *channels,
@@ -651,6 +656,26 @@ static ImBuf *input_preprocess(const RenderData *context,
     IMB_freeImBuf(ibuf);
   }
 
+  /* Convert byte images that need to become float straight into a new buffer. The original is
+   * usually shared with the raw cache, so duplicating it first would copy the byte pixels only
+   * to free them right after the conversion. Saturation is applied to byte pixels, so keep the
+   * existing path in that case. */
+  if (preprocessed_ibuf == nullptr && (strip->flag & SEQ_MAKE_FLOAT) && strip->sat == 1.0f &&
+      ibuf->float_buffer.data == nullptr && ibuf->byte_buffer.data != nullptr)
+  {
+    preprocessed_ibuf = IMB_allocImBuf(ibuf->x, ibuf->y, ibuf->planes, IB_float_data);
+    IMB_colormanagement_transform_byte_to_float(preprocessed_ibuf->float_buffer.data,
+                                                ibuf->byte_buffer.data,
+                                                ibuf->x,
+                                                ibuf->y,
+                                                ibuf->channels,
+                                                IMB_colormanagement_get_rect_colorspace(ibuf),
+                                                scene->sequencer_colorspace_settings.name);
+    seq_imbuf_assign_spaces(scene, preprocessed_ibuf);
+    IMB_metadata_copy(preprocessed_ibuf, ibuf);
+    IMB_freeImBuf(ibuf);
+  }
+
   /* Duplicate ibuf if we still have original. */
   if (preprocessed_ibuf == nullptr) {
     preprocessed_ibuf = IMB_makeSingleUser(ibuf);
@@ -1750,24 +1775,44 @@ ImBuf *seq_render_strip(const RenderData *context,
 
   ibuf = seq_cache_get(context, strip, timeline_frame, SEQ_CACHE_STORE_PREPROCESSED);
   if (ibuf != nullptr) {
+    CLOG_INFO(&LOG, 2, "%s, frame %.1f: preprocessed cache hit", strip->name + 2, timeline_frame);
     return ibuf;
   }
 
+  const bool use_timing = CLOG_CHECK(&LOG, 1);
+  const double time_start = use_timing ? BLI_time_now_seconds() : 0.0;
+  bool is_raw_cached = false;
+
   /* Proxies are not stored in cache. */
   if (!can_use_proxy(context, strip, rendersize_to_proxysize(context->preview_render_size))) {
     ibuf = seq_cache_get(context, strip, timeline_frame, SEQ_CACHE_STORE_RAW);
+    is_raw_cached = ibuf != nullptr;
   }
 
   if (ibuf == nullptr) {
     ibuf = do_render_strip_uncached(context, state, strip, timeline_frame, &is_proxy_image);
   }
 
+  const double time_rendered = use_timing ? BLI_time_now_seconds() : 0.0;
+
   if (ibuf) {
     use_preprocess = seq_input_have_to_preprocess(context, strip, timeline_frame);
     ibuf = seq_render_preprocess_ibuf(
         context, strip, ibuf, timeline_frame, use_preprocess, is_proxy_image);
   }
 
+  if (use_timing) {
+    const double time_end = BLI_time_now_seconds();
+    CLOG_INFO(&LOG,
+              1,
+              "%s, frame %.1f: %s %.2f ms, preprocess %.2f ms",
+              strip->name + 2,
+              timeline_frame,
+              is_raw_cached ? "raw cache hit" : (is_proxy_image ? "proxy" : "render"),
+              (time_rendered - time_start) * 1000.0,
+              (time_end - time_rendered) * 1000.0);
+  }
+
   if (ibuf == nullptr) {
     ibuf = IMB_allocImBuf(context->rectx, context->recty, 32, IB_byte_data);
     seq_imbuf_assign_spaces(context->scene, ibuf);
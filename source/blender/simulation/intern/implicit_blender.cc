@@ -15,6 +15,7 @@
 #  include "BLI_math_geom.h"
 #  include "BLI_math_matrix.h"
 #  include "BLI_math_vector.h"
+#  include "BLI_task.hh"
 
 #  include "BKE_cloth.hh"
 
@@ -28,6 +29,9 @@
 #    define CLOTH_OPENMP_LIMIT 512
 #  endif
 
+/* Number of elements from which long vector and big matrix operations are run in parallel. */
+#  define CLOTH_PARALLEL_GRAIN_SIZE 4096
+
 // #define DEBUG_TIME
 
 #  ifdef DEBUG_TIME
@@ -61,6 +65,19 @@ struct fmatrix3x3 {
   uint scount;      /* spring count */
 };
 
+/* Call `fn` for every index in `[0, size)`. Every index must only write to its own elements, so the
+ * result doesn't depend on the number of threads. */
+template<typename Fn> static void cloth_parallel_foreach(const uint size, const Fn &fn)
+{
+  blender::threading::parallel_for(blender::IndexRange(size),
+                                   CLOTH_PARALLEL_GRAIN_SIZE,
+                                   [&](const blender::IndexRange range) {
+                                     for (const int64_t i : range) {
+                                       fn(uint(i));
+                                     }
+                                   });
+}
+
 ///////////////////////////
 /* float[3] vector */
 ///////////////////////////
@@ -183,21 +200,15 @@ DO_INLINE void add_lfvector_lfvector(float (*to)[3],
                                      float (*fLongVectorB)[3],
                                      uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    add_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
-  }
+  cloth_parallel_foreach(
+      verts, [&](const uint i) { add_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]); });
 }
 /* `A = B + C * float` -> for big vector. */
 DO_INLINE void add_lfvector_lfvectorS(
     float (*to)[3], float (*fLongVectorA)[3], float (*fLongVectorB)[3], float bS, uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
-  }
+  cloth_parallel_foreach(
+      verts, [&](const uint i) { VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS); });
 }
 /* `A = B * float + C * float` -> for big vector */
 DO_INLINE void add_lfvectorS_lfvectorS(float (*to)[3],
@@ -207,11 +218,8 @@ DO_INLINE void add_lfvectorS_lfvectorS(float (*to)[3],
                                        float bS,
                                        uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    VECADDSS(to[i], fLongVectorA[i], aS, fLongVectorB[i], bS);
-  }
+  cloth_parallel_foreach(
+      verts, [&](const uint i) { VECADDSS(to[i], fLongVectorA[i], aS, fLongVectorB[i], bS); });
 }
 /* `A = B - C * float` -> for big vector. */
 DO_INLINE void sub_lfvector_lfvectorS(
@@ -228,11 +236,8 @@ DO_INLINE void sub_lfvector_lfvector(float (*to)[3],
                                      float (*fLongVectorB)[3],
                                      uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    sub_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
-  }
+  cloth_parallel_foreach(
+      verts, [&](const uint i) { sub_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]); });
 }
 ///////////////////////////
 // 3x3 matrix
@@ -582,23 +587,22 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
 
   zero_lfvector(to, vcount);
 
-#  pragma omp parallel sections if (vcount > CLOTH_OPENMP_LIMIT)
-  {
-#  pragma omp section
-    {
-      for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
-        /* This is the lower triangle of the sparse matrix,
-         * therefore multiplication occurs with transposed sub-matrices. */
-        muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
-      }
-    }
-#  pragma omp section
-    {
-      for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
-        muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
-      }
-    }
-  }
+  /* Both halves accumulate into their own vector in a fixed order, so they can run at the same
+   * time without changing the result. */
+  blender::threading::parallel_invoke(
+      vcount > CLOTH_PARALLEL_GRAIN_SIZE,
+      [&]() {
+        for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
+          /* This is the lower triangle of the sparse matrix,
+           * therefore multiplication occurs with transposed sub-matrices. */
+          muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
+        }
+      },
+      [&]() {
+        for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
+          muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
+        }
+      });
   add_lfvector_lfvector(to, to, temp, from[0].vcount);
 
   del_lfvector(temp);
@@ -610,12 +614,10 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
 DO_INLINE void subadd_bfmatrixS_bfmatrixS(
     fmatrix3x3 *to, fmatrix3x3 *from, float aS, fmatrix3x3 *matrix, float bS)
 {
-  uint i = 0;
-
   /* process diagonal elements */
-  for (i = 0; i < matrix[0].vcount + matrix[0].scount; i++) {
+  cloth_parallel_foreach(matrix[0].vcount + matrix[0].scount, [&](const uint i) {
     subadd_fmatrixS_fmatrixS(to[i].m, from[i].m, aS, matrix[i].m, bS);
-  }
+  });
 }
 
 ///////////////////////////////////////////////////////////////////
@@ -733,11 +735,8 @@ BLI_INLINE void root_to_world_m3(Implicit_Data *data,
 
 DO_INLINE void filter(lfVector *V, fmatrix3x3 *S)
 {
-  uint i = 0;
-
-  for (i = 0; i < S[0].vcount; i++) {
-    mul_m3_v3(S[i].m, V[S[i].r]);
-  }
+  /* The filter matrix is diagonal, so every block affects a different vertex. */
+  cloth_parallel_foreach(S[0].vcount, [&](const uint i) { mul_m3_v3(S[i].m, V[S[i].r]); });
 }
 
 /* this version of the CG algorithm does not work very well with partial constraints
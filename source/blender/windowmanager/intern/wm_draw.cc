@@ -742,6 +742,22 @@ static void wm_draw_region_buffer_create(Scene *scene,
   }
 }
 
+/**
+ * Check if the region was drawn into an off-screen buffer before, that can still be used as is
+ * (with the same size and format) when compositing the window.
+ */
+static bool wm_draw_region_buffer_is_valid(const Scene *scene, const ARegion *region)
+{
+  const wmDrawBuffer *draw_buffer = region->runtime->draw_buffer;
+  if (!draw_buffer || draw_buffer->stereo || !draw_buffer->offscreen) {
+    return false;
+  }
+  const GPUOffScreen *offscreen = draw_buffer->offscreen;
+  return GPU_offscreen_width(offscreen) == region->winx &&
+         GPU_offscreen_height(offscreen) == region->winy &&
+         GPU_offscreen_format(offscreen) == get_hdr_framebuffer_format(scene);
+}
+
 static void wm_draw_region_bind(ARegion *region, int view)
 {
   if (!region->runtime->draw_buffer) {
@@ -1036,6 +1052,15 @@ static void wm_draw_window_offscreen(bContext *C, wmWindow *win, bool stereo)
     }
 
     Scene *scene = WM_window_get_active_scene(win);
+
+    /* Menus are composited on top of the window from their own buffer. When another part of the
+     * window is redrawn, a menu that wasn't tagged for redraw can keep its buffer. */
+    if (!region->runtime->do_draw && wm_draw_region_buffer_is_valid(scene, region)) {
+      GPU_debug_group_end();
+      CTX_wm_region_popup_set(C, nullptr);
+      continue;
+    }
+
     wm_draw_region_buffer_create(scene, region, false, false);
     wm_draw_region_bind(region, 0);
     GPU_clear_color(0.0f, 0.0f, 0.0f, 0.0f);
@@ -25,6 +25,8 @@
 
 #include "SEQ_prefetch.hh"
 
+#include "ED_screen.hh"
+
 #include "WM_api.hh"
 #include "WM_types.hh"
 #include "wm.hh"
@@ -402,6 +404,15 @@ static void *do_job_thread(void *job_v)
   return nullptr;
 }
 
+/**
+ * Jobs that only generate previews for the UI. Their result isn't needed right away, so they
+ * shouldn't compete with animation playback for CPU time.
+ */
+static bool wm_job_is_deferrable(const wmJob *wm_job)
+{
+  return ELEM(wm_job->job_type, WM_JOB_TYPE_RENDER_PREVIEW, WM_JOB_TYPE_LOAD_PREVIEW);
+}
+
 /* Don't allow same startjob to be executed twice. */
 static void wm_jobs_test_suspend_stop(wmWindowManager *wm, wmJob *test)
 {
@@ -444,6 +455,11 @@ static void wm_jobs_test_suspend_stop(wmWindowManager *wm, wmJob *test)
     }
   }
 
+  /* Wait for playback to stop before starting preview jobs, the job timer tries again. */
+  if (!suspend && wm_job_is_deferrable(test) && ED_screen_animation_playing(wm)) {
+    suspend = true;
+  }
+
   /* Possible suspend ourselves, waiting for other jobs, or de-suspend. */
   test->suspended = suspend;
 #if 0
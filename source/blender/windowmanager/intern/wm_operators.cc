@@ -67,17 +67,21 @@
 #include "BKE_report.hh"
 #include "BKE_scene.hh"
 #include "BKE_screen.hh" /* #BKE_ST_MAXNAME. */
+#include "BKE_undo_system.hh"
 
 #include "BKE_idtype.hh"
 
 #include "BLF_api.hh"
 
+#include "GPU_capabilities.hh"
+#include "GPU_context.hh"
 #include "GPU_immediate.hh"
 #include "GPU_immediate_util.hh"
 #include "GPU_matrix.hh"
 #include "GPU_state.hh"
 
 #include "IMB_imbuf_types.hh"
+#include "IMB_moviecache.hh"
 
 #include "ED_fileselect.hh"
 #include "ED_gpencil_legacy.hh"
@@ -3802,9 +3806,35 @@ static void WM_OT_redraw_timer(wmOperatorType *ot)
  * Use for testing/debugging.
  * \{ */
 
-static wmOperatorStatus memory_statistics_exec(bContext * /*C*/, wmOperator * /*op*/)
+/**
+ * Print how the memory is split between the larger caches, which are not visible from the
+ * allocation names listed by #MEM_printmemlist_stats.
+ */
+static void memory_statistics_print_subsystems(const wmWindowManager *wm)
+{
+  const double mb = 1024.0 * 1024.0;
+  printf("\nmemory by subsystem:\n");
+  printf("  image & movie caches: %.3f MB\n", double(IMB_moviecache_get_memory_in_use()) / mb);
+
+  size_t undo_size = 0;
+  if (wm->undo_stack) {
+    LISTBASE_FOREACH (const UndoStep *, us, &wm->undo_stack->steps) {
+      undo_size += us->data_size;
+    }
+  }
+  printf("  undo: %.3f MB\n", double(undo_size) / mb);
+
+  if (GPU_context_active_get() && GPU_mem_stats_supported()) {
+    int gpu_total_kb, gpu_free_kb;
+    GPU_mem_stats_get(&gpu_total_kb, &gpu_free_kb);
+    printf("  GPU (all processes): %.3f MB\n", double(gpu_total_kb - gpu_free_kb) / 1024.0);
+  }
+}
+
+static wmOperatorStatus memory_statistics_exec(bContext *C, wmOperator * /*op*/)
 {
   MEM_printmemlist_stats();
+  memory_statistics_print_subsystems(CTX_wm_manager(C));
   return OPERATOR_FINISHED;
 }
 
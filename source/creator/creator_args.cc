@@ -741,6 +741,7 @@ static void print_help(bArgs *ba, bool all)
   }
   BLI_args_print_arg_doc(ba, "--debug-memory");
   BLI_args_print_arg_doc(ba, "--debug-jobs");
+  BLI_args_print_arg_doc(ba, "--debug-load");
   BLI_args_print_arg_doc(ba, "--debug-python");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-eval");
@@ -1130,6 +1131,21 @@ static int arg_handle_disable_depsgraph_on_file_load(int /*argc*/,
   return 0;
 }
 
+static const char arg_handle_enable_file_data_mmap_doc[] =
+    "\n"
+    "\tBackground mode: Reference large arrays of data (like mesh attributes) directly from the\n"
+    "\tmemory-mapped blend-file instead of copying them when loading it (`-b` or `-c` options).\n"
+    "\tThis reduces loading time and memory usage of uncompressed blend-files.\n"
+    "\n"
+    "\tNOTE: the blend-file must not be modified by other processes while Blender is running.";
+static int arg_handle_enable_file_data_mmap(int /*argc*/,
+                                            const char ** /*argv*/,
+                                            void * /*data*/)
+{
+  G.fileflags |= G_BACKGROUND_FILE_DATA_MMAP;
+  return 0;
+}
+
 static const char arg_handle_disable_liboverride_auto_resync_doc[] =
     "\n"
     "\tDo not perform library override automatic resync when loading a new blendfile.\n"
@@ -1326,6 +1342,10 @@ static const char arg_handle_debug_mode_generic_set_doc_xr_time[] =
 static const char arg_handle_debug_mode_generic_set_doc_jobs[] =
     "\n\t"
     "Enable time profiling for background jobs.";
+static const char arg_handle_debug_mode_generic_set_doc_load[] =
+    "\n\t"
+    "Enable time profiling of blend-file loading, printed as JSON (per ID type, versioning\n"
+    "\tfunction, library and loading stage).";
 static const char arg_handle_debug_mode_generic_set_doc_depsgraph[] =
     "\n\t"
     "Enable all debug messages from dependency graph.";
@@ -2726,6 +2746,12 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
                CB(arg_handle_disable_depsgraph_on_file_load),
                nullptr);
 
+  BLI_args_add(ba,
+               nullptr,
+               "--enable-file-data-mmap",
+               CB(arg_handle_enable_file_data_mmap),
+               nullptr);
+
   BLI_args_add(ba,
                nullptr,
                "--disable-liboverride-auto-resync",
@@ -2810,6 +2836,11 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
                "--debug-jobs",
                CB_EX(arg_handle_debug_mode_generic_set, jobs),
                (void *)G_DEBUG_JOBS);
+  BLI_args_add(ba,
+               nullptr,
+               "--debug-load",
+               CB_EX(arg_handle_debug_mode_generic_set, load),
+               (void *)G_DEBUG_IO_LOAD);
   BLI_args_add(ba, nullptr, "--debug-gpu", CB(arg_handle_debug_gpu_set), nullptr);
   BLI_args_add(ba,
                nullptr,
@@ -0,0 +1,157 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _prepare_scene(args):
+    import bpy
+
+    # Start from an empty scene, so results don't depend on the startup file.
+    bpy.ops.wm.read_homefile(use_empty=True, use_factory_startup=True)
+
+    bpy.ops.mesh.primitive_grid_add(
+        x_subdivisions=args['grid_size'],
+        y_subdivisions=args['grid_size'],
+        size=2.0)
+    grid = bpy.context.object
+
+    # Many small objects with parenting, to give the dependency graph some relations.
+    mesh = bpy.data.meshes.new("Cube")
+    collection = bpy.context.scene.collection
+    for i in range(args['objects_num']):
+        ob = bpy.data.objects.new("Cube_{:d}".format(i), mesh)
+        ob.location = (float(i % 100), float(i // 100), 0.0)
+        ob.parent = grid
+        collection.objects.link(ob)
+
+    bpy.context.view_layer.objects.active = grid
+    bpy.context.view_layer.update()
+    return grid
+
+
+def _measure(function, min_measurements=5, max_measurements=100, timeout=5):
+    import time
+
+    test_time_start = time.time()
+    measured_times = []
+
+    while True:
+        start_time = time.time()
+        function()
+        elapsed_time = time.time() - start_time
+        measured_times.append(elapsed_time)
+
+        if len(measured_times) >= min_measurements and test_time_start + timeout < time.time():
+            break
+        if len(measured_times) >= max_measurements:
+            break
+
+    return sum(measured_times) / len(measured_times)
+
+
+def _run_edit_mode_toggle(args):
+    import bpy
+
+    _prepare_scene(args)
+
+    def toggle():
+        bpy.ops.object.mode_set(mode='EDIT')
+        bpy.ops.object.mode_set(mode='OBJECT')
+
+    return {'time': _measure(toggle)}
+
+
+def _run_depsgraph_relations(args):
+    import bpy
+
+    grid = _prepare_scene(args)
+    helper = bpy.data.objects.new("Helper", None)
+    bpy.context.scene.collection.objects.link(helper)
+
+    def rebuild():
+        # Changing an ID pointer tags the dependency graph relations for a rebuild.
+        helper.parent = None if helper.parent else grid
+        bpy.context.view_layer.update()
+
+    return {'time': _measure(rebuild)}
+
+
+def _run_file_save(args):
+    import bpy
+    import os
+    import tempfile
+
+    _prepare_scene(args)
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        filepath = os.path.join(temp_dir, "file_save.blend")
+
+        def save():
+            bpy.ops.wm.save_as_mainfile(filepath=filepath, copy=True, compress=False)
+
+        return {'time': _measure(save)}
+
+
+def _run_obj_export(args):
+    import bpy
+    import os
+    import tempfile
+
+    _prepare_scene(args)
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        filepath = os.path.join(temp_dir, "export.obj")
+
+        def export():
+            bpy.ops.wm.obj_export(filepath=filepath, export_materials=False)
+
+        return {'time': _measure(export)}
+
+
+def _run_obj_import(args):
+    import bpy
+    import os
+    import tempfile
+
+    _prepare_scene(args)
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        filepath = os.path.join(temp_dir, "import.obj")
+        bpy.ops.wm.obj_export(filepath=filepath, export_materials=False)
+
+        def do_import():
+            bpy.ops.wm.obj_import(filepath=filepath)
+
+        return {'time': _measure(do_import)}
+
+
+class CoreOperationTest(api.Test):
+    def __init__(self, name, function):
+        self._name = name
+        self.function = function
+
+    def name(self):
+        return self._name
+
+    def category(self):
+        return "core_operations"
+
+    def run(self, env, device_id):
+        args = {
+            'grid_size': 1000,
+            'objects_num': 2000,
+        }
+        result, _ = env.run_in_blender(self.function, args)
+        return result
+
+
+def generate(env):
+    return [
+        CoreOperationTest("edit_mode_toggle", _run_edit_mode_toggle),
+        CoreOperationTest("depsgraph_relations", _run_depsgraph_relations),
+        CoreOperationTest("file_save", _run_file_save),
+        CoreOperationTest("obj_export", _run_obj_export),
+        CoreOperationTest("obj_import", _run_obj_import),
+    ]